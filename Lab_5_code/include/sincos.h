@@ -24,4 +24,23 @@ int fixed_sin_C(int x);
 // the input, then calls fixed_sin_C
 int fixed_cos_C(int x);
 
+//*************************************************************
+// Table mode: faster versions that use a quarter-wave table
+// instead of the Taylor series. SINCOS_INTERP selects linear
+// (1) or quadratic (2) interpolation between table entries.
+// Linear is accurate to about 5e-6, quadratic to within a few
+// LSBs of the S(3,28) result.
+#ifndef SINCOS_INTERP
+#define SINCOS_INTERP 2
+#endif
+
+int fixed_sin_table(int x);
+int fixed_cos_table(int x);
+
+//*************************************************************
+// sin_cos_batch fills s and c with the sine and cosine of
+// each of the n angles in x, all as S(3,28). Either output
+// may be NULL.
+void sin_cos_batch(const int *x, int *s, int *c, int n);
+
 #endif
@@ -0,0 +1,25 @@
+#ifndef SINCOS_BENCH_TASK_H
+#define SINCOS_BENCH_TASK_H
+
+#include <FreeRTOS.h>
+
+// Compares the table versions of sine and cosine in sincos.c with
+// fixed_sin_C/fixed_cos_C, measuring CPU cycles per value and the
+// largest difference between them, and prints the results on UART1.
+void sincos_bench_task(void *pvParameters);
+
+/* Dimensions the buffer that the task being created will use as its
+stack. NOTE: This is the number of words the stack will hold, not the
+number of bytes. For example, if each stack item is 32-bits, and this
+is set to 100, then 400 bytes (100 * 32-bits) will be allocated. */
+#define SINCOS_BENCH_STACK_SIZE 256
+
+/* Structure that will hold the TCB of the task being created. */
+extern StaticTask_t sincos_bench_TCB;
+
+/* Buffer that the task being created will use as its stack. Note this
+is an array of StackType_t variables. The size of StackType_t is
+dependent on the RTOS port. */
+extern StackType_t sincos_bench_stack[ SINCOS_BENCH_STACK_SIZE ];
+
+#endif
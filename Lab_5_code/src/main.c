@@ -7,6 +7,7 @@
 #include <PM_test_task.h>
 #include <firework_task.h>
 #include <testcurs_task.h>
+#include <sincos_bench_task.h>
 #include <ninvaders.h>
 #include <device_addrs.h>
 #include <LDP-001_PM_driver.h>
@@ -60,6 +61,11 @@ int main( void )
   				      PM_TEST_STACK_SIZE,
   				      NULL,2,PM_test_stack,&PM_test_TCB);
 			      
+  /* Create the task without using any dynamic memory allocation. */
+  //xTaskCreateStatic(sincos_bench_task,"sincos_bench",
+  //				      SINCOS_BENCH_STACK_SIZE,
+  //				      NULL,1,sincos_bench_stack,&sincos_bench_TCB);
+			      
   /* Create the task without using any dynamic memory allocation. */
   hello_handle = xTaskCreateStatic(hello_task,"hello",HELLO_STACK_SIZE,
   				   NULL,4,hello_stack,&hello_TCB);
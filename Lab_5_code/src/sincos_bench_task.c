@@ -0,0 +1,83 @@
+#include <sincos_bench_task.h>
+#include <task.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <UART_16550.h>
+#include <cycle_counter.h>
+#include <uart_driver_table.h>
+#include <sincos.h>
+
+// Number of angles, spread evenly from -2*pi to 2*pi.
+#define BENCH_ANGLES 256
+
+static int angles[BENCH_ANGLES];
+static int ref_sin[BENCH_ANGLES];
+static int ref_cos[BENCH_ANGLES];
+static int sin_out[BENCH_ANGLES];
+static int cos_out[BENCH_ANGLES];
+
+// Largest difference from the Taylor series results, in S(3,28) LSBs.
+static int max_error(const int *out, const int *ref)
+{
+  int worst = 0;
+  for(int i=0; i<BENCH_ANGLES; i++)
+    if(abs(out[i] - ref[i]) > worst)
+      worst = abs(out[i] - ref[i]);
+  return worst;
+}
+
+static void report(const char *name, uint32_t cycles, int sin_err, int cos_err)
+{
+  static char buffer[80];
+  sprintf(buffer, "%-20s %12lu  %8d  %8d\r\n", name,
+          (unsigned long)(cycles / (2 * BENCH_ANGLES)), sin_err, cos_err);
+  ANSI_uart.write_string(UART1, buffer, portMAX_DELAY);
+}
+
+void sincos_bench_task(void *pvParameters)
+{
+  uint32_t start, cycles;
+
+  cycle_counter_enable();
+
+  for(int i=0; i<BENCH_ANGLES; i++)
+    angles[i] = -pi_x2 + (int)(((int64_t)2 * pi_x2 * i) / (BENCH_ANGLES - 1));
+
+  ANSI_uart.tx_lock(UART1, portMAX_DELAY);
+  ANSI_uart.write_string(UART1, "version              cycles/value   sin err   cos err\r\n", portMAX_DELAY);
+
+  start = DWT->CYCCNT;
+  for(int i=0; i<BENCH_ANGLES; i++){
+    ref_sin[i] = fixed_sin_C(angles[i]);
+    ref_cos[i] = fixed_cos_C(angles[i]);
+  }
+  cycles = DWT->CYCCNT - start;
+  report("fixed_sin/cos_C", cycles, 0, 0);
+
+  start = DWT->CYCCNT;
+  for(int i=0; i<BENCH_ANGLES; i++){
+    sin_out[i] = fixed_sin_table(angles[i]);
+    cos_out[i] = fixed_cos_table(angles[i]);
+  }
+  cycles = DWT->CYCCNT - start;
+  report("fixed_sin/cos_table", cycles, max_error(sin_out, ref_sin),
+         max_error(cos_out, ref_cos));
+
+  start = DWT->CYCCNT;
+  sin_cos_batch(angles, sin_out, cos_out, BENCH_ANGLES);
+  cycles = DWT->CYCCNT - start;
+  report("sin_cos_batch", cycles, max_error(sin_out, ref_sin),
+         max_error(cos_out, ref_cos));
+  ANSI_uart.tx_unlock(UART1);
+
+  while(1)
+    vTaskDelay(portMAX_DELAY);
+}
+
+/* Structure that will hold the TCB of the task being created. */
+StaticTask_t sincos_bench_TCB;
+
+/* Buffer that the task being created will use as its stack. Note this
+is an array of StackType_t variables. The size of StackType_t is
+dependent on the RTOS port. */
+StackType_t sincos_bench_stack[ SINCOS_BENCH_STACK_SIZE ];
@@ -0,0 +1,85 @@
+// Host-side accuracy and speed comparison of the Taylor series
+// (fixed_sin_C/fixed_cos_C) and table (fixed_sin_table,
+// fixed_cos_table, sin_cos_batch) versions in src/sincos.c.
+//
+// Build it with the host compiler, not the cross compiler. Add
+// -DSINCOS_INTERP=1 to measure linear interpolation:
+//
+//   cc -O2 -I../include -o sincos_bench sincos_bench.c ../src/sincos.c -lm
+//
+// The errors are measured against the C library in double precision
+// over angles from -2*pi to 2*pi. The times are host times, so only
+// the ratios between them mean much; the target numbers come from
+// sincos_bench_task.
+
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <sincos.h>
+
+#define NUM_ANGLES 100000
+#define REPEATS    20
+#define FIXED_ONE  268435456.0   // 1.0 as an S(3,28)
+
+static int angles[NUM_ANGLES];
+static int sin_out[NUM_ANGLES];
+static int cos_out[NUM_ANGLES];
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Largest error of out against f, in units of the S(3,28) LSB.
+static double max_error(const int *out, double (*f)(double))
+{
+  double worst = 0;
+  for(int i=0; i<NUM_ANGLES; i++){
+    double err = fabs(out[i] - f(angles[i] / FIXED_ONE) * FIXED_ONE);
+    if(err > worst)
+      worst = err;
+  }
+  return worst;
+}
+
+static void report(const char *name, double seconds, int calls)
+{
+  printf("%-18s  %8.1f ns/value  sin err %9.1f LSB  cos err %9.1f LSB\n",
+         name, seconds * 1e9 / calls,
+         max_error(sin_out, sin), max_error(cos_out, cos));
+}
+
+int main()
+{
+  double start;
+
+  for(int i=0; i<NUM_ANGLES; i++)
+    angles[i] = (int)lrint((-2 * M_PI + 4 * M_PI * i / (NUM_ANGLES - 1)) * FIXED_ONE);
+
+  printf("SINCOS_INTERP=%d, 1 LSB = %g\n", SINCOS_INTERP, 1 / FIXED_ONE);
+
+  start = now();
+  for(int r=0; r<REPEATS; r++)
+    for(int i=0; i<NUM_ANGLES; i++){
+      sin_out[i] = fixed_sin_C(angles[i]);
+      cos_out[i] = fixed_cos_C(angles[i]);
+    }
+  report("fixed_sin/cos_C", now() - start, 2 * REPEATS * NUM_ANGLES);
+
+  start = now();
+  for(int r=0; r<REPEATS; r++)
+    for(int i=0; i<NUM_ANGLES; i++){
+      sin_out[i] = fixed_sin_table(angles[i]);
+      cos_out[i] = fixed_cos_table(angles[i]);
+    }
+  report("fixed_sin/cos_table", now() - start, 2 * REPEATS * NUM_ANGLES);
+
+  start = now();
+  for(int r=0; r<REPEATS; r++)
+    sin_cos_batch(angles, sin_out, cos_out, NUM_ANGLES);
+  report("sin_cos_batch", now() - start, 2 * REPEATS * NUM_ANGLES);
+
+  return 0;
+}
@@ -58,6 +58,11 @@ void AXI_TIMER_set_repeating(unsigned int timer, int count);
 // Configure and start the timer give a single interrupt and then stop.
 void AXI_TIMER_set_oneshot(unsigned int timer, int count);
 
+// The same, for use in the timer's own handler, where the running
+// task is not the owner. This lets a handler chain delays of
+// different lengths.
+void AXI_TIMER_set_oneshot_from_ISR(unsigned int timer, int count);
+
 // The timers also have a PWM mode, which we may want to support
 // someday. These are are a couple of functions that may be useful at
 // that point, but we are not going to implement them now.
@@ -128,7 +128,7 @@ void setup_stats_timer();
 #define INCLUDE_vTaskSuspend                      0
 #define INCLUDE_vTaskDelayUntil                   1
 #define INCLUDE_vTaskDelay                        1
-#define INCLUDE_uxTaskGetStackHighWaterMark       0
+#define INCLUDE_uxTaskGetStackHighWaterMark       1
 #define INCLUDE_uxTaskGetStackHighWaterMark2      0
 #define INCLUDE_xTaskGetSchedulerState            0
 #define INCLUDE_xTimerGetTimerDaemonTaskHandle    0
@@ -82,4 +82,23 @@ int UART_16550_chars_available(int UART_number);
 // Flush the UART receiver FIFO and receiver stream buffer
 void UART_16550_flush_rx(int UART_number);
 
+/* Function called from the receiver ISR after characters have been
+   moved into the receiver stream buffer. It must only use FromISR
+   API calls, and should set *HigherPriorityTaskWoken if it wakes a
+   task. */
+typedef void (*UART_16550_rx_callback_t)(void *arg,
+					 BaseType_t *HigherPriorityTaskWoken);
+
+// Set (or clear, with NULL) the receiver callback for the given UART
+void UART_16550_set_rx_callback(int UART_number,
+				UART_16550_rx_callback_t callback,
+				void *arg);
+
+// Return the number of characters written to the transmitter since
+// startup. The count wraps around, so use differences between calls.
+uint32_t UART_16550_tx_count(int UART_number);
+
+// Return the number of characters waiting in the transmit stream buffer
+int UART_16550_tx_pending(int UART_number);
+
 #endif
@@ -0,0 +1,54 @@
+#ifndef BOARD_IO_H
+#define BOARD_IO_H
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+// This file defines the API for the LED and slide switch driver. The
+// 16 LEDs and the 16 slide switches are on GPIO 1, and the two RGB
+// LEDs are on GPIO 0, channel 1.
+
+// LED writes are collected in shadow registers, and the shadows are
+// written to the GPIO by a software timer this often, so many tasks
+// can update their own LEDs for the cost of one bus write per
+// period.
+#define BOARD_IO_FLUSH_MS 40
+
+// Colours of an RGB LED, in the order its pins are wired to the GPIO.
+#define RGB_OFF    0x0
+#define RGB_BLUE   0x1
+#define RGB_GREEN  0x2
+#define RGB_RED    0x4
+#define RGB_YELLOW (RGB_RED | RGB_GREEN)
+#define RGB_WHITE  (RGB_RED | RGB_GREEN | RGB_BLUE)
+
+// Initialize the driver, start the flush timer and enable the switch
+// interrupt. This should be called once, before the scheduler is
+// started.
+void BOARD_IO_init();
+
+// Set the LEDs selected by mask to the matching bits of value. The
+// other LEDs are left as they are, so each task can own a few of
+// them.
+void LEDS_set(uint32_t mask, uint32_t value);
+
+// Return the state that the LEDs will have after the next flush
+uint32_t LEDS_get();
+
+// Set RGB LED 0 or 1 to one of the RGB_ colours.
+void RGB_LEDS_set(int led, uint32_t colour);
+
+// Write any changed shadow registers to the GPIO now, instead of at
+// the next flush.
+void LEDS_flush();
+
+// Return the state of the slide switches. Switch 0 is bit 0.
+uint32_t SWITCHES_state();
+
+// Notify task (or nobody, with NULL) when the switches change. The
+// task's notification value is overwritten with the new state, so a
+// task can wait for it with xTaskNotifyWait(). Bounces just give a
+// few quick notifications; the last one has the settled state.
+void SWITCHES_notify(TaskHandle_t task);
+
+#endif
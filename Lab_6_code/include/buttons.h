@@ -0,0 +1,54 @@
+#ifndef BUTTONS_H
+#define BUTTONS_H
+
+#include <FreeRTOS.h>
+
+// This file defines the API for the push button driver. The five
+// buttons are on GPIO 0, channel 2, and interrupt on GPIO0_IRQ.
+
+// Bits in the button state, in the order the buttons are wired to the
+// GPIO.
+#define BUTTON_CENTER 0x01
+#define BUTTON_UP     0x02
+#define BUTTON_LEFT   0x04
+#define BUTTON_RIGHT  0x08
+#define BUTTON_DOWN   0x10
+#define BUTTON_ALL    0x1F
+
+// A button that changes state is reported right away, from the ISR.
+// After that, button interrupts are ignored for this long while the
+// contacts settle, and then the buttons are read again.
+#define BUTTONS_DEBOUNCE_MS 10
+
+// Number of events that the driver can hold for a slow reader.
+#define BUTTONS_QUEUE_LENGTH 16
+
+// One change of the buttons.
+typedef struct{
+  uint8_t pressed;  // buttons that went down
+  uint8_t released; // buttons that went up
+  uint8_t state;    // buttons that are down after the change
+}BUTTONS_event_t;
+
+// Initialize the push button driver and enable its interrupt. This
+// should be called once, before the scheduler is started.
+void BUTTONS_init();
+
+/* Function called whenever an event has been added to the queue. It
+   is called from the GPIO ISR or from the timer task, must only use
+   FromISR API calls, and should set *HigherPriorityTaskWoken if it
+   wakes a task. */
+typedef void (*BUTTONS_callback_t)(void *arg,
+				   BaseType_t *HigherPriorityTaskWoken);
+
+// Set (or clear, with NULL) the event callback
+void BUTTONS_set_callback(BUTTONS_callback_t callback, void *arg);
+
+// Get the next button event. Returns pdPASS if there was one.
+BaseType_t BUTTONS_get_event(BUTTONS_event_t *event,
+			     TickType_t xTicksToWait);
+
+// Return the debounced state of the buttons
+uint32_t BUTTONS_state();
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+
+#include <FreeRTOS.h>
+
+// Turn on the DWT cycle counter in the Cortex-M3 debug block. The
+// counter is not reset: it may already be timing something else, and
+// callers only ever use differences of DWT->CYCCNT (it wraps every
+// 86 s at 50 MHz), so enabling it more than once is harmless.
+static inline void cycle_counter_enable()
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+#endif
@@ -28,6 +28,11 @@
 // For more information on the GPIO devices, read the AXI GPIO
 // LogiCORE Product Guide.
 
+// The GPIO addresses below are not declared volatile. Access them
+// through DEVICE_REG, because every read and write must reach the
+// device: reading an isr register clears it, for one.
+#define DEVICE_REG(r) (*(volatile uint32_t *)(r))
+
 // The rgb leds and the five pushbuttons are are in GPIO_0, channels 0 and 1
 // The lower 6 bits of RGB_LED control the two RGB LEDS.
 #define RGB_LEDS      ((uint32_t*)0x40000000)  // gpio_0.channel1.data
@@ -60,7 +65,7 @@
 // the interrupt and to clear the interrupt(s).  For more information,
 // read the AXI GPIO LogiCORE Product Guide.
 #define GPIO_bits    ((uint32_t*)0x40020000)  // gpio_2.channel1.data
-#define GPIO_tris    ((uint32_t*)0x40020000)  // gpio_2.channel1.tris
+#define GPIO_tris    ((uint32_t*)0x40020004)  // gpio_2.channel1.tris
 #define GPIO_gier    ((uint32_t*)0x4002011C)  // gpio_2.gier
 #define GPIO_ier     ((uint32_t*)0x40020128)  // gpio_2.ier
 #define GPIO_isr     ((uint32_t*)0x40020120)  // gpio_2.isr
@@ -0,0 +1,27 @@
+#ifndef MIXER_BENCH_TASK_H
+#define MIXER_BENCH_TASK_H
+
+#include <FreeRTOS.h>
+
+// Measures how many CPU cycles effect_mix_block() takes to mix 1 to
+// NUM_EFFECTS simultaneous sound effects and prints the results on
+// UART1. effect_mix_block() works on the mixer's own filter, noise
+// shaper and meter state, so the mixer task must not be running:
+// leave effect_init() out of main when creating this task.
+void mixer_bench_task(void *pvParameters);
+
+/* Dimensions the buffer that the task being created will use as its
+stack. NOTE: This is the number of words the stack will hold, not the
+number of bytes. For example, if each stack item is 32-bits, and this
+is set to 100, then 400 bytes (100 * 32-bits) will be allocated. */
+#define MIXER_BENCH_STACK_SIZE 256
+
+/* Structure that will hold the TCB of the task being created. */
+extern StaticTask_t mixer_bench_TCB;
+
+/* Buffer that the task being created will use as its stack. Note this
+is an array of StackType_t variables. The size of StackType_t is
+dependent on the RTOS port. */
+extern StackType_t mixer_bench_stack[ MIXER_BENCH_STACK_SIZE ];
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef PMOD_GPIO_H
+#define PMOD_GPIO_H
+
+#include <FreeRTOS.h>
+#include <AXI_timer.h>
+
+// This file defines the API for the 8 GPIO pins on PMOD header JA
+// (GPIO 2), and for a waveform engine that plays a list of pin
+// changes with AXI timer paced delays between them. The engine can
+// bit-bang simple serial protocols (SPI, 1-wire and the like) at a
+// fixed rate without a task spinning on the pins.
+
+// Pin n of the GPIO is bit n. JA pins 1-4 are bits 0-3 and JA pins
+// 7-10 are bits 4-7.
+#define PMOD_PINS 0xFF
+
+// Initialize the driver. All pins start as inputs. This should be
+// called once, before the scheduler is started.
+void PMOD_GPIO_init();
+
+// Make the pins in outputs outputs, and all others inputs.
+void PMOD_GPIO_set_outputs(uint32_t outputs);
+
+// Set the output pins selected by mask to the matching bits of value.
+void PMOD_GPIO_write(uint32_t mask, uint32_t value);
+
+// Read all 8 pins.
+uint32_t PMOD_GPIO_read();
+
+/* Function called from the GPIO ISR when an input pin changes. It
+   gets the pins that changed and must only use FromISR API calls. */
+typedef void (*PMOD_GPIO_callback_t)(uint32_t changed,
+				     BaseType_t *HigherPriorityTaskWoken);
+
+// Set (or clear, with NULL) the input change callback, and enable or
+// disable the input change interrupt.
+void PMOD_GPIO_set_callback(PMOD_GPIO_callback_t callback);
+
+// Called by the GPIO 1 ISR, which the PMOD GPIO shares.
+void PMOD_GPIO_handler(BaseType_t *HigherPriorityTaskWoken);
+
+/************* Waveform engine *************************/
+
+// One step of a waveform: change the pins, optionally read them, then
+// wait before the next step.
+typedef struct{
+  uint8_t mask;     // pins that this step drives
+  uint8_t value;    // their new levels
+  uint8_t sample;   // when not 0, read the pins after driving them
+  uint32_t delay;   // AXI timer counts until the next step; use
+                    // AXI_TIMER_US_TO_COUNT or PMOD_WAVE_NS_TO_COUNT
+}PMOD_step_t;
+
+// Timer counts for a delay in nanoseconds (20 ns resolution), at
+// least 1. Delays shorter than the ISR (a couple of microseconds) are
+// stretched to it: the timer interrupt is raised again while the ISR
+// still runs, and is taken as soon as it returns.
+#define PMOD_WAVE_NS_TO_COUNT(x) \
+  ((((x)*AXI_TIMER_CLOCK_FREQ)/1000000000LL) > 2 ? \
+   (uint32_t)(((x)*AXI_TIMER_CLOCK_FREQ)/1000000000LL)-2 : 1u)
+
+// NVIC priority of the waveform timer. It is more urgent than the
+// UARTs and buttons, but still allowed to call FreeRTOS.
+#define PMOD_WAVE_IRQ_PRIORITY 0x5
+
+// Allocate an AXI timer for the waveform engine. The calling task
+// owns the timer and is the only task that can play waveforms.
+// Returns pdFAIL if no timer is available.
+BaseType_t PMOD_wave_init();
+
+// Start playing count steps. The first step is driven at once, and
+// the rest follow from the timer ISR. Every step with sample set
+// stores the pins in samples (which may be NULL if there are none).
+// steps and samples must stay valid until the waveform is done.
+// Returns pdFAIL if a waveform is already playing.
+BaseType_t PMOD_wave_play(const PMOD_step_t *steps, int count,
+			  uint8_t *samples);
+
+// Wait for the waveform to finish. Returns pdPASS if it did. This
+// uses the calling task's notification.
+BaseType_t PMOD_wave_wait(TickType_t xTicksToWait);
+
+// Fill steps with one SPI mode 0 byte, most significant bit first:
+// data changes with sck low, and miso is sampled on the rising edge.
+// half_period is in timer counts. Returns the number of steps (16).
+int PMOD_wave_spi_byte(PMOD_step_t *steps, uint8_t byte,
+		       uint8_t sck, uint8_t mosi, uint32_t half_period);
+
+// Turn the 8 samples taken by one PMOD_wave_spi_byte() into the byte
+// read from pin miso.
+uint8_t PMOD_wave_spi_result(const uint8_t *samples, uint8_t miso);
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef SPRITE_TEST_TASK_H
+#define SPRITE_TEST_TASK_H
+
+#include <FreeRTOS.h>
+
+// Plays 1000 player deaths and a title screen now and then through the
+// game's view, then checks on UART1 that the heap did not grow. The
+// game task must not be running at the same time.
+void sprite_test_task(void *pvParameters);
+
+/* Dimensions the buffer that the task being created will use as its
+stack. NOTE: This is the number of words the stack will hold, not the
+number of bytes. For example, if each stack item is 32-bits, and this
+is set to 100, then 400 bytes (100 * 32-bits) will be allocated. */
+#define SPRITE_TEST_STACK_SIZE 512
+
+/* Structure that will hold the TCB of the task being created. */
+extern StaticTask_t sprite_test_TCB;
+
+/* Buffer that the task being created will use as its stack. Note this
+is an array of StackType_t variables. The size of StackType_t is
+dependent on the RTOS port. */
+extern StackType_t sprite_test_stack[ SPRITE_TEST_STACK_SIZE ];
+
+#endif
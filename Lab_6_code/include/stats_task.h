@@ -5,8 +5,18 @@
 
 // "screen /dev/ttyUSB1 9600"
 
+// Prints the run time, heap, audio and game statistics on UART1.
+// The game's spectator mirror uses UART1 as well, so only run this
+// with NINVADERS_MIRROR set to 0.
 void stats_task(void *pvParameters);
 
+// Shows the CPU load on the LEDs, and runs the timer that the run
+// time statistics are counted with. Always create this task. It runs
+// above the game so that the LEDs still update at full load.
+void load_task(void *pvParameters);
+
+#define LOAD_PRIORITY 4
+
 /* Dimensions the buffer that the task being created will use as its
 stack. NOTE: This is the number of words the stack will hold, not the
 number of bytes. For example, if each stack item is 32-bits, and this
@@ -21,4 +31,14 @@ is an array of StackType_t variables. The size of StackType_t is
 dependent on the RTOS port. */
 extern StackType_t stats_stack[ STATS_STACK_SIZE ];
 
+/* Dimensions the buffer that load_task will use as its stack, in
+words. */
+#define LOAD_STACK_SIZE 128
+
+/* Structure that will hold the TCB of load_task. */
+extern StaticTask_t load_TCB;
+
+/* Buffer that load_task will use as its stack. */
+extern StackType_t load_stack[ LOAD_STACK_SIZE ];
+
 #endif
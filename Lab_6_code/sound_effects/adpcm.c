@@ -0,0 +1,101 @@
+#include <adpcm.h>
+
+// Standard IMA-ADPCM tables.
+static const int8_t index_table[16] = {
+  -1, -1, -1, -1, 2, 4, 6, 8,
+  -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static const uint16_t step_table[89] = {
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+  19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+  50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+  130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+  337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+  876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+  2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+  5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+  15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+// Apply one 4-bit code to the decoder state and return the new
+// sample. The encoder calls this too, so both sides stay in step.
+static inline int32_t adpcm_step(adpcm_state *state, unsigned code)
+{
+  int32_t step = step_table[state->step_index];
+  int32_t diff = step >> 3;
+
+  if(code & 4) diff += step;
+  if(code & 2) diff += step >> 1;
+  if(code & 1) diff += step >> 2;
+  if(code & 8)
+    state->predictor -= diff;
+  else
+    state->predictor += diff;
+
+  if(state->predictor > 32767)
+    state->predictor = 32767;
+  else if(state->predictor < -32768)
+    state->predictor = -32768;
+
+  state->step_index += index_table[code];
+  if(state->step_index < 0)
+    state->step_index = 0;
+  else if(state->step_index > 88)
+    state->step_index = 88;
+
+  return state->predictor;
+}
+
+// The mixer works with 8-bit samples, so keep the top byte.
+void adpcm_decode_block(const adpcm_block *in, int8_t *out)
+{
+  adpcm_state state = {in->predictor, in->step_index};
+
+  for(int i=0; i<ADPCM_BLOCK_BYTES; i++){
+    uint8_t byte = in->data[i];
+    *out++ = adpcm_step(&state, byte & 0x0F) >> 8;
+    *out++ = adpcm_step(&state, byte >> 4) >> 8;
+  }
+}
+
+// Pick the code whose reconstruction is closest to the sample.
+static unsigned adpcm_encode_sample(adpcm_state *state, int32_t sample)
+{
+  int32_t step = step_table[state->step_index];
+  int32_t diff = sample - state->predictor;
+  unsigned code = 0;
+
+  if(diff < 0){
+    code = 8;
+    diff = -diff;
+  }
+  if(diff >= step){
+    code |= 4;
+    diff -= step;
+  }
+  step >>= 1;
+  if(diff >= step){
+    code |= 2;
+    diff -= step;
+  }
+  step >>= 1;
+  if(diff >= step)
+    code |= 1;
+
+  adpcm_step(state, code);
+  return code;
+}
+
+void adpcm_encode_block(adpcm_state *state, const int16_t *in, adpcm_block *out)
+{
+  out->predictor = state->predictor;
+  out->step_index = state->step_index;
+  out->reserved = 0;
+
+  for(int i=0; i<ADPCM_BLOCK_BYTES; i++){
+    unsigned lo = adpcm_encode_sample(state, *in++);
+    unsigned hi = adpcm_encode_sample(state, *in++);
+    out->data[i] = lo | (hi << 4);
+  }
+}
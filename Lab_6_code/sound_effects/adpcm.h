@@ -0,0 +1,40 @@
+#ifndef ADPCM_H
+#define ADPCM_H
+
+#include <stdint.h>
+#include <sounds.h>
+
+// IMA-ADPCM compressed sound data. Each block holds one mixer buffer
+// (EFFECT_BUFFER_SIZE samples) at four bits per sample, plus the
+// decoder state at the start of the block. Because every block
+// carries its own state, any block can be decoded on its own, so a
+// sound can be started, looped or skipped at any buffer boundary.
+//
+// Sound data is converted to this format on the host with
+// tools/adpcm_convert.c, which writes C tables that use the
+// declarations below.
+#define ADPCM_BLOCK_BYTES (EFFECT_BUFFER_SIZE / 2)
+
+typedef struct{
+  int16_t predictor;   // decoded value of the sample before this block
+  uint8_t step_index;  // index into the step size table
+  uint8_t reserved;
+  uint8_t data[ADPCM_BLOCK_BYTES]; // two samples per byte, low nibble first
+}adpcm_block;
+
+// Encoder/decoder state carried from one sample to the next.
+typedef struct{
+  int32_t predictor;
+  int32_t step_index;
+}adpcm_state;
+
+// Decode one block into EFFECT_BUFFER_SIZE signed 8-bit samples, the
+// format the mixer works with.
+void adpcm_decode_block(const adpcm_block *in, int8_t *out);
+
+// Encode EFFECT_BUFFER_SIZE signed 16-bit samples into one block,
+// continuing from (and updating) state. This is used by the host
+// converter; it is never called on the target.
+void adpcm_encode_block(adpcm_state *state, const int16_t *in, adpcm_block *out);
+
+#endif
@@ -0,0 +1,128 @@
+#include <dsp.h>
+#include <string.h>
+
+const dsp_biquad_coeffs_t dsp_preemphasis[1] = {
+  {1516700640, -305714624, 271131808, -216429379, -191946620}
+};
+
+const dsp_biquad_coeffs_t dsp_lowpass[1] = {
+  {610995363, 1221990726, 610995363, -1012330264, -357909365}
+};
+
+const int16_t dsp_smooth[DSP_SMOOTH_TAPS] = {
+  528, -2817, 6383, 24580, 6383, -2817, 528
+};
+
+// Clip a 64-bit result to the 32-bit sample range.
+static inline int32_t dsp_sat(int64_t x)
+{
+  if(x > INT32_MAX)
+    return INT32_MAX;
+  if(x < INT32_MIN)
+    return INT32_MIN;
+  return (int32_t)x;
+}
+
+void dsp_biquad_init(dsp_biquad_t *f, const dsp_biquad_coeffs_t *coeffs,
+                     dsp_biquad_state_t *state, int num_stages)
+{
+  f->coeffs = coeffs;
+  f->state = state;
+  f->num_stages = num_stages;
+  memset(state, 0, num_stages * sizeof(dsp_biquad_state_t));
+}
+
+// Direct form I. The state is kept in locals for the whole block so
+// it stays in registers.
+void dsp_biquad_block(dsp_biquad_t *f, int32_t *data)
+{
+  for(int s=0; s<f->num_stages; s++){
+    const dsp_biquad_coeffs_t *c = &f->coeffs[s];
+    dsp_biquad_state_t *st = &f->state[s];
+    int32_t b0 = c->b0, b1 = c->b1, b2 = c->b2, a1 = c->a1, a2 = c->a2;
+    int32_t x1 = st->x1, x2 = st->x2, y1 = st->y1, y2 = st->y2;
+
+    for(int i=0; i<EFFECT_BUFFER_SIZE; i++){
+      int32_t x = data[i];
+      int64_t acc = (int64_t)b0 * x;
+      acc += (int64_t)b1 * x1;
+      acc += (int64_t)b2 * x2;
+      acc += (int64_t)a1 * y1;
+      acc += (int64_t)a2 * y2;
+      x2 = x1;
+      x1 = x;
+      y2 = y1;
+      y1 = dsp_sat(acc >> DSP_BIQUAD_SHIFT);
+      data[i] = y1;
+    }
+
+    st->x1 = x1;
+    st->x2 = x2;
+    st->y1 = y1;
+    st->y2 = y2;
+  }
+}
+
+void dsp_fir_init(dsp_fir_t *f, const int16_t *taps, int num_taps, int32_t *history)
+{
+  f->taps = taps;
+  f->num_taps = num_taps;
+  f->history = history;
+  memset(history, 0, DSP_FIR_HISTORY(num_taps) * sizeof(int32_t));
+}
+
+void dsp_fir_block(dsp_fir_t *f, int32_t *data)
+{
+  int32_t *h = f->history;
+  int n = f->num_taps - 1;
+
+  // append the new block after the saved samples
+  memcpy(&h[n], data, EFFECT_BUFFER_SIZE * sizeof(int32_t));
+
+  for(int i=0; i<EFFECT_BUFFER_SIZE; i++){
+    int64_t acc = 0;
+    const int32_t *x = &h[i + n];
+    for(int k=0; k<=n; k++)
+      acc += (int64_t)f->taps[k] * x[-k];
+    data[i] = dsp_sat(acc >> DSP_FIR_SHIFT);
+  }
+
+  // keep the end of the block for next time
+  memmove(h, &h[EFFECT_BUFFER_SIZE], n * sizeof(int32_t));
+}
+
+// Integer square root, one result bit per step.
+static uint32_t isqrt64(uint64_t x)
+{
+  uint64_t root = 0;
+  uint64_t bit = 1ULL << 62;
+
+  while(bit > x)
+    bit >>= 2;
+  while(bit != 0){
+    if(x >= root + bit){
+      x -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else
+      root >>= 1;
+    bit >>= 2;
+  }
+  return (uint32_t)root;
+}
+
+void dsp_meter_block(const int32_t *data, dsp_meter_t *m)
+{
+  uint64_t sum = 0;
+  uint32_t peak = 0;
+
+  for(int i=0; i<EFFECT_BUFFER_SIZE; i++){
+    int32_t x = data[i];
+    uint32_t a = x < 0 ? 0u - (uint32_t)x : (uint32_t)x;
+    sum += (int64_t)x * x;
+    if(a > peak)
+      peak = a;
+  }
+  m->rms = isqrt64(sum / EFFECT_BUFFER_SIZE);
+  m->peak = peak > INT32_MAX ? INT32_MAX : (int32_t)peak;
+}
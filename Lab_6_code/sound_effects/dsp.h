@@ -0,0 +1,79 @@
+#ifndef DSP_H
+#define DSP_H
+
+#include <stdint.h>
+#include <sounds.h>
+
+// Fixed-point filters and meters for the audio path. All of them work
+// in place on a whole block of EFFECT_BUFFER_SIZE 32-bit samples, so
+// they can run on the mix before it is reduced to the PM depth. The
+// sums are kept in 64 bits, which the compiler turns into SMULL and
+// SMLAL on the Cortex-M3, and results are saturated rather than
+// allowed to wrap.
+
+// Biquad coefficients have 30 fractional bits (Q2.30) so that values
+// up to +/-2 fit. The feedback terms are stored negated, so each
+// stage works out
+//
+//   y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2]
+#define DSP_BIQUAD_SHIFT 30
+
+typedef struct{
+  int32_t b0, b1, b2;
+  int32_t a1, a2;
+}dsp_biquad_coeffs_t;
+
+typedef struct{
+  int32_t x1, x2, y1, y2;
+}dsp_biquad_state_t;
+
+// A cascade of biquad stages. The caller provides the state, one per
+// stage, so filters can be allocated statically.
+typedef struct{
+  const dsp_biquad_coeffs_t *coeffs;
+  dsp_biquad_state_t *state;
+  int num_stages;
+}dsp_biquad_t;
+
+void dsp_biquad_init(dsp_biquad_t *f, const dsp_biquad_coeffs_t *coeffs,
+                     dsp_biquad_state_t *state, int num_stages);
+void dsp_biquad_block(dsp_biquad_t *f, int32_t *data);
+
+// FIR filter with Q15 taps. history must hold DSP_FIR_HISTORY(num_taps)
+// samples: the end of the previous block followed by the current one.
+#define DSP_FIR_SHIFT 15
+#define DSP_FIR_HISTORY(num_taps) ((num_taps) - 1 + EFFECT_BUFFER_SIZE)
+
+typedef struct{
+  const int16_t *taps;
+  int num_taps;
+  int32_t *history;
+}dsp_fir_t;
+
+void dsp_fir_init(dsp_fir_t *f, const int16_t *taps, int num_taps, int32_t *history);
+void dsp_fir_block(dsp_fir_t *f, int32_t *data);
+
+// RMS and peak level of a block, in the units of the samples.
+typedef struct{
+  int32_t rms;
+  int32_t peak;
+}dsp_meter_t;
+
+void dsp_meter_block(const int32_t *data, dsp_meter_t *m);
+
+// Ready-made stages for the 8 kHz mixer output.
+
+// High shelf, +6 dB above about 2 kHz, to make up for the roll-off
+// of the RC filter that reconstructs the audio from the PDM output.
+extern const dsp_biquad_coeffs_t dsp_preemphasis[1];
+
+// Second order Butterworth low-pass at 3 kHz, to take the edge off
+// aliasing and imaging close to half the sample rate.
+extern const dsp_biquad_coeffs_t dsp_lowpass[1];
+
+// Linear phase 7 tap low-pass FIR with its cut-off near 3 kHz; a
+// gentler alternative to dsp_lowpass.
+#define DSP_SMOOTH_TAPS 7
+extern const int16_t dsp_smooth[DSP_SMOOTH_TAPS];
+
+#endif
@@ -0,0 +1,346 @@
+#include <explosion1_adpcm.h>
+
+const adpcm_block explosion1_adpcm[NUM_explosion1_adpcm_BLOCKS] = {
+  {0, 0, 0, {
+    0xFF, 0xFF, 0x3F, 0x17, 0xCD, 0x2A, 0x53, 0xC3, 0xCE, 0x8A, 0x63, 0x02, 0xB9, 0xAC, 0x30, 0x12,
+    0x20, 0x23, 0x37, 0x00, 0xBD, 0xDB, 0x8C, 0x00, 0x21, 0x17, 0x09, 0x31, 0xA0, 0xBD, 0x08, 0x41,
+    0x91, 0x29, 0x52, 0x02, 0xA8, 0xFB, 0xBE, 0xAB, 0x10, 0x41, 0x24, 0x02, 0x41, 0x12, 0xA8, 0x1A,
+    0x37, 0x10, 0x99, 0xAD, 0xFB, 0x9B, 0x80, 0x10, 0xA0, 0xB9, 0x9A, 0x52, 0x74, 0x12, 0x12, 0x81	}
+	},
+  {18648, 71, 0, {
+    0xA9, 0xFB, 0xAC, 0x09, 0x20, 0x43, 0x32, 0x22, 0xC8, 0x8B, 0x08, 0xC0, 0xBF, 0x88, 0x12, 0x44,
+    0x02, 0xA0, 0x0A, 0x20, 0xA0, 0x0A, 0x67, 0x11, 0x80, 0xEB, 0xCB, 0x8A, 0x31, 0x22, 0x03, 0xB9,
+    0x9B, 0xAD, 0x00, 0x38, 0x37, 0xB8, 0xAB, 0x33, 0x25, 0x32, 0x84, 0xDE, 0xAB, 0x18, 0x43, 0x14,
+    0xC9, 0x8B, 0x88, 0x88, 0x48, 0x46, 0x12, 0x08, 0xA8, 0xBB, 0xAF, 0x09, 0x18, 0x10, 0x92, 0x20	}
+	},
+  {-5436, 70, 0, {
+    0x12, 0x09, 0x64, 0x22, 0x80, 0x89, 0x00, 0x82, 0xEF, 0xBB, 0x8A, 0x11, 0x44, 0xA8, 0x9B, 0x32,
+    0x11, 0x18, 0x41, 0x37, 0x11, 0xA8, 0xDD, 0x0A, 0x22, 0x02, 0xDD, 0xA9, 0x89, 0x20, 0x73, 0x23,
+    0x81, 0xA9, 0xAB, 0xBC, 0xAB, 0x08, 0x72, 0x16, 0x00, 0x00, 0x80, 0x8A, 0x81, 0x01, 0xE0, 0x9C,
+    0x22, 0x12, 0xBA, 0xAB, 0x89, 0x10, 0x11, 0xFD, 0x0A, 0x24, 0x12, 0x51, 0x12, 0x02, 0x80, 0xCC	}
+	},
+  {16081, 72, 0, {
+    0xBF, 0x89, 0x22, 0x43, 0xA1, 0xCD, 0x9A, 0x20, 0x31, 0x13, 0x11, 0xB1, 0xBF, 0x09, 0x18, 0x01,
+    0x20, 0x90, 0xC8, 0x2A, 0x62, 0x36, 0x82, 0xBA, 0x0A, 0xB8, 0xAB, 0x72, 0x27, 0x88, 0x89, 0xBA,
+    0x99, 0x19, 0x22, 0x11, 0x81, 0x91, 0x0A, 0x53, 0x01, 0xA0, 0xAC, 0xFB, 0xAB, 0x80, 0x28, 0xA9,
+    0x9E, 0x18, 0x00, 0x72, 0x05, 0x21, 0x81, 0xA8, 0xEA, 0xBD, 0x8A, 0x30, 0x25, 0x21, 0x22, 0xA8	}
+	},
+  {4725, 63, 0, {
+    0x9B, 0x08, 0xB0, 0xEF, 0x88, 0x11, 0x32, 0x21, 0xA0, 0x60, 0x01, 0xDA, 0x8B, 0x64, 0x23, 0x23,
+    0xD8, 0xCE, 0x9B, 0x21, 0x11, 0x01, 0x99, 0xAB, 0x9B, 0x38, 0x55, 0x26, 0xA8, 0x9A, 0x00, 0x10,
+    0x30, 0x02, 0xBF, 0xAC, 0x08, 0x42, 0x15, 0xA8, 0x9B, 0x10, 0x99, 0x20, 0x67, 0x01, 0x88, 0x89,
+    0xA9, 0xDD, 0x99, 0x10, 0x12, 0x01, 0x39, 0x12, 0x88, 0x73, 0x33, 0x81, 0x99, 0x00, 0x11, 0xFD	}
+	},
+  {9887, 74, 0, {
+    0xBD, 0x8A, 0x10, 0x52, 0xA0, 0xAB, 0x22, 0x22, 0x08, 0x32, 0x67, 0x01, 0x98, 0xEA, 0x8A, 0x22,
+    0x02, 0xFB, 0xAA, 0x89, 0x10, 0x63, 0x24, 0x01, 0xA9, 0xAA, 0xAC, 0xAB, 0x09, 0x51, 0x37, 0x08,
+    0x01, 0x08, 0xA9, 0x01, 0x10, 0xC8, 0x9F, 0x30, 0x21, 0xB9, 0xAB, 0x89, 0x18, 0x11, 0xFB, 0x0E,
+    0x32, 0x12, 0x41, 0x14, 0x12, 0x80, 0xDB, 0xBF, 0x8A, 0x21, 0x53, 0x91, 0xCC, 0x9B, 0x00, 0x42	}
+	},
+  {-10105, 77, 0, {
+    0x22, 0x10, 0xA1, 0xBE, 0x09, 0x08, 0x02, 0x28, 0x80, 0xC9, 0x1B, 0x63, 0x37, 0x02, 0xBA, 0x8A,
+    0xB8, 0xBB, 0x70, 0x27, 0x01, 0x98, 0xAA, 0xAA, 0x8A, 0x12, 0x01, 0x88, 0x80, 0x08, 0x88, 0x80,
+    0x18, 0x88, 0x09, 0x80, 0x0B, 0x00, 0x9E, 0x90, 0x80, 0xAA, 0x12, 0xF3, 0x1C, 0xB0, 0x08, 0x48,
+    0x0C, 0xB8, 0x01, 0xA8, 0x9F, 0x84, 0x09, 0x29, 0x2A, 0x2A, 0x94, 0x14, 0xA0, 0xF8, 0xFF, 0x89	}
+	},
+  {-9522, 63, 0, {
+    0x57, 0x91, 0xBB, 0x9A, 0x10, 0x74, 0x24, 0x81, 0xE9, 0x9B, 0x10, 0x98, 0x99, 0x88, 0x98, 0x99,
+    0x41, 0x67, 0x02, 0x88, 0x80, 0xB8, 0xBB, 0x99, 0x98, 0x89, 0x46, 0x88, 0x9A, 0x18, 0x32, 0x35,
+    0x25, 0x12, 0x91, 0xFB, 0xCD, 0x99, 0x00, 0x12, 0x21, 0x88, 0x98, 0x80, 0x00, 0x01, 0x11, 0x01,
+    0xC0, 0xFF, 0x08, 0x31, 0x33, 0x33, 0x02, 0x00, 0x98, 0xEA, 0xDD, 0x9F, 0x08, 0x21, 0x13, 0xAA	}
+	},
+  {-11804, 74, 0, {
+    0x9B, 0x08, 0x11, 0x00, 0xA9, 0x73, 0x06, 0x09, 0x52, 0x81, 0xAA, 0x9B, 0x88, 0x00, 0xC9, 0x9B,
+    0x76, 0x02, 0x99, 0x00, 0x9A, 0x11, 0x18, 0x25, 0x88, 0xC0, 0xBD, 0xAB, 0x89, 0x01, 0x11, 0x09,
+    0x43, 0x37, 0x08, 0x8A, 0x89, 0x90, 0x08, 0x1C, 0x27, 0x88, 0x88, 0x89, 0x80, 0x00, 0x08, 0x18,
+    0x09, 0x1A, 0x11, 0xA0, 0xA0, 0xFB, 0x8C, 0x57, 0x80, 0x8A, 0x0A, 0x8C, 0x03, 0x90, 0xA1, 0x80	}
+	},
+  {-1974, 52, 0, {
+    0xFB, 0x8F, 0x27, 0x11, 0xA8, 0xAA, 0x89, 0x88, 0x18, 0x80, 0x10, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0x98, 0xF1, 0xFF, 0x4D, 0x12, 0x80, 0x80, 0x63, 0x22, 0x81, 0xEB, 0xCA, 0x8A, 0x89, 0x42, 0x01,
+    0x81, 0xEB, 0x9A, 0xA9, 0x08, 0x33, 0x65, 0x25, 0x98, 0x9A, 0x8A, 0x09, 0x00, 0x00, 0xD0, 0x19,
+    0x01, 0x72, 0x16, 0xA8, 0x89, 0x98, 0x32, 0x81, 0x91, 0xCF, 0xB9, 0x88, 0x00, 0x10, 0x10, 0x01	}
+	},
+  {-6307, 63, 0, {
+    0x80, 0xCE, 0x0A, 0x61, 0x25, 0x01, 0x12, 0x01, 0x98, 0xCC, 0xDA, 0xAC, 0x8A, 0x18, 0x42, 0x14,
+    0xA0, 0x19, 0x27, 0x90, 0x98, 0x11, 0x92, 0xDE, 0x8A, 0x10, 0x24, 0x80, 0xAA, 0x9A, 0x99, 0x09,
+    0x71, 0x37, 0x12, 0x90, 0xB9, 0xBC, 0x89, 0x30, 0x92, 0xAB, 0x8B, 0x08, 0x10, 0x12, 0x21, 0x30,
+    0x18, 0xB4, 0xFF, 0x8E, 0x11, 0x33, 0x33, 0x43, 0x23, 0x91, 0xFA, 0x9F, 0x09, 0x11, 0xA0, 0xDB	}
+	},
+  {-16453, 76, 0, {
+    0xA9, 0x18, 0x41, 0x43, 0x81, 0x09, 0xC9, 0xA9, 0x09, 0xA8, 0x73, 0x14, 0x80, 0x80, 0x88, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x90, 0x08, 0x0C, 0x8A, 0x0A, 0xED, 0xFF, 0x0A, 0x11, 0x24, 0x45,
+    0x11, 0x80, 0xCA, 0xCC, 0x09, 0x32, 0x04, 0xC9, 0xAD, 0x9A, 0x80, 0x28, 0x55, 0x22, 0xA0, 0xA8,
+    0xBA, 0x99, 0x80, 0x01, 0x19, 0x88, 0x40, 0x77, 0x81, 0x08, 0x10, 0x81, 0xD9, 0x9B, 0x00, 0x00	}
+	},
+  {2057, 69, 0, {
+    0x02, 0xBA, 0xAB, 0x09, 0x20, 0x20, 0x02, 0x49, 0x84, 0xFA, 0x40, 0x21, 0x88, 0x89, 0x51, 0x32,
+    0x84, 0xEB, 0xAA, 0x8B, 0xA8, 0x51, 0x82, 0x81, 0xBC, 0xAC, 0xAF, 0x11, 0x92, 0x62, 0x24, 0x90,
+    0x38, 0x81, 0x91, 0xDD, 0x9B, 0x90, 0x31, 0xA8, 0x30, 0x07, 0xA9, 0x2A, 0x62, 0x36, 0x91, 0x98,
+    0xDC, 0xAA, 0xAA, 0x08, 0x10, 0x34, 0x03, 0xA9, 0x8B, 0x09, 0x53, 0x37, 0x12, 0x32, 0x88, 0x98	}
+	},
+  {16085, 62, 0, {
+    0x9F, 0xBA, 0xAE, 0x9A, 0x09, 0x42, 0x24, 0x98, 0x19, 0x45, 0x91, 0x98, 0x28, 0x82, 0xFD, 0x8B,
+    0x18, 0x43, 0x91, 0x98, 0x9B, 0x9A, 0x0B, 0x72, 0x37, 0x11, 0x98, 0x98, 0xBC, 0xA9, 0x31, 0x93,
+    0xAB, 0x9B, 0x09, 0x11, 0x22, 0x11, 0x31, 0x28, 0x94, 0xFF, 0x9F, 0x11, 0x32, 0x24, 0x32, 0x33,
+    0x81, 0xFB, 0x9F, 0x09, 0x11, 0xA0, 0xDA, 0x9A, 0x09, 0x32, 0x35, 0x82, 0x89, 0xC8, 0xAA, 0x89	}
+	},
+  {-15395, 66, 0, {
+    0xB0, 0x72, 0x15, 0x00, 0x88, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x90, 0x91, 0x08, 0x8B, 0x9A,
+    0x1A, 0xED, 0xFF, 0x9B, 0x21, 0x44, 0x44, 0x12, 0x91, 0xC9, 0xBD, 0x8B, 0x53, 0x22, 0xC9, 0xBD,
+    0x8A, 0x08, 0x08, 0x55, 0x23, 0x90, 0xA9, 0xAA, 0x9B, 0x08, 0x01, 0x09, 0x88, 0x40, 0x77, 0x82,
+    0x80, 0x00, 0x01, 0xB8, 0x9F, 0x08, 0x00, 0x12, 0xBA, 0xBA, 0x09, 0x18, 0x21, 0x11, 0x28, 0x16	}
+	},
+  {2479, 62, 0, {
+    0xA0, 0x30, 0x12, 0xA9, 0xAA, 0x98, 0x90, 0x10, 0x98, 0x28, 0x5A, 0xAB, 0x80, 0x80, 0xBE, 0x0A,
+    0xD8, 0xFF, 0x6B, 0xB0, 0x3A, 0x03, 0x8A, 0x76, 0x16, 0x81, 0xDB, 0x9B, 0x88, 0x23, 0xB8, 0x98,
+    0xBB, 0x9B, 0x43, 0x75, 0x25, 0x81, 0x99, 0xCA, 0x9A, 0x9B, 0x89, 0x20, 0x62, 0x05, 0xAA, 0x38,
+    0x11, 0x92, 0x91, 0x40, 0x03, 0xBF, 0x18, 0x08, 0x12, 0x99, 0xAA, 0x80, 0x80, 0x12, 0x00, 0x38	}
+	},
+  {3319, 53, 0, {
+    0x20, 0x0A, 0x99, 0x91, 0xD8, 0x98, 0xF9, 0xDB, 0xBF, 0x32, 0x67, 0x00, 0x9A, 0x99, 0x31, 0xA1,
+    0xBD, 0x9A, 0x09, 0x08, 0x18, 0x16, 0x80, 0x80, 0x18, 0x09, 0x81, 0x81, 0x38, 0x90, 0x84, 0x91,
+    0x11, 0x19, 0x29, 0x27, 0xEF, 0x23, 0xDD, 0x8B, 0x65, 0x01, 0x10, 0x90, 0xCC, 0x8A, 0x18, 0x64,
+    0x22, 0x90, 0xDA, 0x9C, 0x99, 0x20, 0x13, 0x21, 0xA8, 0xBA, 0x31, 0x93, 0xBD, 0x8A, 0x98, 0xC8	}
+	},
+  {-17388, 63, 0, {
+    0x8A, 0x72, 0x74, 0x23, 0x13, 0x08, 0x08, 0x08, 0xB8, 0xEF, 0xBA, 0x0B, 0x43, 0x13, 0xB8, 0xAB,
+    0xAA, 0x9A, 0x08, 0x21, 0x54, 0x13, 0x52, 0x25, 0x82, 0xC9, 0xAB, 0x38, 0x37, 0x01, 0xDB, 0xAD,
+    0x9B, 0x20, 0x54, 0x22, 0xA8, 0x9C, 0xA9, 0x99, 0x89, 0x20, 0x65, 0x83, 0x88, 0x11, 0xA1, 0xAB,
+    0xEA, 0x8A, 0x88, 0x28, 0x56, 0x12, 0x80, 0x88, 0xCA, 0xAB, 0x8A, 0x73, 0x25, 0x00, 0xB8, 0xDB	}
+	},
+  {-1049, 79, 0, {
+    0xBB, 0x18, 0x43, 0x13, 0x89, 0x00, 0xD9, 0xAD, 0x10, 0x20, 0x14, 0xC8, 0x18, 0x91, 0x8A, 0x65,
+    0x13, 0x98, 0xBB, 0x08, 0xBB, 0x50, 0x34, 0xA1, 0x9D, 0x8A, 0x89, 0x88, 0x10, 0x01, 0xFA, 0x38,
+    0x83, 0x71, 0x14, 0xB9, 0x19, 0xC8, 0xBB, 0x19, 0x27, 0x31, 0x13, 0xB0, 0xDF, 0x89, 0x11, 0x23,
+    0xA0, 0xA9, 0xDD, 0x89, 0x42, 0x13, 0xA8, 0xCB, 0x19, 0xA0, 0x99, 0x73, 0x34, 0x01, 0x09, 0x20	}
+	},
+  {17798, 70, 0, {
+    0x11, 0xD9, 0xAD, 0xDB, 0x9A, 0x28, 0x35, 0x25, 0x80, 0x88, 0x10, 0xEA, 0xAB, 0x88, 0x63, 0x14,
+    0x98, 0xA9, 0xBA, 0x89, 0x45, 0x22, 0xB8, 0xAE, 0x09, 0x11, 0x80, 0xAC, 0x89, 0x88, 0x21, 0x43,
+    0x73, 0x23, 0x88, 0x08, 0x22, 0x12, 0xF9, 0xBF, 0x8A, 0x41, 0x01, 0x82, 0xCB, 0x9B, 0x11, 0x31,
+    0x16, 0x10, 0x01, 0xA8, 0xCB, 0xBE, 0x9A, 0x18, 0x73, 0x03, 0x89, 0x32, 0x90, 0x2A, 0x24, 0x10	}
+	},
+  {20402, 67, 0, {
+    0x99, 0xBC, 0xFB, 0xAA, 0x2A, 0x15, 0x08, 0x21, 0xB2, 0xBD, 0x2B, 0x82, 0xAC, 0x5A, 0x25, 0x33,
+    0x13, 0xC0, 0xDB, 0x99, 0x10, 0x37, 0x01, 0xB9, 0xCF, 0x98, 0x08, 0x12, 0x11, 0xB8, 0x9D, 0x20,
+    0x21, 0x03, 0x09, 0xB8, 0xDA, 0x8C, 0x11, 0x73, 0x26, 0x08, 0x08, 0xCA, 0x9B, 0x28, 0x35, 0x02,
+    0xCA, 0x89, 0xB8, 0x8D, 0x12, 0x12, 0x89, 0x32, 0x25, 0xA9, 0x3B, 0x37, 0x22, 0x01, 0xB9, 0xFC	}
+	},
+  {10942, 74, 0, {
+    0xAA, 0x8C, 0x99, 0x0B, 0x21, 0xB0, 0x9A, 0x47, 0x31, 0x22, 0x24, 0xA8, 0xC8, 0xBC, 0xBD, 0x19,
+    0x11, 0x64, 0x23, 0xA9, 0xCB, 0x09, 0x11, 0xB1, 0xAF, 0x9A, 0x19, 0x52, 0x34, 0x23, 0x02, 0x98,
+    0xBB, 0xBB, 0x41, 0xC1, 0xDB, 0xAA, 0xCB, 0x39, 0x57, 0x11, 0x98, 0x89, 0x10, 0xA2, 0xBD, 0x9B,
+    0x72, 0x12, 0x08, 0x91, 0xA9, 0xAD, 0x98, 0x38, 0x15, 0x91, 0x89, 0x2A, 0xB1, 0xCF, 0x9A, 0x51	}
+	},
+  {-13518, 74, 0, {
+    0x35, 0x81, 0x10, 0xC8, 0x09, 0x21, 0xA0, 0xDE, 0xAB, 0x18, 0x63, 0x12, 0x10, 0xA8, 0xA9, 0x00,
+    0xBA, 0x98, 0x9A, 0x73, 0x27, 0x90, 0x98, 0xAB, 0x0A, 0x55, 0x02, 0xA9, 0xAC, 0x99, 0x09, 0x73,
+    0x23, 0xA0, 0xAC, 0x99, 0xBC, 0x9A, 0x41, 0x37, 0x01, 0x09, 0x88, 0x88, 0xB9, 0xFB, 0x9A, 0x19,
+    0x41, 0x43, 0x25, 0x80, 0x19, 0x08, 0x98, 0xBA, 0x8B, 0xA8, 0x78, 0x14, 0xBA, 0xCD, 0x89, 0x09	}
+	},
+  {-16595, 71, 0, {
+    0x01, 0x21, 0x82, 0x12, 0x13, 0x61, 0x23, 0xDE, 0xAC, 0x28, 0x25, 0x08, 0x89, 0xB8, 0xAA, 0x38,
+    0x45, 0x34, 0xB8, 0x9B, 0xC0, 0x8B, 0x12, 0x32, 0x90, 0x30, 0x92, 0xFF, 0x8D, 0x31, 0x23, 0x00,
+    0x99, 0x21, 0xB1, 0x9E, 0x99, 0x19, 0x45, 0xA0, 0x9B, 0x80, 0x99, 0x62, 0x35, 0x88, 0x88, 0x80,
+    0xCC, 0x09, 0x12, 0x35, 0x80, 0xAA, 0xFB, 0x98, 0x88, 0xC8, 0xAE, 0x9A, 0x08, 0x20, 0x55, 0x23	}
+	},
+  {3696, 74, 0, {
+    0x13, 0x10, 0x88, 0x80, 0xCA, 0xDE, 0xAB, 0x19, 0x52, 0x24, 0x82, 0xB9, 0x8A, 0x11, 0x98, 0xAE,
+    0x0A, 0x80, 0x30, 0x37, 0x23, 0x01, 0xAB, 0xCC, 0x9B, 0x20, 0x02, 0x12, 0x90, 0xBF, 0x28, 0x36,
+    0x81, 0xC9, 0x18, 0x41, 0xA2, 0xCD, 0xAB, 0x48, 0x15, 0x10, 0x81, 0xA9, 0xAC, 0xA9, 0x1A, 0x24,
+    0x01, 0x01, 0x2A, 0xC2, 0xCF, 0xAA, 0x41, 0x36, 0x81, 0x10, 0xB0, 0x0B, 0x42, 0x91, 0xDE, 0x9C	}
+	},
+  {-23460, 78, 0, {
+    0x19, 0x42, 0x13, 0x10, 0x98, 0xAB, 0x10, 0xCA, 0x99, 0x99, 0x71, 0x17, 0x80, 0x88, 0xAB, 0x8A,
+    0x54, 0x03, 0xB8, 0xAC, 0x99, 0x8A, 0x73, 0x14, 0x91, 0x9C, 0x8A, 0xBB, 0xAA, 0x40, 0x47, 0x01,
+    0x09, 0x88, 0x88, 0xA8, 0xEA, 0x9B, 0x08, 0x31, 0x35, 0x35, 0x80, 0x08, 0x08, 0x98, 0xBA, 0x8C,
+    0xA8, 0x58, 0x25, 0xC9, 0xEB, 0x89, 0x89, 0x02, 0x20, 0x82, 0x12, 0x13, 0x31, 0x25, 0xFD, 0xAC	}
+	},
+  {-22156, 77, 0, {
+    0x18, 0x25, 0x80, 0x98, 0xB9, 0xAA, 0x41, 0x54, 0x22, 0xA8, 0x9A, 0xA8, 0x8C, 0x03, 0x21, 0xA1,
+    0x28, 0x84, 0xFD, 0x9C, 0x41, 0x23, 0x98, 0xA9, 0x21, 0x83, 0xBB, 0xC9, 0x9E, 0x43, 0x82, 0xBB,
+    0x10, 0x10, 0x50, 0x27, 0x81, 0x90, 0xA9, 0xEB, 0x1A, 0x08, 0x51, 0x00, 0xAA, 0xBB, 0x28, 0x14,
+    0xF0, 0xAE, 0x99, 0x80, 0x18, 0x53, 0x26, 0x02, 0x88, 0x80, 0x21, 0x92, 0xED, 0xAC, 0x99, 0x20	}
+	},
+  {-24011, 76, 0, {
+    0x43, 0x24, 0xA0, 0x8A, 0x01, 0x99, 0x99, 0x2A, 0x15, 0x9A, 0x51, 0x22, 0xF9, 0x9B, 0xCA, 0xAA,
+    0x89, 0x72, 0x35, 0x02, 0x89, 0x00, 0x81, 0xFB, 0xAA, 0x20, 0x25, 0x92, 0xBA, 0xBD, 0x89, 0x31,
+    0x44, 0x83, 0x99, 0x88, 0xDA, 0xAD, 0x09, 0x40, 0x34, 0x81, 0x89, 0x9A, 0x9A, 0x42, 0x92, 0xBD,
+    0x2B, 0x24, 0x22, 0x27, 0x80, 0x98, 0xAA, 0x29, 0x14, 0xCA, 0xD9, 0xAC, 0x28, 0x14, 0xCA, 0xAB	}
+	},
+  {-24137, 71, 0, {
+    0x09, 0x21, 0x43, 0x43, 0x56, 0x81, 0xA8, 0x98, 0x10, 0xC8, 0xAB, 0xAB, 0x41, 0xA1, 0xAD, 0x19,
+    0x44, 0x14, 0x99, 0x48, 0x24, 0xC8, 0xDA, 0xBB, 0x08, 0x31, 0x14, 0x31, 0x35, 0xB0, 0xAC, 0x09,
+    0x23, 0xE9, 0xAC, 0x48, 0x34, 0x98, 0x99, 0xAA, 0x40, 0x05, 0x88, 0xA8, 0x18, 0x11, 0x18, 0xEB,
+    0x0B, 0x81, 0x19, 0x15, 0x30, 0x27, 0x91, 0xCF, 0xA9, 0x89, 0x01, 0x51, 0x33, 0x01, 0xA9, 0xCB	}
+	},
+  {-2517, 71, 0, {
+    0xCD, 0x8A, 0x08, 0x21, 0x53, 0x12, 0x43, 0x02, 0x98, 0x12, 0x21, 0xA8, 0xFF, 0x89, 0x80, 0x10,
+    0xA8, 0xCB, 0x89, 0x10, 0x63, 0x98, 0x51, 0x12, 0xB9, 0xA9, 0x8B, 0xA0, 0x31, 0x27, 0xA2, 0x9D,
+    0x10, 0x12, 0x80, 0xEC, 0x89, 0x08, 0x38, 0x26, 0xA8, 0x48, 0x06, 0x98, 0x10, 0x98, 0x30, 0x33,
+    0xE1, 0xBF, 0x8A, 0x18, 0x54, 0x02, 0xA9, 0xBC, 0x98, 0x20, 0x82, 0xBA, 0x9C, 0x88, 0x31, 0x36	}
+	},
+  {-6034, 70, 0, {
+    0x13, 0xB9, 0x8C, 0x53, 0x23, 0x01, 0x99, 0xBE, 0xAC, 0x08, 0x56, 0x23, 0x98, 0xBC, 0x9A, 0x01,
+    0x9A, 0x88, 0x38, 0x57, 0x90, 0x8A, 0x9A, 0x39, 0x26, 0x21, 0x81, 0xAB, 0x0A, 0x98, 0xBF, 0xDB,
+    0x88, 0x21, 0x36, 0x01, 0x89, 0x13, 0x98, 0x89, 0x48, 0x17, 0x02, 0xC8, 0xCE, 0xAA, 0x21, 0x23,
+    0xB0, 0xAE, 0x09, 0x11, 0x28, 0x14, 0x21, 0x21, 0xD9, 0x9A, 0xDB, 0x39, 0x35, 0x22, 0x98, 0xBD	}
+	},
+  {-7284, 72, 0, {
+    0x08, 0x21, 0x01, 0xF9, 0x9C, 0x32, 0x93, 0x28, 0x04, 0x99, 0x70, 0x02, 0xAA, 0x9A, 0x18, 0x52,
+    0x24, 0x01, 0xDA, 0xCC, 0x9A, 0x30, 0x35, 0x81, 0xEC, 0xAA, 0x0A, 0x88, 0x00, 0x22, 0x42, 0x01,
+    0x13, 0x44, 0x13, 0xFA, 0x9B, 0x9A, 0x11, 0x01, 0x53, 0x21, 0x22, 0x82, 0xEB, 0x48, 0x23, 0xC0,
+    0xBF, 0x0B, 0x42, 0x82, 0x80, 0xCA, 0x19, 0x12, 0xEA, 0x9A, 0x30, 0x15, 0x21, 0x34, 0x22, 0x91	}
+	},
+  {29944, 68, 0, {
+    0xEC, 0xBC, 0x9C, 0x20, 0x32, 0x34, 0x81, 0xCC, 0x09, 0x80, 0x99, 0xBB, 0x58, 0x35, 0x90, 0x19,
+    0x80, 0x99, 0x31, 0x23, 0xF0, 0xAE, 0x19, 0x23, 0x01, 0xD0, 0xBB, 0x1A, 0x12, 0x02, 0xA9, 0x69,
+    0x26, 0x01, 0x31, 0x23, 0x81, 0xCA, 0xCF, 0x8A, 0x10, 0x10, 0x80, 0xC0, 0x8B, 0x53, 0x82, 0xDD,
+    0x8A, 0x28, 0x32, 0x92, 0x2A, 0x04, 0xCB, 0x50, 0x34, 0x82, 0xAD, 0xB9, 0x89, 0x90, 0x98, 0x9B	}
+	},
+  {-16974, 62, 0, {
+    0x76, 0x02, 0x08, 0x10, 0x88, 0x62, 0x11, 0xB9, 0xAD, 0x20, 0x81, 0x92, 0xAA, 0xFA, 0xBC, 0x00,
+    0x30, 0x44, 0x90, 0xAA, 0x30, 0x14, 0xA8, 0x09, 0x91, 0x73, 0x85, 0xB9, 0xBD, 0xAC, 0x19, 0x45,
+    0x23, 0x90, 0x9A, 0x99, 0xBC, 0xBB, 0x70, 0x34, 0x83, 0x99, 0xBA, 0x0A, 0x10, 0xB0, 0xCF, 0x89,
+    0x21, 0x14, 0x73, 0x02, 0x80, 0x88, 0xA9, 0xB0, 0xBC, 0x18, 0x01, 0x33, 0x02, 0xFA, 0xAD, 0x99	}
+	},
+  {-13757, 69, 0, {
+    0x99, 0xAA, 0x58, 0x47, 0x01, 0x88, 0x12, 0x80, 0x9A, 0xCB, 0x0B, 0x11, 0x83, 0xAB, 0x21, 0xB9,
+    0x72, 0x37, 0xB9, 0xCC, 0x19, 0x21, 0x91, 0xBC, 0xBC, 0x99, 0x42, 0x36, 0x21, 0x90, 0x00, 0x10,
+    0x20, 0x14, 0xBB, 0xAF, 0xAA, 0x9A, 0x38, 0x36, 0x32, 0x52, 0xB1, 0x08, 0xFA, 0xCB, 0x9A, 0x40,
+    0x13, 0x11, 0x89, 0x90, 0x08, 0x60, 0x35, 0x83, 0xCD, 0xAB, 0x8A, 0x10, 0x21, 0x93, 0xAC, 0x43	}
+	},
+  {-1462, 66, 0, {
+    0xB1, 0x8A, 0x1A, 0x78, 0x15, 0xB8, 0x18, 0x20, 0x98, 0x52, 0x91, 0x88, 0xCE, 0x9B, 0x18, 0x24,
+    0x83, 0x9A, 0x9D, 0x20, 0x90, 0xBE, 0x19, 0x47, 0x01, 0x00, 0x01, 0x98, 0x9C, 0xCC, 0x8A, 0x22,
+    0x03, 0x21, 0x03, 0xCB, 0x32, 0xB1, 0xFF, 0x9C, 0x20, 0x33, 0x03, 0x08, 0x90, 0xCB, 0x48, 0x25,
+    0x81, 0xAD, 0x8A, 0x88, 0x90, 0xA0, 0xBC, 0x71, 0x14, 0x00, 0x01, 0x80, 0x52, 0x02, 0xB8, 0xBE	}
+	},
+  {1783, 70, 0, {
+    0x18, 0x00, 0x02, 0x99, 0xB8, 0xDF, 0x89, 0x10, 0x52, 0x90, 0x9A, 0x31, 0x24, 0xA8, 0x89, 0xA1,
+    0x71, 0x04, 0xBA, 0xCD, 0xAB, 0x18, 0x54, 0x25, 0x88, 0x99, 0x99, 0xCA, 0x9B, 0x48, 0x36, 0x02,
+    0x99, 0xB9, 0x9A, 0x11, 0x90, 0xBF, 0x8B, 0x30, 0x25, 0x63, 0x23, 0x90, 0x88, 0xB9, 0xA8, 0xBE,
+    0x29, 0x00, 0x32, 0x12, 0xCA, 0xBF, 0x9A, 0x9A, 0xA9, 0x5A, 0x47, 0x02, 0x88, 0x22, 0x08, 0x9A	}
+	},
+  {9477, 67, 0, {
+    0xDB, 0x9A, 0x11, 0x03, 0xCA, 0x11, 0xA8, 0x70, 0x16, 0xA8, 0xDB, 0x09, 0x21, 0x81, 0xBC, 0xBC,
+    0x99, 0x41, 0x35, 0x23, 0x91, 0x08, 0x01, 0x20, 0x24, 0xDB, 0xAD, 0xAA, 0xAB, 0x29, 0x47, 0x23,
+    0x21, 0xA1, 0x89, 0xD9, 0xBE, 0xAB, 0x58, 0x33, 0x11, 0x9A, 0x98, 0x9A, 0x6A, 0x35, 0x13, 0xDA,
+    0xAA, 0xAB, 0x98, 0x08, 0x91, 0x1B, 0x47, 0x91, 0x0A, 0x10, 0x41, 0x13, 0xCC, 0x08, 0x41, 0x90	}
+	},
+  {4027, 65, 0, {
+    0x32, 0xC2, 0x8A, 0xC2, 0xBE, 0x9B, 0x43, 0x24, 0x11, 0xBA, 0x19, 0xC8, 0xAF, 0x0A, 0x44, 0x13,
+    0x88, 0xBA, 0xAA, 0xBB, 0xCC, 0x8A, 0x54, 0x13, 0x21, 0x44, 0x90, 0x88, 0xD9, 0xBD, 0x8A, 0x30,
+    0x36, 0x33, 0x91, 0xD9, 0x8A, 0x08, 0x23, 0xAA, 0xCD, 0x1A, 0x14, 0x80, 0xB0, 0xCC, 0x1B, 0x33,
+    0x34, 0x02, 0x22, 0x11, 0x39, 0xD1, 0xAF, 0xAA, 0x0B, 0x03, 0x52, 0x35, 0xA3, 0xCE, 0x88, 0x09	}
+	},
+  {-7099, 70, 0, {
+    0xA9, 0x1A, 0x45, 0x23, 0x99, 0x89, 0xBB, 0x08, 0xC0, 0xBE, 0x09, 0x51, 0x33, 0x35, 0x13, 0x18,
+    0x00, 0xC9, 0xCB, 0x9C, 0x82, 0x80, 0xB9, 0x9A, 0xCF, 0x8B, 0x31, 0x33, 0x83, 0x28, 0x47, 0x88,
+    0x88, 0xB9, 0xBC, 0x9A, 0xBA, 0x10, 0x76, 0x13, 0x20, 0x14, 0xA8, 0x08, 0xDB, 0x9A, 0x8B, 0x43,
+    0x24, 0xC9, 0x9C, 0xCB, 0x9B, 0x22, 0x25, 0x22, 0x08, 0x01, 0x02, 0x24, 0xD9, 0x8C, 0x18, 0x92	}
+	},
+  {1725, 61, 0, {
+    0xCD, 0x9A, 0x30, 0x36, 0x12, 0xA9, 0x38, 0x05, 0xFB, 0xBB, 0x18, 0x35, 0x81, 0x88, 0xBC, 0x09,
+    0x02, 0x89, 0xBD, 0x39, 0x27, 0x18, 0x32, 0x22, 0xA0, 0xCB, 0xBF, 0xBA, 0x8A, 0x61, 0x35, 0x82,
+    0x09, 0x11, 0xCA, 0xA9, 0x20, 0x13, 0x99, 0x00, 0x98, 0xCF, 0x8A, 0xA1, 0x19, 0x88, 0x90, 0x83,
+    0x61, 0x63, 0x21, 0x14, 0x88, 0x00, 0xA8, 0xFB, 0xAF, 0x9A, 0x31, 0x24, 0x80, 0xAA, 0x01, 0x08	}
+	},
+  {-3303, 61, 0, {
+    0x09, 0xB8, 0x09, 0x77, 0x80, 0x89, 0x30, 0x93, 0x08, 0xA0, 0xBD, 0xBA, 0xAB, 0x39, 0x77, 0x03,
+    0xBA, 0xBB, 0x11, 0x33, 0xA0, 0x9B, 0x9D, 0x21, 0x13, 0x11, 0x91, 0xCE, 0x8A, 0x56, 0x13, 0x99,
+    0xBA, 0xCB, 0x8B, 0x10, 0x57, 0x33, 0xA1, 0xAA, 0xBC, 0x08, 0xA9, 0xAA, 0x9D, 0x62, 0x13, 0x89,
+    0x20, 0x33, 0x82, 0x48, 0x24, 0xC1, 0xBE, 0xAB, 0x9D, 0x08, 0x42, 0x80, 0x20, 0x13, 0xCA, 0x8A	}
+	},
+  {-3655, 60, 0, {
+    0x01, 0x11, 0xCA, 0x0A, 0x77, 0x02, 0x9B, 0xA9, 0x8B, 0x52, 0x03, 0xA9, 0xCD, 0x89, 0x12, 0x34,
+    0xA1, 0x98, 0x8A, 0xA9, 0x9D, 0x79, 0x34, 0x01, 0x98, 0xB9, 0x9C, 0xBB, 0x00, 0xC9, 0x28, 0x43,
+    0x00, 0x38, 0x37, 0x14, 0x98, 0x2B, 0x63, 0x93, 0x9A, 0xDC, 0x9B, 0x18, 0x02, 0x9B, 0x90, 0xA9,
+    0x73, 0x17, 0x08, 0x88, 0x01, 0x0A, 0xA8, 0x8B, 0xFB, 0x09, 0x53, 0x01, 0xC0, 0xAA, 0xAA, 0xA8	}
+	},
+  {-8468, 57, 0, {
+    0x4A, 0x23, 0x46, 0x22, 0x90, 0x82, 0xBA, 0xBA, 0x40, 0x77, 0x00, 0x08, 0xDA, 0xCB, 0x08, 0x22,
+    0x12, 0xD8, 0x8B, 0x88, 0x9A, 0x22, 0x54, 0x23, 0xA1, 0x9B, 0xA8, 0x9B, 0x02, 0x8C, 0x8D, 0x80,
+    0x52, 0x72, 0x02, 0x90, 0x9A, 0x80, 0x24, 0xCA, 0xAB, 0x8A, 0x64, 0x11, 0x82, 0x0A, 0xB8, 0x9E,
+    0x8A, 0x35, 0x14, 0x90, 0xCD, 0xAC, 0x99, 0x39, 0x32, 0x35, 0x12, 0xAA, 0x88, 0x08, 0xDC, 0xB9	}
+	},
+  {-8878, 61, 0, {
+    0x8B, 0x20, 0x35, 0x35, 0x52, 0x11, 0x98, 0x20, 0xA3, 0x89, 0xDF, 0x99, 0x8A, 0x21, 0x13, 0xB8,
+    0xAF, 0x88, 0xA9, 0x88, 0x31, 0x57, 0x02, 0x88, 0x20, 0x11, 0xDA, 0xCB, 0x9B, 0x20, 0x22, 0x91,
+    0x41, 0x81, 0x88, 0x72, 0x04, 0xA0, 0xAA, 0xA8, 0xAD, 0x9D, 0x98, 0x01, 0x34, 0x90, 0x0B, 0x22,
+    0x00, 0x12, 0x37, 0x35, 0x00, 0x90, 0xFB, 0xAA, 0x08, 0x82, 0xB0, 0xAE, 0x49, 0x22, 0x90, 0xDA	}
+	},
+  {-4187, 59, 0, {
+    0xA8, 0x34, 0x81, 0x8C, 0x10, 0x43, 0x08, 0x18, 0x09, 0x33, 0xE9, 0x88, 0x73, 0x05, 0xA8, 0xBC,
+    0xB9, 0x51, 0x02, 0x01, 0xCB, 0x0A, 0x12, 0xF0, 0xCB, 0x0A, 0x41, 0x32, 0x14, 0x31, 0x83, 0xDB,
+    0xB9, 0xAD, 0x88, 0x89, 0x63, 0x20, 0x12, 0x93, 0xB9, 0x1B, 0x75, 0x80, 0xB9, 0x9B, 0x88, 0xB1,
+    0x22, 0x28, 0x90, 0x9D, 0xD8, 0xB0, 0x11, 0x46, 0x00, 0x31, 0x09, 0xF8, 0x9A, 0x9B, 0x08, 0x82	}
+	},
+  {-3186, 50, 0, {
+    0x16, 0x34, 0x80, 0x8A, 0x90, 0x0B, 0x08, 0x5B, 0xD8, 0xD0, 0x08, 0x81, 0x9B, 0x41, 0x01, 0xBA,
+    0x2B, 0x86, 0x98, 0x71, 0x81, 0x18, 0x16, 0x89, 0x18, 0x32, 0xEB, 0x8C, 0x9A, 0x48, 0x11, 0xCA,
+    0x99, 0x55, 0x82, 0xA9, 0x8B, 0x43, 0x1A, 0xBD, 0x81, 0x24, 0x91, 0xA9, 0xBF, 0xA9, 0x29, 0x32,
+    0x57, 0x11, 0xB8, 0x99, 0x8A, 0xBB, 0x9C, 0x19, 0x53, 0x24, 0x24, 0x51, 0x12, 0xB9, 0x19, 0x12	}
+	},
+  {5461, 52, 0, {
+    0x11, 0xFB, 0x9E, 0x9B, 0x18, 0x13, 0x11, 0xAE, 0x89, 0xA9, 0x99, 0x20, 0x75, 0x02, 0x09, 0x40,
+    0x03, 0xB9, 0xFA, 0xAA, 0x10, 0x42, 0x80, 0x00, 0x91, 0x99, 0x71, 0x14, 0x98, 0xB9, 0x9A, 0x9D,
+    0xDB, 0x80, 0x01, 0x34, 0x88, 0x0B, 0x11, 0x90, 0x22, 0x74, 0x24, 0x20, 0x00, 0xFA, 0xAA, 0x08,
+    0x01, 0xA8, 0xAE, 0x19, 0x24, 0x90, 0xC8, 0x8A, 0x52, 0x82, 0x8D, 0x10, 0x33, 0x88, 0x00, 0x09	}
+	},
+  {17, 48, 0, {
+    0x34, 0xD8, 0x89, 0x71, 0x06, 0xA0, 0xBB, 0xBB, 0x79, 0x02, 0x01, 0xBA, 0x8A, 0x31, 0xE0, 0xBD,
+    0x0B, 0x41, 0x23, 0x24, 0x32, 0x03, 0xEA, 0xB9, 0xBC, 0x89, 0x88, 0x72, 0x11, 0x21, 0x02, 0x9B,
+    0x0C, 0x73, 0x92, 0xC8, 0x9B, 0x80, 0xB0, 0x31, 0x18, 0x91, 0x9D, 0xA8, 0xD1, 0x28, 0x54, 0x00,
+    0x31, 0x98, 0xF8, 0xA9, 0xAB, 0x90, 0x02, 0x33, 0x66, 0x18, 0x8A, 0x12, 0xA0, 0xB0, 0x0A, 0xA2	}
+	},
+  {-213, 46, 0, {
+    0xB8, 0xA2, 0x24, 0xF8, 0x0E, 0x98, 0x8C, 0x10, 0x22, 0x81, 0x70, 0x95, 0x01, 0x24, 0x9A, 0xA8,
+    0x2A, 0xF9, 0x0A, 0xAB, 0x09, 0x53, 0x91, 0x8A, 0x73, 0x81, 0xDA, 0x9B, 0x53, 0x83, 0xB8, 0xAB,
+    0x0B, 0x31, 0x62, 0x82, 0x02, 0x19, 0x8A, 0x63, 0x43, 0xD0, 0xAC, 0xAA, 0xAA, 0x88, 0x44, 0x17,
+    0x02, 0x09, 0x10, 0x80, 0xBC, 0x8D, 0x18, 0x25, 0x91, 0x99, 0xCB, 0xBC, 0x12, 0x63, 0x01, 0x88	}
+	},
+  {674, 56, 0, {
+    0x90, 0x99, 0xC1, 0xAD, 0x9D, 0x3A, 0x25, 0x81, 0x10, 0x94, 0x01, 0x28, 0x50, 0x12, 0xD8, 0xBB,
+    0x8B, 0x3C, 0x04, 0x00, 0xDC, 0x89, 0x88, 0xA1, 0x52, 0x43, 0x92, 0x8A, 0x08, 0x98, 0xDB, 0x9C,
+    0x81, 0x02, 0x02, 0x74, 0x02, 0x98, 0x90, 0x41, 0x08, 0xEA, 0x9A, 0x8E, 0x30, 0x84, 0x81, 0x08,
+    0x08, 0xA8, 0x81, 0x40, 0x09, 0x8B, 0x04, 0xA1, 0xFA, 0x9C, 0x1C, 0x14, 0x04, 0xB8, 0x38, 0x10	}
+	},
+  {-8, 48, 0, {
+    0x09, 0x58, 0x04, 0x81, 0xC9, 0x1B, 0xBF, 0x89, 0x02, 0x17, 0x18, 0x89, 0x88, 0x1A, 0x19, 0xBD,
+    0xC1, 0x21, 0x22, 0x33, 0x48, 0x81, 0xC2, 0x01, 0x08, 0x07, 0xFA, 0x89, 0x10, 0x19, 0x01, 0xB1,
+    0xFA, 0x1B, 0x09, 0x29, 0x79, 0x85, 0x98, 0xB0, 0x23, 0x1A, 0x81, 0xFC, 0xAA, 0x90, 0x42, 0x73,
+    0x12, 0xA9, 0x9A, 0x10, 0x19, 0x99, 0xEB, 0x90, 0x00, 0x33, 0x32, 0xA0, 0x02, 0x0F, 0x8D, 0x24	}
+	},
+  {137, 52, 0, {
+    0x98, 0x91, 0xD1, 0x0A, 0x43, 0x18, 0x62, 0x88, 0x0C, 0x99, 0x8A, 0xF0, 0x10, 0x84, 0x0C, 0x18,
+    0x18, 0x89, 0x10, 0x97, 0x80, 0xA1, 0x88, 0x90, 0xD2, 0x3A, 0x51, 0x19, 0x19, 0x29, 0x8C, 0x29,
+    0xCC, 0x91, 0x10, 0xB7, 0xA7, 0x89, 0x81, 0x80, 0x18, 0x1A, 0x8A, 0x23, 0x7A, 0x0A, 0x38, 0xA3,
+    0xA2, 0xD0, 0x91, 0x01, 0x2A, 0xFB, 0x39, 0x07, 0x19, 0xD9, 0x58, 0x80, 0x90, 0xC1, 0x21, 0x19	}
+	},
+  {-31, 48, 0, {
+    0x80, 0x99, 0x2A, 0x7A, 0x09, 0xA8, 0xA1, 0xA2, 0xA7, 0x8F, 0x28, 0x86, 0x88, 0x90, 0x1D, 0x03,
+    0x88, 0xF1, 0x88, 0x23, 0x09, 0x18, 0x09, 0x29, 0x08, 0x9B, 0xA1, 0x15, 0x97, 0x9A, 0xAC, 0x43,
+    0x91, 0x91, 0x91, 0xA1, 0xA2, 0x8C, 0x9F, 0x28, 0x07, 0x08, 0x08, 0x80, 0x80, 0xA9, 0xF1, 0x89,
+    0x10, 0x39, 0x06, 0x18, 0x18, 0x08, 0xC9, 0x19, 0x69, 0x81, 0xB3, 0x0A, 0xB0, 0x2D, 0xC8, 0x8B	}
+	},
+  {-1575, 43, 0, {
+    0x9C, 0x08, 0x72, 0x14, 0x90, 0x11, 0xA0, 0x80, 0x1F, 0x3A, 0x9D, 0xA2, 0x07, 0x08, 0x88, 0x98,
+    0xC1, 0x88, 0x08, 0xA1, 0x89, 0x47, 0x08, 0x10, 0x18, 0x21, 0x0A, 0x08, 0xFB, 0xC9, 0xB4, 0x08,
+    0x41, 0x19, 0x9C, 0xD4, 0x88, 0x99, 0x51, 0x48, 0x90, 0xB2, 0xA2, 0x08, 0xDA, 0x08, 0xBA, 0x10,
+    0x27, 0x30, 0x80, 0x82, 0xA0, 0x08, 0x08, 0xC8, 0xDF, 0x80, 0x07, 0x08, 0x90, 0x09, 0x19, 0x29	}
+	},
+  {-468, 45, 0, {
+    0x4A, 0xB8, 0xA2, 0xA2, 0x95, 0x58, 0xB1, 0x1C, 0x19, 0x79, 0x08, 0xA8, 0x19, 0x2A, 0x2A, 0x33,
+    0x48, 0xC0, 0xFA, 0xB1, 0x9B, 0x84, 0x62, 0x91, 0xE1, 0x29, 0x3B, 0x13, 0x2A, 0x2A, 0xFA, 0x99,
+    0x58, 0x91, 0x02, 0x01, 0xA1, 0x20, 0x3E, 0x0F, 0xB0, 0x88, 0x14, 0x18, 0x91, 0x91, 0xA1, 0x6A,
+    0x28, 0x0A, 0x08, 0x08, 0x08, 0x08, 0x9F, 0x0F, 0xB0, 0x07, 0x80, 0x91, 0x91, 0xD9, 0x81, 0x50	}
+	},
+  {-62, 51, 0, {
+    0x88, 0xC1, 0x5B, 0x18, 0x00, 0x19, 0xDA, 0x19, 0xB1, 0x23, 0x95, 0x21, 0x08, 0x8A, 0xB0, 0x8A,
+    0x80, 0xC8, 0x27, 0x2A, 0xB0, 0xB3, 0xDF, 0x42, 0x18, 0x19, 0x8D, 0x84, 0x00, 0x19, 0xA9, 0x80,
+    0x5A, 0xC0, 0x91, 0xC8, 0xB4, 0x25, 0x19, 0x5B, 0x09, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88,
+    0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80	}
+	}
+};
@@ -0,0 +1,11 @@
+#ifndef explosion1_adpcm_ADPCM_H
+#define explosion1_adpcm_ADPCM_H
+
+#include <adpcm.h>
+
+// Generated by adpcm_convert from explosion1.raw
+#define NUM_explosion1_adpcm_BLOCKS 	57
+#define explosion1_adpcm_RATE 	8000
+extern const adpcm_block explosion1_adpcm[NUM_explosion1_adpcm_BLOCKS];
+
+#endif
@@ -0,0 +1,136 @@
+#include <invaderkilled_adpcm.h>
+
+const adpcm_block invaderkilled_adpcm[NUM_invaderkilled_adpcm_BLOCKS] = {
+  {0, 0, 0, {
+    0x00, 0x00, 0x2F, 0x3F, 0x3F, 0x80, 0x80, 0x3F, 0x3F, 0x3F, 0x3B, 0x3C, 0x4B, 0x3B, 0xD0, 0xB3,
+    0xB4, 0xC3, 0xB3, 0xB4, 0xC3, 0xB3, 0xB4, 0xC3, 0x03, 0x3C, 0x3B, 0x3C, 0x4B, 0x3B, 0x3C, 0x4B,
+    0x3B, 0x3C, 0x4B, 0x8B, 0xB4, 0xB3, 0xC4, 0xB3, 0x77, 0xFF, 0x00, 0x22, 0x9B, 0x27, 0xAC, 0x06,
+    0x2E, 0xC2, 0x6A, 0xA8, 0x21, 0x0B, 0x18, 0x0B, 0xA7, 0x91, 0x80, 0x30, 0x1C, 0x8A, 0x83, 0xB9	}
+	},
+  {-9033, 73, 0, {
+    0x71, 0xBA, 0x87, 0x3B, 0xE1, 0x12, 0x0C, 0x83, 0x3C, 0xB8, 0x12, 0x1A, 0x00, 0xBB, 0x87, 0x18,
+    0xE3, 0x48, 0x8A, 0x00, 0xA9, 0x15, 0x2D, 0xB1, 0x00, 0x00, 0x90, 0x08, 0x04, 0x2F, 0x98, 0x6A,
+    0xB8, 0x84, 0x1A, 0x90, 0x01, 0x89, 0x92, 0x09, 0x15, 0x0F, 0x00, 0x98, 0x95, 0x1A, 0x00, 0x3D,
+    0xE2, 0x21, 0xAA, 0x04, 0x2B, 0x19, 0x19, 0xF3, 0x80, 0x00, 0x83, 0x1F, 0xB3, 0x20, 0xD9, 0x84	}
+	},
+  {7599, 87, 0, {
+    0x89, 0x10, 0x1B, 0x18, 0x50, 0xC9, 0x92, 0x10, 0x09, 0x0D, 0x04, 0x0C, 0xA3, 0x6B, 0xB1, 0x91,
+    0x28, 0xC1, 0x30, 0x8B, 0x83, 0x1B, 0x99, 0x21, 0x87, 0x2F, 0xA8, 0x82, 0x81, 0x41, 0x9D, 0xB3,
+    0x01, 0x90, 0x3E, 0xE3, 0x58, 0xB9, 0x04, 0x2B, 0xB0, 0x78, 0x99, 0x81, 0xA8, 0x14, 0x0D, 0xA2,
+    0x01, 0x1A, 0xA3, 0x1D, 0xB6, 0x48, 0x9A, 0x83, 0x3C, 0xB1, 0x10, 0x1A, 0xB2, 0x09, 0x87, 0x2D	}
+	},
+  {1136, 84, 0, {
+    0xB2, 0x18, 0x90, 0x7C, 0xA9, 0x84, 0x1A, 0xA1, 0x5A, 0xE1, 0x22, 0x8A, 0x21, 0x8D, 0xA4, 0x28,
+    0xD0, 0x11, 0x0B, 0x83, 0x19, 0xE2, 0x69, 0xB8, 0x12, 0x8C, 0x83, 0x29, 0x0A, 0x01, 0xC9, 0x72,
+    0x8B, 0x92, 0xA9, 0x97, 0x80, 0x82, 0x1C, 0xC3, 0x39, 0xB0, 0x6A, 0x88, 0x11, 0xF9, 0x13, 0x1C,
+    0x88, 0x82, 0xB8, 0x33, 0xAD, 0x84, 0x18, 0x81, 0x1F, 0xB3, 0x00, 0xA8, 0x61, 0x9B, 0x94, 0x5B	}
+	},
+  {9118, 87, 0, {
+    0xB0, 0x58, 0x8A, 0x92, 0x08, 0x82, 0x2C, 0x90, 0x2C, 0xB5, 0x10, 0xB9, 0x72, 0x1B, 0xA0, 0x20,
+    0xF2, 0x28, 0xE2, 0x11, 0x09, 0x11, 0x8D, 0x94, 0x29, 0xD1, 0x38, 0x3B, 0x98, 0x4B, 0xC3, 0x38,
+    0xE8, 0x22, 0xBA, 0x05, 0x1C, 0xD3, 0x20, 0x09, 0x01, 0x1C, 0x82, 0x1B, 0xD4, 0x49, 0x0A, 0x11,
+    0xCA, 0x03, 0x19, 0x11, 0x8F, 0xA3, 0x4A, 0xB1, 0x5A, 0xC2, 0x21, 0xAA, 0x22, 0xAC, 0x15, 0x2F	}
+	},
+  {-1201, 87, 0, {
+    0xB2, 0x01, 0x99, 0x69, 0x0A, 0x82, 0xC9, 0x13, 0x2B, 0x21, 0x1F, 0x90, 0x2A, 0xD6, 0x31, 0xAB,
+    0x04, 0x1C, 0xA3, 0x4B, 0xC0, 0x31, 0x0C, 0xC3, 0x48, 0x9A, 0x22, 0x0C, 0xB2, 0x11, 0xE2, 0x49,
+    0xB0, 0x31, 0x1D, 0x91, 0xA9, 0x15, 0x1D, 0xA1, 0x18, 0xB4, 0x10, 0xAA, 0x60, 0x8A, 0x13, 0x0C,
+    0xB3, 0x5D, 0xB8, 0x02, 0x8A, 0x96, 0x5B, 0xA9, 0x22, 0x1D, 0xA1, 0x20, 0xD0, 0x40, 0xA9, 0x02	}
+	},
+  {6295, 83, 0, {
+    0xA9, 0x23, 0x0E, 0x93, 0x4C, 0xC0, 0x02, 0x1A, 0x82, 0x2E, 0xA0, 0x20, 0xD2, 0x21, 0xDA, 0x04,
+    0x8A, 0x03, 0x1C, 0x92, 0x0C, 0xA5, 0x18, 0xC2, 0x38, 0xAB, 0x23, 0x0E, 0x04, 0x0C, 0x92, 0x4B,
+    0xD2, 0x48, 0xA9, 0x03, 0x1D, 0x91, 0x28, 0xB1, 0x3B, 0xB7, 0x10, 0xAA, 0x24, 0x0E, 0x02, 0x1C,
+    0xB3, 0x6A, 0xC8, 0x83, 0xA8, 0x12, 0x2B, 0x12, 0x1F, 0xC2, 0x38, 0xC8, 0x03, 0x3C, 0xD1, 0x30	}
+	},
+  {14111, 85, 0, {
+    0xB9, 0x95, 0x5B, 0xB0, 0x38, 0xA9, 0x14, 0x8C, 0x84, 0x8B, 0x95, 0x2A, 0xA1, 0x5A, 0xA9, 0x12,
+    0xD1, 0x69, 0xA9, 0x83, 0x2C, 0xD3, 0x20, 0x0A, 0x11, 0x0E, 0x93, 0x3B, 0xC1, 0x20, 0xE2, 0x30,
+    0x9B, 0x52, 0x0D, 0xB3, 0x38, 0xF0, 0x12, 0x1A, 0x81, 0x2D, 0x92, 0x4C, 0xA8, 0x22, 0x8C, 0x94,
+    0x1B, 0xA4, 0x3A, 0xC2, 0x5B, 0xB0, 0x12, 0x9C, 0x05, 0x2D, 0xA1, 0x38, 0xE1, 0x21, 0xAA, 0x04	}
+	},
+  {11818, 85, 0, {
+    0x3B, 0xC1, 0x7A, 0x9A, 0x03, 0xCA, 0x84, 0x1A, 0xC4, 0x38, 0xB9, 0x14, 0x2C, 0xB1, 0x5A, 0x0A,
+    0x02, 0x9B, 0x96, 0x1A, 0xB3, 0x7B, 0xB8, 0x03, 0x2B, 0xA1, 0x4B, 0xE2, 0x30, 0xE0, 0x02, 0x1A,
+    0x01, 0x2D, 0xA2, 0x4B, 0xE1, 0x31, 0x0C, 0xB3, 0x38, 0xC9, 0x42, 0x0D, 0xA2, 0x5A, 0xB0, 0x22,
+    0xBA, 0x14, 0x0C, 0xA3, 0x8A, 0xA6, 0x49, 0xB8, 0x40, 0x0B, 0x12, 0x8C, 0xA4, 0x0A, 0x86, 0x8B	}
+	},
+  {-14482, 84, 0, {
+    0xB6, 0x38, 0xAA, 0x84, 0x1B, 0xB5, 0x39, 0xB8, 0x52, 0x8C, 0x22, 0x8D, 0x94, 0x3B, 0xC2, 0x38,
+    0xB9, 0x41, 0xD0, 0x21, 0xAA, 0x05, 0x1D, 0x93, 0x1C, 0xB4, 0x48, 0xA9, 0x03, 0x0D, 0xC4, 0x48,
+    0xC8, 0x22, 0x0C, 0xB4, 0x39, 0xD0, 0x03, 0x8B, 0x83, 0x3C, 0x01, 0x0E, 0xA4, 0x5A, 0xC8, 0x22,
+    0x0D, 0xA3, 0x19, 0xC3, 0x48, 0xC0, 0x48, 0xB8, 0x30, 0x9B, 0x86, 0x1B, 0x03, 0x1F, 0xC3, 0x38	}
+	},
+  {9955, 86, 0, {
+    0xC0, 0x21, 0xAA, 0x95, 0x1A, 0xC3, 0x38, 0xB0, 0x6A, 0xB8, 0x33, 0x8E, 0x83, 0x3C, 0xC0, 0x21,
+    0xE0, 0x22, 0x0C, 0xA3, 0x5B, 0xC0, 0x03, 0x0B, 0x94, 0x3C, 0xB1, 0x49, 0xC0, 0x12, 0x0B, 0x95,
+    0x3C, 0xD1, 0x30, 0xAA, 0x14, 0x9B, 0x04, 0x1D, 0xB2, 0x48, 0xC0, 0x30, 0xD9, 0x84, 0x2B, 0xD3,
+    0x48, 0xAA, 0x04, 0xAA, 0x14, 0x2D, 0xC2, 0x38, 0xC0, 0x20, 0xC8, 0x13, 0x0C, 0x94, 0x8A, 0x95	}
+	},
+  {5170, 87, 0, {
+    0x4B, 0xC0, 0x31, 0xAA, 0x42, 0xBB, 0x33, 0xFA, 0x84, 0x1B, 0x02, 0x1D, 0xB2, 0x58, 0x9A, 0x13,
+    0x9C, 0x23, 0x8E, 0xA4, 0x29, 0xC1, 0x12, 0xAA, 0x52, 0xAB, 0x52, 0xAB, 0x23, 0xEA, 0x13, 0x9A,
+    0x03, 0x1E, 0xA3, 0x3A, 0xB0, 0x68, 0x9A, 0x94, 0x8A, 0x96, 0x3A, 0xB8, 0x22, 0xE9, 0x32, 0x0D,
+    0xB3, 0x38, 0xD8, 0x41, 0x8B, 0x12, 0x8C, 0xA4, 0x3A, 0xD3, 0x38, 0xAA, 0x85, 0x8A, 0x84, 0x2D	}
+	},
+  {-1312, 87, 0, {
+    0xB2, 0x48, 0xAA, 0x04, 0x2C, 0xB1, 0x38, 0xC0, 0x68, 0xA9, 0x21, 0xC9, 0x04, 0x1B, 0xC3, 0x5A,
+    0x98, 0x38, 0xE0, 0x21, 0x9A, 0x94, 0x0A, 0x95, 0x4B, 0xB8, 0x31, 0xE0, 0x30, 0xAA, 0x04, 0x0B,
+    0x03, 0x2F, 0xB1, 0x48, 0xA8, 0x30, 0xCA, 0x85, 0x1A, 0xC3, 0x39, 0xB0, 0x69, 0xC0, 0x12, 0x0C,
+    0xA3, 0x3A, 0xC1, 0x40, 0xAA, 0x13, 0x1D, 0xB2, 0x59, 0xC8, 0x03, 0x0B, 0x95, 0x2B, 0xA2, 0x5C	}
+	},
+  {8319, 86, 0, {
+    0xA8, 0x12, 0x8C, 0xA5, 0x39, 0xD0, 0x21, 0xC0, 0x30, 0xAB, 0x86, 0x1A, 0x92, 0x3C, 0xB0, 0x68,
+    0xA9, 0x12, 0x9A, 0x84, 0x1C, 0xC4, 0x38, 0xB9, 0x14, 0x8B, 0x03, 0x0D, 0x83, 0x3C, 0xC0, 0x30,
+    0xD8, 0x13, 0x8C, 0x84, 0x8A, 0x03, 0x2E, 0xC1, 0x20, 0xC1, 0x30, 0xAB, 0x05, 0x1C, 0xA2, 0x49,
+    0xA9, 0x41, 0xCA, 0x04, 0xA9, 0x23, 0x0E, 0xA3, 0x09, 0xA4, 0x5B, 0xC0, 0x21, 0x9A, 0xA4, 0x49	}
+	},
+  {10546, 85, 0, {
+    0xC8, 0x22, 0xAA, 0x32, 0x9D, 0x23, 0xBB, 0x87, 0x1B, 0xC3, 0x30, 0xAA, 0x13, 0x8C, 0x04, 0x0D,
+    0xA3, 0x39, 0xB8, 0x78, 0xC8, 0x03, 0x0B, 0x03, 0x8E, 0x94, 0x09, 0x93, 0x1B, 0x83, 0x2E, 0x81,
+    0x2C, 0xC3, 0x29, 0xC2, 0x30, 0xBB, 0x25, 0x0D, 0x92, 0x3A, 0xB0, 0x58, 0xE1, 0x21, 0x0C, 0x92,
+    0x09, 0x83, 0x3E, 0xB0, 0x20, 0xD2, 0x28, 0xD2, 0x38, 0xB0, 0x7A, 0x99, 0x21, 0xAA, 0x32, 0x9D	}
+	},
+  {-13397, 82, 0, {
+    0x32, 0xAC, 0x96, 0x19, 0x92, 0x2C, 0xC2, 0x30, 0x9B, 0x85, 0x2B, 0xC2, 0x38, 0xC8, 0x03, 0x8B,
+    0x05, 0x1D, 0xA2, 0x29, 0xD2, 0x48, 0xB9, 0x14, 0x0C, 0xC3, 0x20, 0xB0, 0x48, 0xD8, 0x22, 0x0C,
+    0x21, 0x9C, 0x84, 0x1A, 0xB2, 0x39, 0xF4, 0x20, 0x8A, 0x02, 0x1B, 0xB3, 0x6B, 0xA8, 0x31, 0xE8,
+    0x21, 0xAA, 0x14, 0x1D, 0xB2, 0x39, 0xC1, 0x21, 0x0C, 0xA4, 0x2A, 0xB3, 0x4C, 0xA1, 0x5C, 0xA0	}
+	},
+  {-3448, 82, 0, {
+    0x29, 0xD2, 0x30, 0x9A, 0x22, 0xDB, 0x05, 0x9A, 0x13, 0x8C, 0x83, 0x1B, 0x94, 0x1C, 0xA4, 0x5C,
+    0xA8, 0x30, 0x9A, 0x12, 0xBB, 0x07, 0x9A, 0x84, 0x0B, 0x13, 0x0E, 0xA3, 0x5A, 0xA9, 0x21, 0xD0,
+    0x12, 0xAA, 0x42, 0x8C, 0x94, 0x4B, 0xC0, 0x21, 0xA9, 0x22, 0x8C, 0x94, 0x2B, 0x83, 0x2F, 0xB1,
+    0x48, 0xB8, 0x48, 0xC1, 0x39, 0xB1, 0x59, 0xB8, 0x32, 0x9D, 0x85, 0x8A, 0x03, 0x2D, 0xC1, 0x20	}
+	},
+  {3923, 80, 0, {
+    0xC1, 0x48, 0xB9, 0x04, 0x1B, 0x02, 0x0E, 0xA3, 0x29, 0xB1, 0x69, 0xB8, 0x31, 0x9B, 0x33, 0x8F,
+    0x22, 0xCB, 0x85, 0x1A, 0xA2, 0x39, 0xC8, 0x41, 0x9B, 0x85, 0x1C, 0xB3, 0x39, 0xD1, 0x58, 0x9A,
+    0x31, 0xBA, 0x04, 0x0C, 0x94, 0x1A, 0xA2, 0x6B, 0xC0, 0x31, 0xAB, 0x04, 0x8B, 0x23, 0xBC, 0x06,
+    0x0B, 0x03, 0x0E, 0x02, 0x0B, 0xA4, 0x4A, 0xA0, 0x49, 0xD0, 0x31, 0x8C, 0xA4, 0x29, 0xB1, 0x30	}
+	},
+  {6312, 75, 0, {
+    0xCA, 0x04, 0x1B, 0x12, 0x0E, 0x83, 0x1E, 0x92, 0x19, 0xC2, 0x48, 0xB9, 0x23, 0x8C, 0x31, 0xDA,
+    0x03, 0x2B, 0xD3, 0x30, 0xCA, 0x33, 0x8E, 0x94, 0x0A, 0x94, 0x3B, 0xC2, 0x49, 0xA9, 0x23, 0x9C,
+    0x32, 0xEB, 0x23, 0x8C, 0x22, 0x8D, 0x83, 0x2B, 0xC3, 0x3A, 0xD3, 0x48, 0x9A, 0x40, 0xE0, 0x02,
+    0x8A, 0x03, 0x1D, 0x21, 0x8D, 0x83, 0x0B, 0xA5, 0x3A, 0xA1, 0x4B, 0xA2, 0x3D, 0xC2, 0x18, 0xC3	}
+	},
+  {-2538, 76, 0, {
+    0x49, 0xA8, 0x59, 0xC8, 0x03, 0x8A, 0x03, 0x0C, 0x22, 0x9E, 0x84, 0x0A, 0x83, 0x1D, 0xA3, 0x4A,
+    0xA9, 0x32, 0xCB, 0x42, 0xE8, 0x21, 0xC8, 0x22, 0x8C, 0x03, 0x9B, 0x05, 0x2D, 0x90, 0x29, 0xC2,
+    0x38, 0xC0, 0x38, 0xC2, 0x7B, 0xA8, 0x20, 0xC0, 0x20, 0xC1, 0x48, 0xA9, 0x31, 0x9B, 0x13, 0x0E,
+    0x93, 0x2B, 0xA4, 0x1B, 0xA6, 0x3B, 0x92, 0x2D, 0xC3, 0x38, 0xB9, 0x51, 0xC9, 0x84, 0x1B, 0x31	}
+	},
+  {6980, 72, 0, {
+    0x9C, 0x31, 0xDA, 0x84, 0x0A, 0x94, 0x2B, 0x93, 0x2F, 0xC2, 0x20, 0x99, 0x20, 0xE2, 0x48, 0x9A,
+    0x21, 0xB8, 0x30, 0xF1, 0x20, 0x99, 0x83, 0x2C, 0x92, 0x3D, 0xB1, 0x49, 0xD1, 0x38, 0xB0, 0x49,
+    0xC2, 0x49, 0xB8, 0x40, 0xC8, 0x30, 0xC0, 0x40, 0xAA, 0x22, 0xBA, 0x15, 0x1E, 0xA2, 0x39, 0xC8,
+    0x13, 0x9B, 0x14, 0x0E, 0x12, 0x8C, 0x83, 0x1B, 0xA4, 0x1A, 0x95, 0x1C, 0xA3, 0x2A, 0xD3, 0x59	}
+	},
+  {4153, 75, 0, {
+    0xA9, 0x94, 0x1A, 0x83, 0x0D, 0x93, 0x3B, 0xD2, 0x00, 0x94, 0x2D, 0x91, 0x29, 0xB0, 0x79, 0x99,
+    0x20, 0xC0, 0x20, 0xD1, 0x30, 0xB9, 0x41, 0x9B, 0x52, 0xBB, 0x14, 0xAA, 0x05, 0x1D, 0x92, 0x1A,
+    0xA3, 0x3B, 0xC2, 0x6A, 0xB0, 0x28, 0xC2, 0x39, 0xE2, 0x58, 0x8A, 0x20, 0xB8, 0x40, 0xD8, 0x21,
+    0xC0, 0x20, 0xD1, 0x10, 0xB2, 0x09, 0x84, 0x1C, 0x21, 0x1E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80	}
+	}
+};
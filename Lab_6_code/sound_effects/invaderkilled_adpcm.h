@@ -0,0 +1,11 @@
+#ifndef invaderkilled_adpcm_ADPCM_H
+#define invaderkilled_adpcm_ADPCM_H
+
+#include <adpcm.h>
+
+// Generated by adpcm_convert from invaderkilled.raw
+#define NUM_invaderkilled_adpcm_BLOCKS 	22
+#define invaderkilled_adpcm_RATE 	8000
+extern const adpcm_block invaderkilled_adpcm[NUM_invaderkilled_adpcm_BLOCKS];
+
+#endif
@@ -0,0 +1,145 @@
+#include <music.h>
+#include <queue.h>
+
+// Each track plays on a deck. There are two so that one track can
+// fade out while the next one fades in.
+#define NUM_DECKS 2
+
+typedef struct{
+  const music_track_t *track; // NULL when the deck is idle
+  int position;               // block that is decoded in next
+  int gain;                   // current fade level
+  int target;                 // level the fade is heading for
+  int step;                   // change in level per buffer
+  int prefetched;             // next holds the block at position
+  effect_buffer next;
+}music_deck_t;
+
+static music_deck_t decks[NUM_DECKS];
+static int current_deck = 0;
+static int music_gain = EFFECT_GAIN_UNITY;
+
+// Game tasks send commands to the mixer through a queue, so decks are
+// only ever touched by the mixer task.
+typedef struct{
+  const music_track_t *track; // NULL means stop
+  int fade_buffers;
+}music_command_t;
+
+#define MUSIC_QUEUE_LENGTH 4
+static QueueHandle_t music_queue;
+static StaticQueue_t music_queue_QCB;
+static music_command_t music_queue_buf[MUSIC_QUEUE_LENGTH];
+
+void music_init()
+{
+  music_queue = xQueueCreateStatic(MUSIC_QUEUE_LENGTH, sizeof(music_command_t),
+                                   (uint8_t*)music_queue_buf, &music_queue_QCB);
+}
+
+void music_play(const music_track_t *track, int fade_buffers)
+{
+  music_command_t cmd = {track, fade_buffers};
+  xQueueSend(music_queue, &cmd, 0);
+}
+
+void music_stop(int fade_buffers)
+{
+  music_command_t cmd = {NULL, fade_buffers};
+  xQueueSend(music_queue, &cmd, 0);
+}
+
+void music_set_gain(int gain)
+{
+  music_gain = EFFECT_GAIN_CLAMP(gain);
+}
+
+// Start a fade from the deck's current level to target.
+static void deck_fade(music_deck_t *deck, int target, int fade_buffers)
+{
+  deck->target = target;
+  if(fade_buffers <= 0){
+    deck->gain = target;
+    deck->step = 0;
+  }
+  else{
+    deck->step = (target - deck->gain) / fade_buffers;
+    if(deck->step == 0)
+      deck->step = target > deck->gain ? 1 : -1;
+  }
+}
+
+static void music_command(const music_command_t *cmd)
+{
+  music_deck_t *old = &decks[current_deck];
+
+  // fade out whatever is playing now
+  if(old->track != NULL)
+    deck_fade(old, 0, cmd->fade_buffers);
+
+  if(cmd->track == NULL)
+    return;
+
+  // start the new track on the other deck, cutting off anything that
+  // was still fading out there
+  current_deck = (current_deck + 1) % NUM_DECKS;
+  music_deck_t *deck = &decks[current_deck];
+  deck->track = cmd->track;
+  deck->position = 0;
+  deck->prefetched = 0;
+  deck->gain = 0;
+  deck_fade(deck, EFFECT_GAIN_UNITY, cmd->fade_buffers);
+}
+
+int music_collect(mixer_stream_t *streams)
+{
+  music_command_t cmd;
+  int num_streams = 0;
+
+  while(xQueueReceive(music_queue, &cmd, 0) == pdPASS)
+    music_command(&cmd);
+
+  for(int i=0; i<NUM_DECKS; i++){
+    music_deck_t *deck = &decks[i];
+    if(deck->track == NULL)
+      continue;
+
+    // Only happens on the first buffer of a track; after that the
+    // block has always been decoded ahead of time.
+    if(!deck->prefetched)
+      adpcm_decode_block(&deck->track->blocks[deck->position], deck->next.data);
+
+    streams[num_streams].data = deck->next.data;
+    streams[num_streams].gain = (deck->gain * music_gain) >> 8;
+    num_streams++;
+
+    // advance the fade
+    if(deck->gain != deck->target){
+      deck->gain += deck->step;
+      if((deck->step > 0 && deck->gain > deck->target) ||
+         (deck->step < 0 && deck->gain < deck->target))
+        deck->gain = deck->target;
+    }
+
+    // advance the cursor, looping if the track has a loop
+    deck->prefetched = 0;
+    deck->position++;
+    if(deck->track->loop_end > 0 && deck->position >= deck->track->loop_end)
+      deck->position = deck->track->loop_start;
+
+    if(deck->position >= deck->track->num_blocks || (deck->gain == 0 && deck->target == 0))
+      deck->track = NULL;
+  }
+  return num_streams;
+}
+
+void music_prefetch()
+{
+  for(int i=0; i<NUM_DECKS; i++){
+    music_deck_t *deck = &decks[i];
+    if(deck->track != NULL && !deck->prefetched){
+      adpcm_decode_block(&deck->track->blocks[deck->position], deck->next.data);
+      deck->prefetched = 1;
+    }
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef MUSIC_H
+#define MUSIC_H
+
+#include <FreeRTOS.h>
+#include <adpcm.h>
+#include <sound_effects.h>
+
+// Background music is played by the mixer on its own channel, under
+// the sound effects. Tracks are stored as IMA-ADPCM blocks, one block
+// per mixer buffer, so all positions and fade times below are given
+// in buffers (EFFECT_BUFFER_SIZE samples each).
+typedef struct{
+  const adpcm_block *blocks;
+  int num_blocks;
+  int loop_start; // block to go back to when loop_end is reached
+  int loop_end;   // set to 0 to play the track once and stop
+}music_track_t;
+
+// Start playing a track. If music is already playing, the old track
+// fades out while the new one fades in over fade_buffers buffers. Use
+// 0 to cut straight to the new track.
+void music_play(const music_track_t *track, int fade_buffers);
+
+// Fade the music out over fade_buffers buffers and stop.
+void music_stop(int fade_buffers);
+
+// Set the music level relative to the effects (EFFECT_GAIN_UNITY is
+// full level).
+void music_set_gain(int gain);
+
+// The following are called by the mixer task only.
+
+// Create the command queue. Called from effect_init().
+void music_init();
+
+// Apply pending commands and add one stream per playing track to
+// streams. Returns the number of streams added (0 to 2).
+int music_collect(mixer_stream_t *streams);
+
+// Decode the next block of each playing track, ready for the next
+// call to music_collect. The mixer calls this after it has handed
+// the mixed buffer to the ISR, so decoding never delays a mix.
+void music_prefetch();
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef NOISE_SHAPER_H
+#define NOISE_SHAPER_H
+
+#include <stdint.h>
+
+// Error feedback quantizer for the mixer output. The mix is worked
+// out with NS_FRAC_BITS more bits of resolution than the PM duty
+// value can take. Plain rounding throws those bits away and leaves
+// white noise across the whole band. Feeding the rounding error back
+// into the next samples moves that noise up towards half the sample
+// rate, where the speaker and the ear are least sensitive, and lowers
+// it in the rest of the band.
+//
+//   order 0: plain rounding
+//   order 1: noise transfer function (1 - z^-1)
+//   order 2: noise transfer function (1 - z^-1)^2
+//
+// The functions are inline because the mixer calls them once per
+// sample.
+
+#define NS_FRAC_BITS 8
+#define NS_HALF      (1 << (NS_FRAC_BITS - 1))
+
+typedef struct{
+  int order;
+  int32_t e1, e2; // the last two quantization errors
+}noise_shaper_t;
+
+static inline void noise_shaper_init(noise_shaper_t *ns, int order)
+{
+  ns->order = order;
+  ns->e1 = 0;
+  ns->e2 = 0;
+}
+
+// Quantize x, which has NS_FRAC_BITS fractional bits, to an integer.
+// The result is not clipped; the error is worked out before clipping
+// so that overloads cannot make the feedback loop unstable.
+static inline int32_t noise_shaper_quantize(noise_shaper_t *ns, int32_t x)
+{
+  int32_t v, q;
+
+  if(ns->order >= 2)
+    v = x - 2 * ns->e1 + ns->e2;
+  else if(ns->order == 1)
+    v = x - ns->e1;
+  else
+    v = x;
+
+  q = (v + NS_HALF) >> NS_FRAC_BITS;
+  ns->e2 = ns->e1;
+  ns->e1 = (q << NS_FRAC_BITS) - v;
+  return q;
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include <resample.h>
+#include <stddef.h>
+
+#define RESAMPLE_ONE (1 << 16)
+
+// Read the next input sample, fetching a new block when needed.
+// Past the end of the input the samples are silence.
+static inline int32_t next_sample(resampler_t *r)
+{
+  if(r->block == NULL)
+    return 0;
+  if(r->index >= EFFECT_BUFFER_SIZE){
+    r->block = r->fetch(r->ctx);
+    r->index = 0;
+    if(r->block == NULL)
+      return 0;
+  }
+  r->remaining = 2;
+  return r->block[r->index++];
+}
+
+void resampler_init(resampler_t *r, int in_rate, int out_rate,
+                    resample_fetch_t fetch, void *ctx)
+{
+  r->step = ((uint32_t)in_rate << 16) / out_rate;
+  r->fetch = fetch;
+  r->ctx = ctx;
+  r->block = fetch(ctx);
+  r->index = 0;
+  r->remaining = 0;
+  r->x0 = 0;
+  r->x1 = next_sample(r);
+  // the first output advances onto the first input sample
+  r->frac = RESAMPLE_ONE;
+}
+
+int resample_block(resampler_t *r, int8_t *out)
+{
+  for(int i=0; i<EFFECT_BUFFER_SIZE; i++){
+    // Move the pair of input samples along until the output position
+    // lies between them. remaining counts down once the input has run
+    // out, so the last samples are still played.
+    while(r->frac >= RESAMPLE_ONE){
+      r->frac -= RESAMPLE_ONE;
+      r->x0 = r->x1;
+      if(r->remaining > 0)
+        r->remaining--;
+      r->x1 = next_sample(r);
+    }
+    if(r->remaining == 0){
+      for(; i<EFFECT_BUFFER_SIZE; i++)
+        out[i] = 0;
+      return 0;
+    }
+    out[i] = (int8_t)(r->x0 + (((r->x1 - r->x0) * (int32_t)r->frac + (RESAMPLE_ONE >> 1)) >> 16));
+    r->frac += r->step;
+  }
+  return 1;
+}
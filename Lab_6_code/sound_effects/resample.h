@@ -0,0 +1,37 @@
+#ifndef RESAMPLE_H
+#define RESAMPLE_H
+
+#include <stdint.h>
+#include <sounds.h>
+
+// Linear interpolation sample rate converter. The input is read one
+// block of EFFECT_BUFFER_SIZE samples at a time through a fetch
+// function, so it works the same for raw and compressed effects, and
+// the output is produced one mixer buffer at a time. Positions are
+// kept in 16.16 fixed point.
+
+// Return the next block of input samples, or NULL at the end.
+typedef const int8_t *(*resample_fetch_t)(void *ctx);
+
+typedef struct{
+  uint32_t step;          // input samples per output sample
+  uint32_t frac;          // output position between x0 and x1
+  int32_t x0, x1;         // input samples either side of the position
+  const int8_t *block;    // current input block, NULL at the end
+  int index;              // next sample to read from block
+  int remaining;          // samples still to come out of x0 and x1
+  resample_fetch_t fetch;
+  void *ctx;
+}resampler_t;
+
+// Set up r to convert from in_rate to out_rate. This fetches the
+// first input block.
+void resampler_init(resampler_t *r, int in_rate, int out_rate,
+                    resample_fetch_t fetch, void *ctx);
+
+// Write the next EFFECT_BUFFER_SIZE output samples to out. Returns 0
+// once the input has run out, in which case the rest of out is
+// silence.
+int resample_block(resampler_t *r, int8_t *out);
+
+#endif
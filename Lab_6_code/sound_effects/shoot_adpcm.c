@@ -0,0 +1,166 @@
+#include <shoot_adpcm.h>
+
+const adpcm_block shoot_adpcm[NUM_shoot_adpcm_BLOCKS] = {
+  {0, 0, 0, {
+    0xFF, 0x7F, 0xF7, 0x77, 0xBF, 0x37, 0x9E, 0x03, 0x0B, 0x94, 0x1C, 0x03, 0x0D, 0x02, 0x1C, 0xC3,
+    0x28, 0xB1, 0x6A, 0xA8, 0x51, 0xCA, 0x21, 0x9A, 0x23, 0x08, 0xCA, 0x8A, 0x87, 0x48, 0xA8, 0x99,
+    0x09, 0x70, 0x02, 0x98, 0xAB, 0x2A, 0x96, 0x01, 0xD0, 0x0B, 0x00, 0x24, 0x88, 0xAA, 0x8A, 0x01,
+    0x73, 0x83, 0xDA, 0x9B, 0x58, 0x04, 0x01, 0xB8, 0xBB, 0x89, 0x36, 0x00, 0x98, 0xAB, 0x08, 0x79	}
+	},
+  {408, 78, 0, {
+    0x14, 0xD0, 0xAB, 0x48, 0x10, 0x84, 0xB0, 0xCB, 0x20, 0x14, 0x20, 0xAA, 0x9D, 0x09, 0x40, 0x07,
+    0x80, 0xAA, 0x89, 0x90, 0x70, 0x12, 0xB8, 0x9D, 0x10, 0x92, 0x42, 0x01, 0xBD, 0x0A, 0x02, 0x68,
+    0x11, 0xA8, 0xAC, 0x89, 0x05, 0x60, 0x00, 0xDA, 0xA9, 0x20, 0x05, 0x28, 0x08, 0xBE, 0x08, 0x31,
+    0x84, 0x00, 0xA8, 0xAC, 0x18, 0x14, 0x48, 0x12, 0xBA, 0x9F, 0x08, 0x82, 0x15, 0x80, 0xA9, 0xBB	}
+	},
+  {-14082, 74, 0, {
+    0x88, 0x60, 0x15, 0x00, 0xD1, 0x8F, 0x10, 0x18, 0x22, 0x10, 0x90, 0xCF, 0x08, 0x11, 0x13, 0x80,
+    0x98, 0xFB, 0x89, 0x11, 0x15, 0x28, 0x80, 0xF9, 0x0A, 0x18, 0x41, 0x91, 0x11, 0xB0, 0xAE, 0x89,
+    0x31, 0x86, 0x28, 0x00, 0xBA, 0x9D, 0x10, 0x03, 0x21, 0x32, 0x89, 0xF8, 0x9F, 0x00, 0x41, 0x91,
+    0x12, 0x89, 0xDB, 0x89, 0x20, 0x01, 0x06, 0x18, 0x80, 0xCD, 0x99, 0x31, 0x10, 0x24, 0x90, 0x11	}
+	},
+  {19966, 72, 0, {
+    0xED, 0x9A, 0x10, 0x13, 0x41, 0x08, 0x02, 0xDA, 0xDB, 0x09, 0x22, 0x31, 0x05, 0x29, 0x08, 0xDD,
+    0x9A, 0x08, 0x15, 0x20, 0x02, 0x19, 0x88, 0xCF, 0x8A, 0x20, 0x05, 0x10, 0x11, 0x09, 0x91, 0xCF,
+    0x89, 0x01, 0x43, 0x08, 0x20, 0x88, 0x11, 0xDE, 0x9A, 0x28, 0x51, 0x81, 0x11, 0x98, 0x13, 0xEB,
+    0xBA, 0x8B, 0x32, 0x63, 0x12, 0x9A, 0x05, 0x89, 0xB0, 0xDF, 0x88, 0x31, 0x04, 0x08, 0x91, 0x28	}
+	},
+  {12657, 74, 0, {
+    0x81, 0x9C, 0xBC, 0x8B, 0x30, 0x36, 0x03, 0x0B, 0x82, 0x49, 0xD0, 0xCB, 0xAA, 0x28, 0x23, 0x36,
+    0xA2, 0x2A, 0x91, 0x40, 0xDB, 0xDA, 0x9A, 0x10, 0x23, 0x36, 0x98, 0x38, 0x8B, 0x32, 0xF0, 0xA9,
+    0xAF, 0x89, 0x41, 0x33, 0xA2, 0x20, 0xAB, 0x42, 0xB0, 0xA1, 0xCD, 0xAC, 0x0A, 0x62, 0x12, 0x13,
+    0x99, 0x81, 0x1C, 0x85, 0x8A, 0xA1, 0xBF, 0x99, 0x19, 0x64, 0x10, 0x10, 0xA8, 0x18, 0x99, 0x14	}
+	},
+  {9353, 69, 0, {
+    0xB8, 0x81, 0xAF, 0xCA, 0x19, 0x12, 0x54, 0x82, 0x18, 0xA9, 0x18, 0x8A, 0x34, 0xAA, 0x80, 0xCD,
+    0xE9, 0x0B, 0x31, 0x31, 0x26, 0x81, 0x89, 0xA0, 0x1A, 0xA8, 0x53, 0xB1, 0x99, 0xD1, 0xCC, 0x8C,
+    0x8A, 0x34, 0x41, 0x43, 0x88, 0x80, 0xBA, 0x82, 0xBA, 0x23, 0x12, 0xB4, 0x8E, 0x98, 0xAD, 0xDC,
+    0x1A, 0x12, 0x42, 0x25, 0x10, 0x91, 0x8A, 0x90, 0x1B, 0xB8, 0x4A, 0xA2, 0x62, 0xC1, 0x8A, 0xB8	}
+	},
+  {-1049, 58, 0, {
+    0x2B, 0xFD, 0x8B, 0x00, 0x31, 0x05, 0x52, 0x02, 0x00, 0xA8, 0x0A, 0xB9, 0x81, 0xA9, 0x28, 0xC8,
+    0x51, 0x01, 0x02, 0xAE, 0x89, 0xD9, 0x20, 0xFB, 0xDF, 0x30, 0x15, 0x12, 0xE8, 0x0B, 0x72, 0xAA,
+    0x10, 0xB5, 0x89, 0x52, 0xAB, 0x20, 0xC4, 0x89, 0x43, 0x9C, 0x28, 0xC4, 0x09, 0x32, 0x9C, 0x28,
+    0xB4, 0x0B, 0x62, 0xAA, 0x28, 0xB3, 0x8B, 0x53, 0xBA, 0x28, 0x85, 0x9C, 0x32, 0xE0, 0x08, 0x23	}
+	},
+  {14123, 79, 0, {
+    0x8E, 0x30, 0xE2, 0x88, 0x12, 0xAA, 0x30, 0x92, 0x0E, 0x31, 0xE8, 0x00, 0x04, 0x0D, 0x28, 0xB1,
+    0x09, 0x32, 0xDA, 0x10, 0x96, 0x8B, 0x31, 0xB8, 0x1A, 0x53, 0xAC, 0x30, 0xB4, 0x8B, 0x42, 0xF1,
+    0x08, 0x33, 0x9E, 0x10, 0x92, 0x8B, 0x41, 0xD1, 0x88, 0x13, 0xCA, 0x01, 0x85, 0x8C, 0x21, 0xB1,
+    0x0B, 0x73, 0xAA, 0x18, 0x22, 0xBC, 0x21, 0xA5, 0x8B, 0x31, 0xD5, 0x09, 0x31, 0xC9, 0x08, 0x14	}
+	},
+  {13915, 81, 0, {
+    0x9C, 0x10, 0x04, 0x8E, 0x20, 0xA2, 0x0C, 0x31, 0xD0, 0x88, 0x33, 0xCB, 0x18, 0x43, 0xBC, 0x01,
+    0x05, 0x8D, 0x10, 0x93, 0x8C, 0x21, 0xC2, 0x8A, 0x52, 0xB8, 0x1A, 0x43, 0xDA, 0x18, 0x23, 0xBC,
+    0x10, 0x15, 0xAC, 0x10, 0x85, 0x9B, 0x38, 0x95, 0x8C, 0x20, 0xA4, 0x9B, 0x41, 0xB2, 0x8C, 0x41,
+    0xB2, 0x8C, 0x41, 0xC2, 0x0B, 0x41, 0xC2, 0x0B, 0x31, 0xE3, 0x1B, 0x31, 0xD4, 0x0A, 0x41, 0xB8	}
+	},
+  {-5870, 81, 0, {
+    0x89, 0x42, 0xC1, 0x0B, 0x32, 0xE3, 0x0A, 0x31, 0xE3, 0x0A, 0x40, 0xB1, 0x8B, 0x32, 0xB4, 0x0E,
+    0x20, 0xB4, 0x8B, 0x31, 0x83, 0x9F, 0x11, 0x13, 0x9F, 0x01, 0x12, 0xBB, 0x10, 0x63, 0xCB, 0x00,
+    0x32, 0xD9, 0x19, 0x51, 0xC8, 0x88, 0x21, 0xC3, 0x1C, 0x20, 0x92, 0x8D, 0x10, 0x85, 0xAB, 0x10,
+    0x43, 0xDB, 0x00, 0x22, 0xE0, 0x09, 0x31, 0xA1, 0x0E, 0x20, 0x93, 0x9D, 0x01, 0x53, 0xAC, 0x18	}
+	},
+  {-7501, 81, 0, {
+    0x21, 0xF2, 0x88, 0x11, 0x92, 0x0D, 0x10, 0x31, 0xAD, 0x00, 0x22, 0xF1, 0x88, 0x11, 0xA3, 0x0D,
+    0x00, 0x33, 0xAE, 0x10, 0x40, 0xC8, 0x09, 0x11, 0x93, 0x9D, 0x01, 0x33, 0xFA, 0x08, 0x21, 0xA2,
+    0x0E, 0x10, 0x32, 0xBD, 0x00, 0x22, 0xD2, 0x0B, 0x11, 0x33, 0xBE, 0x10, 0x41, 0xD1, 0x8A, 0x21,
+    0x32, 0xBE, 0x10, 0x31, 0xD5, 0x0A, 0x10, 0x31, 0xBC, 0x18, 0x31, 0xB3, 0x9F, 0x11, 0x32, 0xF8	}
+	},
+  {-5352, 83, 0, {
+    0x09, 0x11, 0x12, 0x9F, 0x01, 0x11, 0xC1, 0x8A, 0x02, 0x33, 0xDC, 0x18, 0x11, 0x04, 0x8F, 0x18,
+    0x20, 0xD2, 0x0A, 0x10, 0x41, 0xD9, 0x08, 0x01, 0x23, 0x9F, 0x00, 0x01, 0x93, 0x8E, 0x10, 0x20,
+    0xC2, 0x8B, 0x11, 0x41, 0xD8, 0x1A, 0x11, 0x31, 0xFA, 0x19, 0x01, 0x32, 0xBD, 0x18, 0x02, 0x15,
+    0xAE, 0x10, 0x01, 0x02, 0xAD, 0x01, 0x11, 0x85, 0x8E, 0x00, 0x10, 0x82, 0x8E, 0x10, 0x10, 0x92	}
+	},
+  {8898, 77, 0, {
+    0x9D, 0x01, 0x11, 0x95, 0x9D, 0x10, 0x11, 0x02, 0x9F, 0x10, 0x10, 0x02, 0x9E, 0x00, 0x11, 0x02,
+    0xCC, 0x10, 0x01, 0x32, 0xFB, 0x19, 0x01, 0x22, 0xF8, 0x09, 0x01, 0x21, 0xC1, 0x0D, 0x10, 0x11,
+    0x95, 0x8E, 0x00, 0x01, 0x22, 0xBD, 0x00, 0x01, 0x22, 0xF0, 0x1A, 0x10, 0x10, 0xA5, 0x8D, 0x10,
+    0x10, 0x41, 0xCC, 0x00, 0x01, 0x30, 0xF2, 0x0A, 0x01, 0x00, 0x04, 0x9D, 0x18, 0x10, 0x30, 0xF1	}
+	},
+  {-959, 83, 0, {
+    0x0A, 0x01, 0x10, 0x02, 0xBD, 0x10, 0x02, 0x40, 0xD1, 0x0C, 0x10, 0x01, 0x22, 0xFB, 0x19, 0x01,
+    0x11, 0x95, 0x8F, 0x00, 0x10, 0x20, 0xE1, 0x0A, 0x10, 0x10, 0x41, 0xFA, 0x08, 0x01, 0x00, 0x12,
+    0xAD, 0x08, 0x02, 0x10, 0x85, 0x9E, 0x00, 0x01, 0x10, 0xA4, 0x8E, 0x00, 0x01, 0x10, 0xB4, 0x8E,
+    0x10, 0x10, 0x10, 0xB3, 0x8F, 0x00, 0x01, 0x10, 0xA4, 0x9E, 0x10, 0x01, 0x00, 0x85, 0xAD, 0x10	}
+	},
+  {-6779, 79, 0, {
+    0x01, 0x00, 0x23, 0xBF, 0x00, 0x11, 0x00, 0x51, 0xF9, 0x19, 0x10, 0x18, 0x28, 0xE3, 0x8B, 0x11,
+    0x10, 0x00, 0x14, 0xAF, 0x18, 0x01, 0x81, 0x40, 0xF0, 0x09, 0x10, 0x00, 0x00, 0x03, 0xAF, 0x18,
+    0x01, 0x81, 0x40, 0xF2, 0x8A, 0x11, 0x00, 0x18, 0x41, 0xFB, 0x08, 0x01, 0x00, 0x00, 0x13, 0xBF,
+    0x00, 0x11, 0x00, 0x10, 0x85, 0x9F, 0x18, 0x01, 0x00, 0x10, 0xA3, 0xAF, 0x10, 0x01, 0x81, 0x10	}
+	},
+  {5208, 70, 0, {
+    0x95, 0xAF, 0x01, 0x01, 0x00, 0x00, 0x04, 0xBE, 0x10, 0x01, 0x01, 0x08, 0x43, 0xFC, 0x19, 0x10,
+    0x10, 0x08, 0x30, 0xF2, 0x8C, 0x11, 0x00, 0x00, 0x00, 0x23, 0xDF, 0x00, 0x01, 0x00, 0x00, 0x38,
+    0xE3, 0x8D, 0x10, 0x01, 0x80, 0x81, 0x41, 0xF8, 0x0B, 0x11, 0x01, 0x00, 0x08, 0x52, 0xFB, 0x09,
+    0x11, 0x00, 0x00, 0x08, 0x42, 0xFB, 0x8A, 0x12, 0x11, 0x08, 0x88, 0x62, 0xE8, 0x8B, 0x21, 0x01	}
+	},
+  {532, 71, 0, {
+    0x00, 0x80, 0x38, 0xA7, 0x9F, 0x00, 0x11, 0x00, 0x80, 0x88, 0x53, 0xFA, 0x0A, 0x11, 0x01, 0x00,
+    0x88, 0x18, 0x15, 0xCE, 0x08, 0x02, 0x01, 0x80, 0x80, 0x18, 0x06, 0xBE, 0x18, 0x11, 0x01, 0x00,
+    0x88, 0x00, 0x34, 0xFC, 0x0B, 0x21, 0x11, 0x08, 0x90, 0x80, 0x51, 0xD4, 0x9E, 0x20, 0x01, 0x00,
+    0x08, 0x88, 0x80, 0x63, 0xF8, 0x8B, 0x12, 0x01, 0x00, 0x80, 0x08, 0x89, 0x44, 0xF0, 0x8C, 0x20	}
+	},
+  {-3948, 73, 0, {
+    0x11, 0x08, 0x80, 0x08, 0x98, 0x50, 0x03, 0xFF, 0x00, 0x01, 0x81, 0x80, 0x80, 0x90, 0x80, 0x50,
+    0xB2, 0xBF, 0x20, 0x11, 0x01, 0x80, 0x90, 0x88, 0x08, 0x69, 0x14, 0xCF, 0x19, 0x11, 0x01, 0x00,
+    0x08, 0x89, 0x90, 0x81, 0x70, 0x82, 0xCF, 0x29, 0x11, 0x01, 0x80, 0x80, 0x09, 0x08, 0x88, 0x48,
+    0x34, 0xF9, 0x9F, 0x11, 0x11, 0x00, 0x08, 0x88, 0x19, 0x89, 0x00, 0x19, 0x27, 0xF1, 0x9D, 0x20	}
+	},
+  {-5233, 72, 0, {
+    0x11, 0x10, 0x08, 0x98, 0x90, 0x80, 0x08, 0x90, 0x18, 0x37, 0xE3, 0xAF, 0x18, 0x22, 0x10, 0x08,
+    0x09, 0x88, 0x90, 0x00, 0x98, 0x80, 0xB3, 0x75, 0x11, 0xDF, 0x0A, 0x22, 0x11, 0x00, 0x88, 0x89,
+    0x88, 0x18, 0x98, 0x81, 0x00, 0x98, 0x30, 0x67, 0x92, 0xEF, 0x09, 0x21, 0x11, 0x00, 0x08, 0x88,
+    0x89, 0x90, 0xA1, 0x01, 0x3A, 0x8A, 0x18, 0xB1, 0x21, 0x77, 0x02, 0xDF, 0xAA, 0x32, 0x32, 0x81	}
+	},
+  {1817, 61, 0, {
+    0x90, 0x90, 0x18, 0x0B, 0xB1, 0x92, 0x2B, 0x22, 0x0D, 0xB1, 0x08, 0x08, 0x22, 0x3A, 0x7C, 0x47,
+    0xB8, 0xDF, 0x99, 0x22, 0x14, 0x81, 0x80, 0x88, 0x71, 0x9E, 0x81, 0x41, 0x8D, 0x81, 0xC4, 0x00,
+    0x30, 0x0E, 0x00, 0xC2, 0x00, 0x30, 0x0D, 0x00, 0xC2, 0x80, 0x31, 0x1F, 0x08, 0xC2, 0x81, 0x20,
+    0x1C, 0x08, 0xD3, 0x91, 0x21, 0x0B, 0x19, 0x83, 0x0D, 0x48, 0xD0, 0x80, 0x04, 0x2D, 0x3A, 0xD0	}
+	},
+  {-4749, 73, 0, {
+    0xA2, 0x03, 0x0A, 0x19, 0x93, 0x1D, 0x78, 0xAA, 0xA2, 0x96, 0x2A, 0x3A, 0x98, 0x09, 0x51, 0xAB,
+    0x92, 0xB7, 0x18, 0x49, 0x89, 0x0A, 0x42, 0x0E, 0x00, 0xC2, 0x91, 0x20, 0xD1, 0x91, 0x13, 0x1F,
+    0x29, 0x80, 0x0A, 0x58, 0xC8, 0x92, 0x02, 0x9A, 0x91, 0xA7, 0x19, 0x39, 0xA0, 0x09, 0x70, 0x0C,
+    0x80, 0x21, 0x0D, 0x00, 0xB2, 0x08, 0x69, 0xE1, 0x91, 0x11, 0x99, 0x80, 0x03, 0x1D, 0x19, 0xA5	}
+	},
+  {629, 68, 0, {
+    0x2B, 0x39, 0xD3, 0x09, 0x40, 0xA9, 0x98, 0x25, 0x8D, 0x91, 0x84, 0x0C, 0x00, 0x94, 0x1B, 0x18,
+    0xB3, 0x0B, 0x60, 0xB8, 0x08, 0x61, 0xAA, 0xB1, 0x25, 0x8C, 0x90, 0x14, 0x0D, 0x80, 0x94, 0x2B,
+    0x09, 0xA6, 0x2A, 0x1A, 0xB6, 0x29, 0x3A, 0xD2, 0x18, 0x39, 0xD1, 0x08, 0x48, 0xA8, 0x90, 0x40,
+    0xB8, 0x89, 0x62, 0xB8, 0x19, 0x58, 0xD1, 0x08, 0x58, 0xD0, 0x00, 0x48, 0xB9, 0x81, 0x31, 0xAA	}
+	},
+  {-1247, 60, 0, {
+    0x88, 0x32, 0xF3, 0x2A, 0x49, 0xF2, 0x00, 0x49, 0xB8, 0x81, 0x38, 0xB1, 0x3B, 0x4B, 0xD6, 0x00,
+    0x18, 0x80, 0x8A, 0x91, 0x87, 0x1C, 0x08, 0xA3, 0x99, 0x81, 0x53, 0x0F, 0x80, 0x11, 0x8A, 0x19,
+    0x78, 0xAA, 0x92, 0x11, 0xC1, 0x08, 0x38, 0xF3, 0xA1, 0xA2, 0x85, 0x1C, 0x18, 0x48, 0x9B, 0x00,
+    0x40, 0x0C, 0x18, 0x5A, 0xC8, 0xA2, 0xB3, 0xA7, 0x08, 0x18, 0x38, 0x0D, 0x18, 0x28, 0xC9, 0x01	}
+	},
+  {-727, 60, 0, {
+    0x20, 0xD2, 0x89, 0x92, 0x85, 0x1C, 0x08, 0x21, 0xCA, 0x28, 0x20, 0xF3, 0x19, 0x08, 0x23, 0x0F,
+    0x08, 0x48, 0xD8, 0x80, 0x01, 0xE4, 0x00, 0x80, 0x02, 0x2C, 0x1A, 0x59, 0x8A, 0x90, 0x82, 0xB3,
+    0x98, 0x38, 0x79, 0xC9, 0x81, 0x91, 0xB6, 0x08, 0x28, 0x49, 0xAA, 0x18, 0x80, 0xB7, 0x18, 0x3A,
+    0x49, 0xB9, 0x08, 0x82, 0xB7, 0x2A, 0x39, 0x3A, 0xF2, 0x08, 0x90, 0x96, 0x1A, 0x29, 0x4A, 0xF1	}
+	},
+  {-1456, 63, 0, {
+    0x00, 0x18, 0x38, 0xAA, 0x80, 0x82, 0xA3, 0x1D, 0x18, 0x49, 0xF1, 0xA1, 0x02, 0x30, 0x0F, 0x08,
+    0x92, 0xB3, 0x3B, 0x1A, 0x11, 0xF4, 0x90, 0x30, 0x5A, 0xAA, 0xA2, 0x80, 0x24, 0x1F, 0x2A, 0x90,
+    0x94, 0xB8, 0x82, 0x90, 0x05, 0x1D, 0x88, 0x82, 0xE4, 0x10, 0x29, 0x2B, 0xB0, 0x01, 0x08, 0x08,
+    0xD7, 0x10, 0x3A, 0x49, 0x9B, 0x91, 0x81, 0x02, 0xF3, 0xA0, 0x82, 0x60, 0x0C, 0x08, 0x01, 0x39	}
+	},
+  {472, 49, 0, {
+    0xDA, 0x81, 0x81, 0x50, 0xE0, 0x80, 0x00, 0x28, 0xC1, 0x08, 0x10, 0x19, 0xD3, 0x19, 0x39, 0x2A,
+    0xD5, 0x19, 0x10, 0x39, 0xF1, 0xB2, 0x92, 0x19, 0x60, 0x8B, 0x29, 0x18, 0x22, 0x9D, 0x19, 0x7A,
+    0x2A, 0xE4, 0x81, 0x19, 0x90, 0xE3, 0x01, 0x00, 0x2A, 0x10, 0x8D, 0x81, 0x00, 0x7B, 0xA9, 0x80,
+    0xA2, 0xA5, 0x11, 0x1B, 0x4A, 0x81, 0x19, 0x89, 0xE0, 0x01, 0x08, 0xB4, 0x2A, 0x08, 0x78, 0x19	}
+	},
+  {-16, 44, 0, {
+    0x0C, 0x08, 0x08, 0x38, 0xD6, 0x88, 0x12, 0x4D, 0x2A, 0xA9, 0x91, 0xC3, 0xA6, 0x18, 0x99, 0x31,
+    0x9B, 0x51, 0x89, 0x40, 0x1F, 0x80, 0x80, 0xC1, 0x91, 0xA4, 0x19, 0x21, 0x8A, 0xD0, 0x05, 0x08,
+    0x88, 0x00, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08, 0x08, 0x08,
+    0x08, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00	}
+	}
+};
@@ -0,0 +1,11 @@
+#ifndef shoot_adpcm_ADPCM_H
+#define shoot_adpcm_ADPCM_H
+
+#include <adpcm.h>
+
+// Generated by adpcm_convert from shoot.raw
+#define NUM_shoot_adpcm_BLOCKS 	27
+#define shoot_adpcm_RATE 	8000
+extern const adpcm_block shoot_adpcm[NUM_shoot_adpcm_BLOCKS];
+
+#endif
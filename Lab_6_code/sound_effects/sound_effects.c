@@ -2,50 +2,266 @@
 #include <sounds.h>
 #include <sound_effects.h>
 #include <stddef.h>
+#include <string.h>
 #include <queue.h>
+#include <task.h>
 #include <pulse_modulator.h>
-// #include <theme.h>
+#include <adpcm.h>
+#include <music.h>
+#include <synth.h>
+#include <resample.h>
+#include <noise_shaper.h>
+#include <dsp.h>
+#include <explosion1_adpcm.h>
+#include <invaderkilled_adpcm.h>
+#include <shoot_adpcm.h>
+#include <ufo_lowpitch_adpcm.h>
+#ifdef THEME_MUSIC
+#include <theme_adpcm.h>
+#endif
 
 #define CHANNEL 0
 
 EventGroupHandle_t effect_events;
 
-// Each sound effect task will send audio buffers (actually just
-// pointers) to the mixer using a dedicated queue
-// static QueueHandle_t effect_to_mixer_queues[NUM_EFFECTS];
-
 // The mixer will send buffer pointers to the ISR.
 static QueueHandle_t MixerToISRqueue;
 // The Interrupt Handler will return the buffer pointers to the mixer
 // after transferring the data to the PM device.
 static QueueHandle_t ISRToMixerqueue;
 
-// Each instance of the effect_task will be given a unique sound to
-// play, and a unique trigger event using the following structure. The
-// pointer to an effect task's structure will be passed to it using
-// the "params" mechanism in xTaskCreateStatic.
+// Each sound effect has a unique sound to play, a unique trigger
+// event, and some rules that decide what happens when it is triggered
+// while voices are busy.
+// An effect is stored either as raw 8-bit buffers or as IMA-ADPCM
+// blocks (one block per buffer); the unused pointer is NULL. Effects
+// recorded at a different rate from the mixer are resampled as they
+// play.
 typedef struct{
   effect_buffer *buffers;
+  const adpcm_block *adpcm_blocks;
   int num_buffers;
+  int sample_rate;
   EventBits_t event;
-  QueueHandle_t sendqueue;
+  int gain;
+  int priority;   // higher priority effects may steal voices from lower
+  int max_voices; // how many copies of this effect may play at once
 }effect_param_t;
 
-// The audio data and events that trigger them are known at compile
-// time, but the queue handles must be filled in at run time by the
-// effect_init() function.
-static effect_param_t effect_task_params[NUM_EFFECTS] = {
-  {explosion1,NUM_explosion1_BUFFERS,EXPLOSION1_EVENT,NULL},
-  {fastinvader1,NUM_fastinvader1_BUFFERS,FASTINVADER1_EVENT,NULL},
-  {fastinvader2,NUM_fastinvader2_BUFFERS,FASTINVADER2_EVENT,NULL},
-  {fastinvader3,NUM_fastinvader3_BUFFERS,FASTINVADER3_EVENT,NULL},
-  {fastinvader4,NUM_fastinvader4_BUFFERS,FASTINVADER4_EVENT,NULL},
-  {invaderkilled,NUM_invaderkilled_BUFFERS,INVADERKILLED_EVENT,NULL},
-  {shoot,NUM_shoot_BUFFERS,SHOOT_EVENT,NULL},
-  {ufo_highpitch,NUM_ufo_highpitch_BUFFERS,UFO_HIGHPITCH_EVENT,NULL},
-  {ufo_lowpitch,NUM_ufo_lowpitch_BUFFERS,UFO_LOWPITCH_EVENT,NULL}
+// The audio data, the events that trigger them and their voice rules
+// are all known at compile time. The four longest effects are played
+// from IMA-ADPCM tables made from sounds.c by tools/sounds_raw.c and
+// tools/adpcm_convert.c, which saves 16K of flash (and of RAM, since
+// the 8-bit tables are not const); the linker drops their 8-bit
+// tables.
+static effect_param_t effect_params[NUM_EFFECTS] = {
+  {NULL,explosion1_adpcm,NUM_explosion1_adpcm_BLOCKS,explosion1_adpcm_RATE,EXPLOSION1_EVENT,EFFECT_GAIN_UNITY,3,2},
+  {fastinvader1,NULL,NUM_fastinvader1_BUFFERS,SOUNDS_RATE,FASTINVADER1_EVENT,EFFECT_GAIN_UNITY,0,1},
+  {fastinvader2,NULL,NUM_fastinvader2_BUFFERS,SOUNDS_RATE,FASTINVADER2_EVENT,EFFECT_GAIN_UNITY,0,1},
+  {fastinvader3,NULL,NUM_fastinvader3_BUFFERS,SOUNDS_RATE,FASTINVADER3_EVENT,EFFECT_GAIN_UNITY,0,1},
+  {fastinvader4,NULL,NUM_fastinvader4_BUFFERS,SOUNDS_RATE,FASTINVADER4_EVENT,EFFECT_GAIN_UNITY,0,1},
+  {NULL,invaderkilled_adpcm,NUM_invaderkilled_adpcm_BLOCKS,invaderkilled_adpcm_RATE,INVADERKILLED_EVENT,EFFECT_GAIN_UNITY,2,2},
+  {NULL,shoot_adpcm,NUM_shoot_adpcm_BLOCKS,shoot_adpcm_RATE,SHOOT_EVENT,EFFECT_GAIN_UNITY,1,2},
+  {ufo_highpitch,NULL,NUM_ufo_highpitch_BUFFERS,SOUNDS_RATE,UFO_HIGHPITCH_EVENT,EFFECT_GAIN_UNITY,1,1},
+  {NULL,ufo_lowpitch_adpcm,NUM_ufo_lowpitch_adpcm_BLOCKS,ufo_lowpitch_adpcm_RATE,UFO_LOWPITCH_EVENT,EFFECT_GAIN_UNITY,1,1}
 };
 
+// A voice is one playing instance of an effect: just a pointer to
+// the effect and the index of the next buffer to mix. Triggering an
+// effect starts a voice, and the mixer reads the sample data
+// directly, so no task or queue is needed per effect. Compressed
+// effects are decoded one buffer at a time into the voice's own
+// buffer. Resampled effects are read a block at a time into source
+// and converted into decoded.
+typedef struct{
+  const effect_param_t *effect; // NULL when the voice is free
+  int position;
+  uint32_t started;             // used to find the oldest voice
+  effect_buffer decoded;
+  effect_buffer source;
+  resampler_t resampler;
+}voice_t;
+
+static voice_t voices[NUM_VOICES];
+static uint32_t voice_clock = 0;
+
+// Get block n of an effect, decoding it into scratch if it is
+// compressed.
+static const int8_t *effect_block(const effect_param_t *effect, int n, int8_t *scratch)
+{
+  if(effect->adpcm_blocks != NULL){
+    adpcm_decode_block(&effect->adpcm_blocks[n], scratch);
+    return scratch;
+  }
+  return effect->buffers[n].data;
+}
+
+// Input for a voice's resampler: the effect's blocks in order.
+static const int8_t *voice_fetch(void *ctx)
+{
+  voice_t *v = ctx;
+  if(v->position >= v->effect->num_buffers)
+    return NULL;
+  return effect_block(v->effect, v->position++, v->source.data);
+}
+
+// Start a voice for the given effect.
+//  - If the effect is already using all the voices it is allowed,
+//    its oldest voice is restarted (retrigger).
+//  - Otherwise a free voice is used.
+//  - Otherwise the oldest voice with the lowest priority is stolen,
+//    as long as its priority is not higher than the new effect.
+static void voice_start(const effect_param_t *effect)
+{
+  voice_t *victim = NULL;
+  voice_t *oldest_same = NULL;
+  int count = 0;
+
+  for(int i=0; i<NUM_VOICES; i++){
+    voice_t *v = &voices[i];
+    if(v->effect == effect){
+      count++;
+      if(oldest_same == NULL || v->started < oldest_same->started)
+        oldest_same = v;
+    }
+  }
+
+  if(count >= effect->max_voices){
+    victim = oldest_same;
+  }
+  else{
+    for(int i=0; i<NUM_VOICES; i++){
+      voice_t *v = &voices[i];
+      if(v->effect == NULL){
+        victim = v;
+        break;
+      }
+      if(v->effect->priority <= effect->priority &&
+         (victim == NULL ||
+          v->effect->priority < victim->effect->priority ||
+          (v->effect->priority == victim->effect->priority && v->started < victim->started)))
+        victim = v;
+    }
+  }
+
+  if(victim != NULL){
+    victim->effect = effect;
+    victim->position = 0;
+    victim->started = voice_clock++;
+    if(effect->sample_rate != MIXER_FREQ)
+      resampler_init(&victim->resampler, effect->sample_rate, MIXER_FREQ,
+                     voice_fetch, victim);
+  }
+}
+
+// Start a voice for every effect whose event bit is set.
+static void voices_trigger(EventBits_t events)
+{
+  for(int i=0; i<NUM_EFFECTS; i++)
+    if(events & effect_params[i].event)
+      voice_start(&effect_params[i]);
+}
+
+// Fill in one mixer stream for every active voice and advance the
+// voices to their next buffer. Returns the number of streams.
+static int voices_collect(mixer_stream_t *streams)
+{
+  int num_streams = 0;
+
+  for(int i=0; i<NUM_VOICES; i++){
+    voice_t *v = &voices[i];
+    if(v->effect == NULL)
+      continue;
+    streams[num_streams].gain = v->effect->gain;
+    if(v->effect->sample_rate != MIXER_FREQ){
+      streams[num_streams].data = v->decoded.data;
+      if(!resample_block(&v->resampler, v->decoded.data))
+        v->effect = NULL;
+    }
+    else{
+      streams[num_streams].data = effect_block(v->effect, v->position, v->decoded.data);
+      if(++v->position >= v->effect->num_buffers)
+        v->effect = NULL;
+    }
+    num_streams++;
+  }
+  return num_streams;
+}
+
+// define the final audio depth (after the mixer) and sample frequency
+#define DEPTH 10
+#define FREQ  MIXER_FREQ
+
+// Silence is in the middle of the duty cycle range
+#define MIX_BIAS (1 << (DEPTH - 1))
+
+// Create the audio buffers for communication between the mixer and ISR.
+// NUM_MIXER_BUFFERS are used at startup. In adaptive mode the mixer
+// puts more of them into use (up to MAX_MIXER_BUFFERS) after an
+// underrun, and takes them back out (down to MIN_MIXER_BUFFERS) while
+// the mix keeps up, to keep latency low.
+#define NUM_MIXER_BUFFERS 4
+#define MIN_MIXER_BUFFERS 2
+#define MAX_MIXER_BUFFERS 8
+static uint16_t mixer_buffers[MAX_MIXER_BUFFERS][EFFECT_BUFFER_SIZE];
+
+// Number of healthy buffers the mixer must produce in a row before
+// it drops a buffer in adaptive mode (about 8 seconds).
+#define SHRINK_AFTER_BUFFERS 500
+
+static volatile audio_stats_t stats;
+static int adaptive_buffering = 0;
+
+// declare storage for the mixer task. The deepest call chain is
+// effect_mixer_task, effect_mix_block, dsp_process, dsp_biquad_block:
+// 320 bytes by gcc -fstack-usage on a host build, whose frames are
+// usually larger than the M3's. The voice, resampler, ADPCM and synth
+// paths are shallower. The FreeRTOS queue calls and the 64 byte
+// context save come on top, which left 128 words with no margin.
+// stack_free in effect_get_stats() reports what is really left.
+#define MIXER_STACK_SIZE 256
+static TaskHandle_t mixer_task_handle;
+static StackType_t  mixer_stack[MIXER_STACK_SIZE];
+static StaticTask_t mixer_TCB;
+
+// Trigger-to-sound latency measurement. effect_trigger() records the
+// tick of the first trigger that the mixer has not seen yet, the mixer
+// tags the buffer that starts the effect with it, and the ISR works
+// out the latency when it starts playing that buffer.
+#define NO_TRIGGER 0xFFFFFFFF
+static volatile TickType_t pending_trigger = NO_TRIGGER;
+static volatile TickType_t buffer_trigger[MAX_MIXER_BUFFERS];
+
+static inline int buffer_index(const uint16_t *buffer)
+{
+  return (buffer - mixer_buffers[0]) / EFFECT_BUFFER_SIZE;
+}
+
+void effect_trigger(EventBits_t events)
+{
+  if(pending_trigger == NO_TRIGGER)
+    pending_trigger = xTaskGetTickCount();
+  xEventGroupSetBits(effect_events, events);
+}
+
+void effect_get_stats(audio_stats_t *out)
+{
+  taskENTER_CRITICAL();
+  *out = stats;
+  stats.mixer_to_isr_min = stats.mixer_to_isr_depth;
+  stats.mixer_to_isr_max = stats.mixer_to_isr_depth;
+  stats.mix_peak = 0;
+  taskEXIT_CRITICAL();
+  // walks the stack, so it is done outside the critical section
+  out->stack_free = mixer_task_handle != NULL ?
+    uxTaskGetStackHighWaterMark(mixer_task_handle) : 0;
+}
+
+void effect_set_adaptive_buffering(int enable)
+{
+  adaptive_buffering = enable;
+}
+
 // The interrupt handler for the audio pulse modulator
 void audio_handler(BaseType_t *HPTW)
 {
@@ -53,22 +269,35 @@ void audio_handler(BaseType_t *HPTW)
   static int buff_pos = 0;
   static BaseType_t validBuffer = pdFAIL;
 
-  // may need more static variables here
-
   // if buffer == null, then get a buffer from the queue.
-  if (buffer == NULL)
+  if (buffer == NULL){
     validBuffer = xQueueReceiveFromISR(MixerToISRqueue, &buffer, HPTW);
+    if(validBuffer == pdPASS){
+      int index = buffer_index(buffer);
+      if(buffer_trigger[index] != NO_TRIGGER){
+        stats.last_latency_ms = xTaskGetTickCountFromISR() - buffer_trigger[index];
+        if(stats.last_latency_ms > stats.max_latency_ms)
+          stats.max_latency_ms = stats.last_latency_ms;
+        buffer_trigger[index] = NO_TRIGGER;
+      }
+    }
+    else{
+      buffer = NULL;
+      stats.underruns++;
+    }
+  }
 
   // While the PM FIFO is not full,
   //   Transfer a data item from the buffer to the FIFO
   while(PM_FIFO_full(CHANNEL) == 0){
 
     //   You may not have a valid buffer (the mixer may not
-    //   have run yet) In that case, write a zero .
+    //   have run yet, or is running late). In that case, write
+    //   silence.
     if(validBuffer == pdPASS)
       PM_set_duty(CHANNEL,buffer[buff_pos++]);
     else
-      PM_set_duty(CHANNEL, 0);
+      PM_set_duty(CHANNEL, MIX_BIAS);
   
     //   If you send the last item in your current buffer, then send the
     //   pointer back to the mixer and get another buffer from the
@@ -82,31 +311,195 @@ void audio_handler(BaseType_t *HPTW)
   }
 }
 
+static int master_gain = EFFECT_GAIN_UNITY;
 
-// define the final audio depth (after the mixer) and sample frequency
-#define DEPTH 10
-#define FREQ  8000
+// The mixer picks up changes to noise_shaping_request at the start of
+// a block, like the DSP stages below, so the shaper's state is never
+// reset while a block is being quantized.
+static int noise_shaping_request = 0;
+static noise_shaper_t noise_shaper = {0, 0, 0};
 
-// Create the audio buffers for communication between the mixer and ISR
-// Using 4 buffers is only a suggestion.
-#define NUM_MIXER_BUFFERS 4
-static uint16_t mixer_buffers[NUM_MIXER_BUFFERS][EFFECT_BUFFER_SIZE];
+void effect_set_gain(EventBits_t events, int gain)
+{
+  for(int i=0; i<NUM_EFFECTS; i++)
+    if(effect_params[i].event & events)
+      effect_params[i].gain = EFFECT_GAIN_CLAMP(gain);
+}
+
+void effect_set_master_gain(int gain)
+{
+  master_gain = EFFECT_GAIN_CLAMP(gain);
+}
+
+void effect_set_noise_shaping(int order)
+{
+  noise_shaping_request = order;
+}
+
+static void noise_shaper_update()
+{
+  if(noise_shaper.order != noise_shaping_request)
+    noise_shaper_init(&noise_shaper, noise_shaping_request);
+}
+
+// Processing stages for the whole mix. The mixer picks up changes to
+// dsp_request at the start of a block and resets the filters then,
+// so they are never reset part way through a block.
+static int dsp_request = 0;
+static int dsp_stages = 0;
+static int32_t dsp_mix[EFFECT_BUFFER_SIZE];
+static dsp_biquad_t preemphasis_filter;
+static dsp_biquad_state_t preemphasis_state[1];
+static dsp_biquad_t lowpass_filter;
+static dsp_biquad_state_t lowpass_state[1];
+static dsp_fir_t smooth_filter;
+static int32_t smooth_history[DSP_FIR_HISTORY(DSP_SMOOTH_TAPS)];
+
+void effect_set_dsp(int stages)
+{
+  dsp_request = stages;
+}
+
+static void dsp_update()
+{
+  if(dsp_stages == dsp_request)
+    return;
+  dsp_stages = dsp_request;
+  dsp_biquad_init(&preemphasis_filter, dsp_preemphasis, preemphasis_state, 1);
+  dsp_biquad_init(&lowpass_filter, dsp_lowpass, lowpass_state, 1);
+  dsp_fir_init(&smooth_filter, dsp_smooth, DSP_SMOOTH_TAPS, smooth_history);
+  stats.mix_rms = 0;
+  stats.mix_peak = 0;
+}
+
+// Run the selected stages over dsp_mix, then reduce it to the PM
+// depth in out.
+static void dsp_process(uint16_t *out)
+{
+  dsp_meter_t meter;
+
+  if(dsp_stages & EFFECT_DSP_PREEMPHASIS)
+    dsp_biquad_block(&preemphasis_filter, dsp_mix);
+  if(dsp_stages & EFFECT_DSP_LOWPASS)
+    dsp_biquad_block(&lowpass_filter, dsp_mix);
+  if(dsp_stages & EFFECT_DSP_SMOOTH)
+    dsp_fir_block(&smooth_filter, dsp_mix);
+  if(dsp_stages & EFFECT_DSP_METER){
+    dsp_meter_block(dsp_mix, &meter);
+    stats.mix_rms = meter.rms >> NS_FRAC_BITS;
+    if((meter.peak >> NS_FRAC_BITS) > stats.mix_peak)
+      stats.mix_peak = meter.peak >> NS_FRAC_BITS;
+  }
+
+  for(int i=0; i<EFFECT_BUFFER_SIZE; i++){
+    int32_t sample;
+    if(noise_shaper.order == 0)
+      sample = dsp_mix[i] >> NS_FRAC_BITS;
+    else
+      sample = noise_shaper_quantize(&noise_shaper, dsp_mix[i]);
+    out[i] = (uint16_t)(__SSAT(sample, DEPTH) + MIX_BIAS);
+  }
+}
+
+// Scale an accumulated sample by the master gain, clip it to a signed
+// DEPTH-bit value with SSAT, and bias it into the PM duty range.
+static inline uint16_t mix_output(int32_t acc, int32_t master)
+{
+  int32_t sample = ((acc >> 8) * master) >> 8;
+  return (uint16_t)(__SSAT(sample, DEPTH) + MIX_BIAS);
+}
+
+// The same, but keeping the bits below the output resolution for the
+// noise shaper to work with.
+static inline uint16_t mix_output_shaped(int32_t acc, int32_t master)
+{
+  int32_t sample = noise_shaper_quantize(&noise_shaper, (acc * master) >> 8);
+  return (uint16_t)(__SSAT(sample, DEPTH) + MIX_BIAS);
+}
+
+// The Cortex-M3 has no packed SIMD instructions, so we get the same
+// effect by hand: load four samples from each stream with one 32-bit
+// read, keep four 32-bit accumulators, and write four finished output
+// samples per iteration. When DSP stages are selected, the mix is
+// kept at full resolution in dsp_mix and processed as a block.
+void effect_mix_block(uint16_t *out, const mixer_stream_t *streams, int num_streams)
+{
+  int32_t master = master_gain;
+
+  dsp_update();
+  noise_shaper_update();
+
+  for(int i=0; i<EFFECT_BUFFER_SIZE; i+=4){
+    int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+
+    for(int s=0; s<num_streams; s++){
+      uint32_t word;
+      int32_t gain = streams[s].gain;
+      memcpy(&word, &streams[s].data[i], sizeof(word));
+      acc0 += (int32_t)(int8_t)(word)       * gain;
+      acc1 += (int32_t)(int8_t)(word >> 8)  * gain;
+      acc2 += (int32_t)(int8_t)(word >> 16) * gain;
+      acc3 += ((int32_t)word >> 24)         * gain;
+    }
+
+    if(dsp_stages != 0){
+      dsp_mix[i]   = (acc0 * master) >> 8;
+      dsp_mix[i+1] = (acc1 * master) >> 8;
+      dsp_mix[i+2] = (acc2 * master) >> 8;
+      dsp_mix[i+3] = (acc3 * master) >> 8;
+    }
+    else if(noise_shaper.order == 0){
+      out[i]   = mix_output(acc0, master);
+      out[i+1] = mix_output(acc1, master);
+      out[i+2] = mix_output(acc2, master);
+      out[i+3] = mix_output(acc3, master);
+    }
+    else{
+      out[i]   = mix_output_shaped(acc0, master);
+      out[i+1] = mix_output_shaped(acc1, master);
+      out[i+2] = mix_output_shaped(acc2, master);
+      out[i+3] = mix_output_shaped(acc3, master);
+    }
+  }
+
+  if(dsp_stages != 0)
+    dsp_process(out);
+}
+
+#ifdef THEME_MUSIC
+// The whole theme loops, and fades in over about half a second.
+#define THEME_FADE_BUFFERS 32
+static const music_track_t theme_track = {theme_adpcm, NUM_theme_adpcm_BLOCKS, 0, NUM_theme_adpcm_BLOCKS};
+#endif
 
-// The mixer task receives data from the individual effect tasks, and
-// mixes the audio data before sending it to the ISR.
+// The mixer task starts voices for any effects that have been
+// triggered, and mixes the audio data from all active voices before
+// sending it to the ISR.
 static void effect_mixer_task(void *params)
 {
   // Initialization:
   uint16_t *buffer;
-  int8_t *buffer2;
-  static int theme_pos = 0;
+  static mixer_stream_t streams[NUM_VOICES + 3];
+  int num_streams;
+  // buffers that are not currently in use
+  static uint16_t *spare_buffers[MAX_MIXER_BUFFERS];
+  int num_spare = 0;
+  uint32_t underruns_seen = 0;
+  int healthy = 0;
+  int depth;
+  EventBits_t triggered;
 
 
   // Put the pointers to the NUM_MIXER_BUFFERS mixer_buffers in the PM_to_mixer queue
-  for(int i=0; i<NUM_MIXER_BUFFERS; i++){
+  for(int i=0; i<MAX_MIXER_BUFFERS; i++){
+    buffer_trigger[i] = NO_TRIGGER;
     buffer = (uint16_t*)mixer_buffers[i];
-    xQueueSend(ISRToMixerqueue, &buffer, portMAX_DELAY);
+    if(i < NUM_MIXER_BUFFERS)
+      xQueueSend(ISRToMixerqueue, &buffer, portMAX_DELAY);
+    else
+      spare_buffers[num_spare++] = buffer;
   }
+  stats.active_buffers = NUM_MIXER_BUFFERS;
   
   // configure and enable the pulse modulator
   PM_acquire(CHANNEL);
@@ -118,6 +511,10 @@ static void effect_mixer_task(void *params)
   PM_enable(CHANNEL);
   PM_enable_interrupt(CHANNEL);
 
+#ifdef THEME_MUSIC
+  music_play(&theme_track, THEME_FADE_BUFFERS);
+#endif
+
   while (1)
   {
     // Part 1:
@@ -140,92 +537,85 @@ static void effect_mixer_task(void *params)
 
     // Part 2: (comment out part 1)
     //   Get a mixer buffer pointer from the ISR to mixer queue
-    //   Get incoming data pointers from all of the sound effects queues.
-    //   Add all of the incoming data streams and store the results in the mixer buffer. 
+    //   Start voices for any effects that were triggered.
+    //   Add all of the active voices and store the results in the mixer buffer. 
     //   Send the mixer buffer pointer to the mixer to ISR queue
 
     if(xQueueReceive(ISRToMixerqueue, &buffer, portMAX_DELAY) == pdPASS){
-      // Clear the buffer
-      for(int i=0; i<EFFECT_BUFFER_SIZE; i++){
-        buffer[i] = 0;
-      }
-
-      // for each effect, check for available buffer and add them all together
-      for(int i=0; i<NUM_EFFECTS; i++){
-
-        if(xQueueReceive(effect_task_params[i].sendqueue, &buffer2, 0)){
-          for(int j=0; j<EFFECT_BUFFER_SIZE; j++){
-            buffer[j] += (uint16_t)(buffer2[j]);
+      depth = uxQueueMessagesWaiting(ISRToMixerqueue);
+      if(depth > stats.isr_to_mixer_max)
+        stats.isr_to_mixer_max = depth;
+
+      if(adaptive_buffering){
+        if(stats.underruns != underruns_seen){
+          // The ISR ran dry: put another buffer into use. It is
+          // mixed straight away on the next pass.
+          healthy = 0;
+          if(num_spare > 0){
+            xQueueSend(ISRToMixerqueue, &spare_buffers[--num_spare], 0);
+            stats.active_buffers++;
           }
         }
+        else if(++healthy >= SHRINK_AFTER_BUFFERS &&
+                stats.active_buffers > MIN_MIXER_BUFFERS){
+          // The mix has kept up for a while: take this buffer out of
+          // use to cut latency by one buffer.
+          healthy = 0;
+          spare_buffers[num_spare++] = buffer;
+          stats.active_buffers--;
+          continue;
+        }
       }
-      
-      // Add theme
-      // for(int i=0; i<EFFECT_BUFFER_SIZE; i++){
-      //   buffer[i] += (uint16_t)theme[theme_pos].data[i];
-      // }
-      // theme_pos++;
-      // if(theme_pos >= NUM_theme_BUFFERS)
-      //   theme_pos = 0;
-
-      for(int i=0; i<EFFECT_BUFFER_SIZE; i++){
-        buffer[i] += 512;
+      underruns_seen = stats.underruns;
+
+      // Clearing the bits returns the ones that were set, so no
+      // trigger can be lost between the read and the clear.
+      triggered = xEventGroupClearBits(effect_events, ALL_EFFECT_EVENTS);
+      if(triggered & ALL_EFFECT_EVENTS){
+        buffer_trigger[buffer_index(buffer)] = pending_trigger;
+        pending_trigger = NO_TRIGGER;
       }
+      voices_trigger(triggered);
 
-      // Send mixed buff
-      xQueueSend(MixerToISRqueue, &buffer, portMAX_DELAY);
-    }
-  }
-}
-
-
-// Each sound effect is managed by an instance of this task.
-static void effect_task(void *params)
-{
-  // typecast the params pointer so we can access our effect data
-  effect_param_t *my_effect = (effect_param_t*)params;
-  static int8_t* effect_buffer;
+      num_streams = voices_collect(streams);
+      
+      // Add the background music under the effects
+      num_streams += music_collect(&streams[num_streams]);
 
-  static EventBits_t uxBits;
+      // and the synthesizer voices on top
+      num_streams += synth_collect(&streams[num_streams]);
 
-  while(1)
-  {
-    // Block until my event occurs.
-    uxBits = xEventGroupWaitBits(effect_events, my_effect->event, pdTRUE, pdTRUE, portMAX_DELAY);
+      effect_mix_block(buffer, streams, num_streams);
 
-    // loop:
-    //   send pointers to my buffers to my send queue
-    //   until I have sent all of my buffers.
-    if((uxBits & my_effect->event)){
+      // If the ISR has nothing queued, this buffer is (or soon will
+      // be) late.
+      depth = uxQueueMessagesWaiting(MixerToISRqueue);
+      if(depth == 0)
+        stats.late_mixes++;
 
-      for(int i=0; i<my_effect->num_buffers; i++){
-        effect_buffer = my_effect->buffers[i].data;
-        xQueueSend(my_effect->sendqueue, &effect_buffer,portMAX_DELAY);
-      }
+      // Send mixed buff
+      xQueueSend(MixerToISRqueue, &buffer, portMAX_DELAY);
+      depth++;
+      stats.buffers_mixed++;
+      stats.mixer_to_isr_depth = depth;
+      if(depth < stats.mixer_to_isr_min)
+        stats.mixer_to_isr_min = depth;
+      if(depth > stats.mixer_to_isr_max)
+        stats.mixer_to_isr_max = depth;
+
+      // Get the music ready for the next buffer while the ISR plays
+      // this one.
+      music_prefetch();
     }
   }
 }
 
 
-// declare storage for the mixer task
-#define MIXER_STACK_SIZE 128
-static TaskHandle_t mixer_task_handle;
-static StackType_t  mixer_stack[MIXER_STACK_SIZE];
-static StaticTask_t mixer_TCB;
-
-// declare storage for the effect tasks TODO: verify reasonability
-#define EFFECT_STACK_SIZE 64
-static TaskHandle_t effect_handles[NUM_EFFECTS];
-static StackType_t effect_stacks[NUM_EFFECTS][EFFECT_STACK_SIZE];
-static StaticTask_t effect_TCB[NUM_EFFECTS];
-const char* effect_name[] = {"explosion1","fastinvader1","fastinvader2","fastinvader3","fastinvader4",
-                            "invaderkilled","shoot","ufo_highpitch","ufo_lowpitch"};
-
 
 // define storage for the ISR to Mixer and Mixer to ISR queues
 static StaticQueue_t MixerToISRqueue_QCB, ISRToMixerqueue_QCB;
-static uint16_t *MixerToISRqueue_buf[NUM_MIXER_BUFFERS];
-static uint16_t *ISRToMixerqueue_buf[NUM_MIXER_BUFFERS];
+static uint16_t *MixerToISRqueue_buf[MAX_MIXER_BUFFERS];
+static uint16_t *ISRToMixerqueue_buf[MAX_MIXER_BUFFERS];
 
 // #define PART2_STACK_SIZE 256
 // static TaskHandle_t part2_task_handle;
@@ -236,43 +626,30 @@ static uint16_t *ISRToMixerqueue_buf[NUM_MIXER_BUFFERS];
 // {
 //   while(1){
 //     for(int i=0; i<NUM_EFFECTS; i++){
-//       xEventGroupSetBits(effect_events, effect_task_params[i].event);
+//       xEventGroupSetBits(effect_events, effect_params[i].event);
 //       vTaskDelay(pdMS_TO_TICKS( 500 ));
 //     }
 //   }
 
 // }
 
-// sendqueue stuffs
-static StaticQueue_t effectTaskqueue_QCB[NUM_EFFECTS];
-static uint16_t *EffectTaskqueue_buf[NUM_EFFECTS][NUM_MIXER_BUFFERS];
-
+int effect_mixer_running()
+{
+  return mixer_task_handle != NULL;
+}
 
 void effect_init() // main should call this function to set up the sound effects
 {
-  int i;
-  
-  // create all of the queues that will be used by the effects tasks
-  // to send data to the mixer. Store their handles in the
-  // effect_to_mixer_queues array
-  for(i=0; i<NUM_EFFECTS; i++){
-    effect_task_params[i].sendqueue = xQueueCreateStatic(NUM_MIXER_BUFFERS, sizeof(int8_t*), (uint8_t*)EffectTaskqueue_buf[i], &effectTaskqueue_QCB[i]);
-  }
-
   // Create event group
   effect_events = xEventGroupCreate();
 
+  // Create the queue that carries music commands to the mixer
+  music_init();
+
   // create the two queues to communicate between the mixer and the ISR
-  MixerToISRqueue = xQueueCreateStatic(NUM_MIXER_BUFFERS,sizeof(uint16_t*), (uint8_t*)MixerToISRqueue_buf, &MixerToISRqueue_QCB);
-  ISRToMixerqueue = xQueueCreateStatic(NUM_MIXER_BUFFERS,sizeof(uint16_t*), (uint8_t*)ISRToMixerqueue_buf, &ISRToMixerqueue_QCB);
+  MixerToISRqueue = xQueueCreateStatic(MAX_MIXER_BUFFERS,sizeof(uint16_t*), (uint8_t*)MixerToISRqueue_buf, &MixerToISRqueue_QCB);
+  ISRToMixerqueue = xQueueCreateStatic(MAX_MIXER_BUFFERS,sizeof(uint16_t*), (uint8_t*)ISRToMixerqueue_buf, &ISRToMixerqueue_QCB);
   
-  // create all of the effect tasks, giving them each a unique queue handle and
-  // other parameters (effect_params)
-  for(i=0; i<NUM_EFFECTS; i++){  
-    effect_handles[i] = xTaskCreateStatic(effect_task, effect_name[i], EFFECT_STACK_SIZE,
-                        &effect_task_params[i], 6, effect_stacks[i], &effect_TCB[i]);
-  }
-
   // // create the mixer task
   mixer_task_handle = xTaskCreateStatic(effect_mixer_task, "mixer task", MIXER_STACK_SIZE, 
     NULL,6,mixer_stack,&mixer_TCB);	
@@ -17,12 +17,98 @@
 #define FASTINVADER2_EVENT  0x040
 #define FASTINVADER3_EVENT  0x080
 #define FASTINVADER4_EVENT  0x100
+#define ALL_EFFECT_EVENTS   0x1FF
+
+// The maximum number of effects that can play at the same time.
+#define NUM_VOICES 6
+
+// Sample rate of the mixer output.
+#define MIXER_FREQ 8000
 
 // When it is time to play a sound effect, signal the appropriate
-// event on this event group.
+// event on this event group, preferably through effect_trigger().
 extern EventGroupHandle_t effect_events;
 
+// Trigger the sound effect(s) for the given event bit(s). This sets
+// the bits in effect_events and also time stamps the trigger so that
+// the trigger-to-sound latency shows up in the audio statistics.
+void effect_trigger(EventBits_t events);
+
 // main must call this function to initialize all of the sound effects
 void effect_init();
 
+// Returns non-zero once effect_init() has started the mixer task.
+int effect_mixer_running();
+
+// Gains are fixed point with 8 fractional bits, so EFFECT_GAIN_UNITY
+// plays a stream at its recorded level.
+#define EFFECT_GAIN_UNITY 256
+
+// The gain setters (here, in music.h and in synth.h) clamp their gain
+// to 0 .. EFFECT_GAIN_MAX. With all NUM_VOICES + 3 streams at full
+// scale and at this gain, the mix times a master gain of this size
+// still fits in 32 bits, which the DSP and noise shaping paths need.
+#define EFFECT_GAIN_MAX (4 * EFFECT_GAIN_UNITY)
+#define EFFECT_GAIN_CLAMP(gain) \
+  ((gain) < 0 ? 0 : (gain) > EFFECT_GAIN_MAX ? EFFECT_GAIN_MAX : (gain))
+
+// Set the gain for the sound effect(s) triggered by the given event
+// bit(s).
+void effect_set_gain(EventBits_t events, int gain);
+
+// Set the gain applied to the whole mix before it is clipped.
+void effect_set_master_gain(int gain);
+
+// Select the quantizer that takes the mix down to the PM depth: 0 (the
+// default) drops the extra bits, 1 or 2 uses first or second order
+// noise shaping, which pushes the quantization noise up towards 4 kHz
+// (see noise_shaper.h).
+void effect_set_noise_shaping(int order);
+
+// Processing stages that can be applied to the whole mix (see dsp.h).
+// Any combination may be selected with effect_set_dsp(); they run in
+// the order listed, before the mix is reduced to the PM depth.
+#define EFFECT_DSP_PREEMPHASIS 0x01 // boost the highs the RC filter loses
+#define EFFECT_DSP_LOWPASS     0x02 // biquad low-pass at 3 kHz
+#define EFFECT_DSP_SMOOTH      0x04 // FIR low-pass, gentler than LOWPASS
+#define EFFECT_DSP_METER       0x08 // measure the mix for effect_get_stats
+void effect_set_dsp(int stages);
+
+// Audio pipeline statistics. Depths are numbers of buffers waiting
+// in the queue; latencies are in ticks (milliseconds).
+typedef struct{
+  uint32_t underruns;      // times the ISR found no mixed buffer waiting
+  uint32_t late_mixes;     // buffers mixed after the ISR queue had run dry
+  uint32_t buffers_mixed;
+  int mixer_to_isr_depth;  // MixerToISRqueue after the last mix
+  int mixer_to_isr_min;    // since the last call to effect_get_stats
+  int mixer_to_isr_max;    // since the last call to effect_get_stats
+  int isr_to_mixer_max;    // worst backlog of buffers waiting to be mixed
+  int active_buffers;      // mixer buffers currently in use
+  uint32_t last_latency_ms;
+  uint32_t max_latency_ms;
+  int32_t mix_rms;         // level of the last buffer, in output steps
+  int32_t mix_peak;        // since the last call to effect_get_stats
+  uint32_t stack_free;     // mixer stack words never used so far
+}audio_stats_t;
+
+// Copy the current statistics into stats.
+void effect_get_stats(audio_stats_t *stats);
+
+// In adaptive mode the mixer uses more buffers after an underrun and
+// fewer when the mix keeps up, trading latency for safety as needed.
+void effect_set_adaptive_buffering(int enable);
+
+// One input to the mixer: a block of EFFECT_BUFFER_SIZE samples and
+// the gain to apply to it.
+typedef struct{
+  const int8_t *data;
+  int gain;
+}mixer_stream_t;
+
+// Mix num_streams blocks into out in a single pass. Each output
+// sample is scaled by the master gain, saturated to the PM depth and
+// biased so that silence sits in the middle of the duty cycle range.
+void effect_mix_block(uint16_t *out, const mixer_stream_t *streams, int num_streams);
+
 #endif
@@ -6,13 +6,16 @@
 // Define a struct that holds some samples of audio
 // data.  Doing it this way simplifies other parts of
 // the code. A sound effect can be defined as an array
-// of effect buffers
+// of effect buffers. The buffers are word aligned so that the mixer
+// can fetch four samples with a single load.
 #define EFFECT_BUFFER_SIZE 128
 typedef struct{
   int8_t data[EFFECT_BUFFER_SIZE];
-}effect_buffer;
+}__attribute__((aligned(4))) effect_buffer;
 
-// Now define all of the sound effects;
+// Now define all of the sound effects; they were all recorded at
+// this sample rate.
+#define SOUNDS_RATE 8000
 
 #define NUM_explosion1_BUFFERS 	57
 extern effect_buffer explosion1[NUM_explosion1_BUFFERS];
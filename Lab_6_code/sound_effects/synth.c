@@ -0,0 +1,202 @@
+#include <sounds.h>
+#include <synth.h>
+#include <task.h>
+
+// Phase accumulator increment for 1 Hz at the mixer sample rate.
+#define PHASE_PER_HZ ((uint32_t)(4294967296ULL / MIXER_FREQ))
+
+// Envelope levels are kept with 24 fractional bits so that slow
+// attacks and releases still move by at least one step per sample.
+#define ENV_SHIFT 24
+#define ENV_MAX   (1 << ENV_SHIFT)
+
+// One period of a sine wave, indexed by the top 8 bits of the phase.
+static const int8_t sine_table[256] = {
+     0,    3,    6,    9,   12,   16,   19,   22,   25,   28,   31,   34,   37,   40,   43,   46,
+    49,   51,   54,   57,   60,   63,   65,   68,   71,   73,   76,   78,   81,   83,   85,   88,
+    90,   92,   94,   96,   98,  100,  102,  104,  106,  107,  109,  111,  112,  113,  115,  116,
+   117,  118,  120,  121,  122,  122,  123,  124,  125,  125,  126,  126,  126,  127,  127,  127,
+   127,  127,  127,  127,  126,  126,  126,  125,  125,  124,  123,  122,  122,  121,  120,  118,
+   117,  116,  115,  113,  112,  111,  109,  107,  106,  104,  102,  100,   98,   96,   94,   92,
+    90,   88,   85,   83,   81,   78,   76,   73,   71,   68,   65,   63,   60,   57,   54,   51,
+    49,   46,   43,   40,   37,   34,   31,   28,   25,   22,   19,   16,   12,    9,    6,    3,
+     0,   -3,   -6,   -9,  -12,  -16,  -19,  -22,  -25,  -28,  -31,  -34,  -37,  -40,  -43,  -46,
+   -49,  -51,  -54,  -57,  -60,  -63,  -65,  -68,  -71,  -73,  -76,  -78,  -81,  -83,  -85,  -88,
+   -90,  -92,  -94,  -96,  -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+  -117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+  -127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+  -117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100,  -98,  -96,  -94,  -92,
+   -90,  -88,  -85,  -83,  -81,  -78,  -76,  -73,  -71,  -68,  -65,  -63,  -60,  -57,  -54,  -51,
+   -49,  -46,  -43,  -40,  -37,  -34,  -31,  -28,  -25,  -22,  -19,  -16,  -12,   -9,   -6,   -3,
+};
+
+typedef enum{
+  ENV_OFF,
+  ENV_ATTACK,
+  ENV_DECAY,
+  ENV_SUSTAIN,
+  ENV_RELEASE
+}env_stage_t;
+
+typedef struct{
+  synth_waveform_t waveform;
+  uint32_t phase;
+  uint32_t phase_inc;
+  int amplitude;
+  uint16_t lfsr;       // noise generator state
+  int8_t noise;        // current noise output
+  env_stage_t stage;
+  int32_t level;       // envelope level, 0 to ENV_MAX
+  int32_t attack_inc;  // per sample changes in level
+  int32_t decay_dec;
+  int32_t sustain_level;
+  int32_t release_dec;
+}synth_voice_t;
+
+static synth_voice_t voices[SYNTH_VOICES];
+static int synth_gain = EFFECT_GAIN_UNITY;
+
+// Change in envelope level per sample to cover the full range in ms
+// milliseconds. 0 means the stage is skipped.
+static int32_t env_rate(int ms)
+{
+  int32_t samples = ms * (MIXER_FREQ / 1000);
+  if(samples <= 0)
+    return ENV_MAX;
+  return ENV_MAX / samples;
+}
+
+void synth_note_on(int voice, synth_waveform_t waveform, int freq_hz,
+                   int amplitude, const synth_envelope_t *envelope)
+{
+  synth_voice_t *v;
+
+  if(voice < 0 || voice >= SYNTH_VOICES)
+    return;
+  v = &voices[voice];
+
+  // The mixer task may be rendering this voice, so update it in one go.
+  taskENTER_CRITICAL();
+  v->waveform = waveform;
+  v->phase = 0;
+  v->phase_inc = freq_hz * PHASE_PER_HZ;
+  v->amplitude = amplitude;
+  if(v->lfsr == 0)
+    v->lfsr = 0xACE1;
+  v->attack_inc = env_rate(envelope->attack_ms);
+  v->decay_dec = env_rate(envelope->decay_ms);
+  v->sustain_level = envelope->sustain << (ENV_SHIFT - 8);
+  v->release_dec = env_rate(envelope->release_ms);
+  v->level = 0;
+  v->stage = ENV_ATTACK;
+  taskEXIT_CRITICAL();
+}
+
+void synth_set_freq(int voice, int freq_hz)
+{
+  if(voice >= 0 && voice < SYNTH_VOICES)
+    voices[voice].phase_inc = freq_hz * PHASE_PER_HZ;
+}
+
+void synth_note_off(int voice)
+{
+  if(voice >= 0 && voice < SYNTH_VOICES && voices[voice].stage != ENV_OFF)
+    voices[voice].stage = ENV_RELEASE;
+}
+
+void synth_set_gain(int gain)
+{
+  synth_gain = EFFECT_GAIN_CLAMP(gain);
+}
+
+// Advance the envelope by one sample and return the new level.
+static inline int32_t env_step(synth_voice_t *v)
+{
+  switch(v->stage){
+  case ENV_ATTACK:
+    v->level += v->attack_inc;
+    if(v->level >= ENV_MAX){
+      v->level = ENV_MAX;
+      v->stage = ENV_DECAY;
+    }
+    break;
+  case ENV_DECAY:
+    v->level -= v->decay_dec;
+    if(v->level <= v->sustain_level){
+      v->level = v->sustain_level;
+      v->stage = ENV_SUSTAIN;
+    }
+    break;
+  case ENV_RELEASE:
+    v->level -= v->release_dec;
+    if(v->level <= 0){
+      v->level = 0;
+      v->stage = ENV_OFF;
+    }
+    break;
+  default:
+    break;
+  }
+  return v->level;
+}
+
+// Current output of the oscillator, -127 to 127.
+static inline int32_t osc_sample(synth_voice_t *v)
+{
+  switch(v->waveform){
+  case SYNTH_SINE:
+    return sine_table[v->phase >> 24];
+  case SYNTH_SQUARE:
+    return (v->phase & 0x80000000) ? -127 : 127;
+  case SYNTH_SAW:
+    return (int8_t)(v->phase >> 24);
+  default:
+    return v->noise;
+  }
+}
+
+// Add one block of a voice into acc.
+static void voice_render(synth_voice_t *v, int16_t *acc)
+{
+  uint32_t old_phase;
+
+  for(int i=0; i<EFFECT_BUFFER_SIZE; i++){
+    int32_t env = env_step(v) >> (ENV_SHIFT - 8);
+    acc[i] += (osc_sample(v) * v->amplitude * env) >> 16;
+
+    old_phase = v->phase;
+    v->phase += v->phase_inc;
+    // Noise picks a new value once per period, so its frequency sets
+    // the pitch of the noise.
+    if(v->waveform == SYNTH_NOISE && v->phase < old_phase){
+      v->lfsr = (v->lfsr >> 1) ^ (-(v->lfsr & 1u) & 0xB400u);
+      v->noise = (int8_t)v->lfsr;
+    }
+  }
+}
+
+int synth_collect(mixer_stream_t *stream)
+{
+  static effect_buffer out;
+  static int16_t acc[EFFECT_BUFFER_SIZE];
+  int sounding = 0;
+
+  for(int i=0; i<EFFECT_BUFFER_SIZE; i++)
+    acc[i] = 0;
+
+  for(int n=0; n<SYNTH_VOICES; n++){
+    if(voices[n].stage == ENV_OFF)
+      continue;
+    voice_render(&voices[n], acc);
+    sounding = 1;
+  }
+  if(!sounding)
+    return 0;
+
+  for(int i=0; i<EFFECT_BUFFER_SIZE; i++)
+    out.data[i] = (int8_t)__SSAT(acc[i], 8);
+
+  stream->data = out.data;
+  stream->gain = synth_gain;
+  return 1;
+}
@@ -0,0 +1,53 @@
+#ifndef SYNTH_H
+#define SYNTH_H
+
+#include <FreeRTOS.h>
+#include <sound_effects.h>
+
+// A small DDS synthesizer. Each voice has a 32 bit phase accumulator
+// that is advanced once per sample, and the top bits of the phase pick
+// the output of the selected waveform. Frequencies can change while a
+// note is playing, so tones can follow the game (the UFO pitch follows
+// its position, for instance). The mixer renders all voices into one
+// block per buffer and plays it with the effects.
+#define SYNTH_VOICES 4
+
+typedef enum{
+  SYNTH_SINE,
+  SYNTH_SQUARE,
+  SYNTH_SAW,
+  SYNTH_NOISE
+}synth_waveform_t;
+
+// ADSR envelope. Times are in milliseconds and sustain is the level
+// held after the decay (0 to 255, where 255 is the note amplitude).
+typedef struct{
+  int attack_ms;
+  int decay_ms;
+  int sustain;
+  int release_ms;
+}synth_envelope_t;
+
+// Start a note on voice. amplitude is 0 to 255. The envelope is
+// copied, so it does not have to outlive the call.
+void synth_note_on(int voice, synth_waveform_t waveform, int freq_hz,
+                   int amplitude, const synth_envelope_t *envelope);
+
+// Change the frequency of a voice without restarting its envelope.
+void synth_set_freq(int voice, int freq_hz);
+
+// Start the release phase of the note on voice.
+void synth_note_off(int voice);
+
+// Set the level of the synth relative to the effects
+// (EFFECT_GAIN_UNITY is full level).
+void synth_set_gain(int gain);
+
+// The following is called by the mixer task only.
+
+// Render the next EFFECT_BUFFER_SIZE samples of all voices into
+// stream. Returns 0 when no voice is sounding, so the mixer can skip
+// the synth.
+int synth_collect(mixer_stream_t *stream);
+
+#endif
@@ -0,0 +1,1012 @@
+#include <ufo_lowpitch_adpcm.h>
+
+const adpcm_block ufo_lowpitch_adpcm[NUM_ufo_lowpitch_adpcm_BLOCKS] = {
+  {0, 0, 0, {
+    0xFF, 0xFF, 0xFE, 0xA3, 0x7B, 0x09, 0x08, 0xA4, 0x81, 0x91, 0xC8, 0x89, 0x52, 0x19, 0x2A, 0x2A,
+    0x3A, 0x48, 0x3B, 0x8B, 0x1F, 0x2A, 0x38, 0x0B, 0xD7, 0x19, 0x21, 0x2A, 0x38, 0x3B, 0xFB, 0xA8,
+    0x97, 0x91, 0x93, 0x2A, 0x0A, 0xF2, 0x18, 0x24, 0x1F, 0x29, 0x2C, 0xA0, 0x83, 0x08, 0x12, 0x9B,
+    0xC8, 0xC7, 0x81, 0x10, 0x09, 0x7B, 0x90, 0x1A, 0x08, 0x28, 0x2E, 0x10, 0xF1, 0x82, 0x90, 0x39	}
+	},
+  {-34, 52, 0, {
+    0x88, 0x1B, 0x81, 0x82, 0xA2, 0xB2, 0xB0, 0xC0, 0x83, 0xB4, 0xB3, 0x84, 0x40, 0x3B, 0x3C, 0x1F,
+    0x29, 0x3B, 0xB8, 0xB4, 0x03, 0xFF, 0x82, 0x11, 0x98, 0x99, 0x61, 0x9A, 0x97, 0x19, 0x3D, 0x88,
+    0x40, 0x0A, 0xC9, 0x95, 0x18, 0xA1, 0xE2, 0x91, 0xA4, 0x11, 0x1C, 0xB0, 0x42, 0x5A, 0x0D, 0x88,
+    0x11, 0x6A, 0x9A, 0xA1, 0x02, 0x81, 0xF2, 0xA1, 0x01, 0x20, 0xF4, 0x80, 0x10, 0x6B, 0x98, 0x2B	}
+	},
+  {-1144, 62, 0, {
+    0x28, 0x29, 0xF2, 0xA1, 0x81, 0x03, 0xF3, 0x09, 0x59, 0x6B, 0xA9, 0x91, 0x81, 0x31, 0xBB, 0x08,
+    0x01, 0x35, 0x9F, 0x81, 0x80, 0x86, 0x1D, 0x08, 0x10, 0xD3, 0x09, 0x28, 0x69, 0xD8, 0x91, 0x01,
+    0x31, 0x8F, 0x00, 0x00, 0xB3, 0x1B, 0x18, 0x70, 0xC9, 0x00, 0x91, 0x86, 0x0C, 0x18, 0x38, 0xF1,
+    0x80, 0x81, 0x22, 0x0E, 0x19, 0x20, 0xE1, 0x08, 0x81, 0x03, 0x0E, 0x18, 0x38, 0xE0, 0x80, 0x00	}
+	},
+  {-2208, 75, 0, {
+    0x13, 0x8F, 0x10, 0x28, 0xD1, 0x88, 0x01, 0x42, 0x8E, 0x08, 0x01, 0xB4, 0x8A, 0x20, 0x60, 0xBA,
+    0x08, 0x01, 0x86, 0x8C, 0x18, 0x30, 0xE4, 0x09, 0x18, 0x40, 0xD8, 0x08, 0x01, 0x31, 0xAD, 0x00,
+    0x01, 0x85, 0x8D, 0x18, 0x20, 0xB4, 0x8C, 0x10, 0x21, 0xC4, 0x0C, 0x10, 0x40, 0xE1, 0x89, 0x10,
+    0x31, 0xE1, 0x0A, 0x10, 0x41, 0xE0, 0x09, 0x10, 0x30, 0xE1, 0x0A, 0x10, 0x31, 0xE2, 0x8B, 0x11	}
+	},
+  {-5824, 80, 0, {
+    0x31, 0xB4, 0x8F, 0x10, 0x10, 0x83, 0xAE, 0x10, 0x01, 0x14, 0xEB, 0x08, 0x11, 0x31, 0xF0, 0x0A,
+    0x10, 0x21, 0x92, 0x9F, 0x10, 0x10, 0x22, 0xFB, 0x09, 0x02, 0x31, 0xB1, 0x9F, 0x10, 0x11, 0x13,
+    0xFB, 0x09, 0x11, 0x21, 0xA2, 0xAF, 0x10, 0x11, 0x22, 0xF0, 0x8B, 0x21, 0x21, 0x12, 0xCD, 0x0A,
+    0x22, 0x31, 0x82, 0xCF, 0x08, 0x12, 0x12, 0xA2, 0xAF, 0x18, 0x21, 0x22, 0x90, 0xBF, 0x18, 0x12	}
+	},
+  {-1246, 82, 0, {
+    0x23, 0x91, 0xCF, 0x08, 0x12, 0x22, 0x81, 0xCD, 0x0A, 0x22, 0x31, 0x02, 0xFA, 0x8C, 0x20, 0x22,
+    0x02, 0xC0, 0x9F, 0x18, 0x12, 0x22, 0x91, 0xEC, 0x89, 0x21, 0x22, 0x12, 0xC9, 0x9F, 0x08, 0x22,
+    0x22, 0x81, 0xFA, 0x9B, 0x10, 0x33, 0x23, 0x88, 0xED, 0x8A, 0x28, 0x33, 0x13, 0x88, 0xED, 0x8A,
+    0x20, 0x32, 0x23, 0x98, 0xFB, 0x9C, 0x00, 0x14, 0x13, 0x80, 0xC9, 0xAD, 0x88, 0x42, 0x32, 0x01	}
+	},
+  {28878, 78, 0, {
+    0x99, 0xDD, 0x8A, 0x18, 0x34, 0x22, 0x90, 0xB9, 0xCE, 0x89, 0x30, 0x34, 0x12, 0xA0, 0xAA, 0xCF,
+    0x88, 0x20, 0x24, 0x13, 0x98, 0x9A, 0xCE, 0x89, 0x10, 0x43, 0x33, 0x80, 0xAA, 0xDB, 0x9E, 0x08,
+    0x31, 0x34, 0x12, 0xA8, 0xAA, 0xFB, 0x9B, 0x18, 0x23, 0x36, 0x02, 0xA8, 0xB9, 0xE9, 0x9C, 0x08,
+    0x22, 0x72, 0x12, 0x88, 0xA9, 0x99, 0xFB, 0x89, 0x10, 0x12, 0x63, 0x02, 0x98, 0xA9, 0xA9, 0xFA	}
+	},
+  {-16363, 79, 0, {
+    0x99, 0x20, 0x21, 0x52, 0x33, 0x90, 0xBA, 0xBA, 0xA9, 0xBF, 0x0B, 0x31, 0x33, 0x44, 0x26, 0x90,
+    0xA9, 0xAA, 0x8A, 0xD9, 0x9D, 0x28, 0x22, 0x31, 0x62, 0x23, 0xA0, 0xBA, 0xAB, 0xB9, 0x89, 0xDF,
+    0x89, 0x21, 0x23, 0x12, 0x34, 0x17, 0x88, 0xAA, 0xAA, 0x99, 0x90, 0xA9, 0xCF, 0x08, 0x22, 0x32,
+    0x02, 0x22, 0x37, 0x82, 0xB9, 0x8D, 0x9A, 0x99, 0x88, 0x90, 0xF9, 0x9D, 0x20, 0x21, 0x33, 0x30	}
+	},
+  {1468, 61, 0, {
+    0x00, 0x42, 0x27, 0x90, 0xAA, 0x9B, 0xBB, 0xA0, 0x19, 0x0B, 0x29, 0x8D, 0xFE, 0x99, 0x22, 0x22,
+    0x32, 0x20, 0x10, 0x91, 0x49, 0x72, 0x14, 0xA0, 0xAA, 0xCA, 0x89, 0x8C, 0x90, 0xA8, 0xA2, 0x80,
+    0xB8, 0x5A, 0x89, 0x2F, 0x98, 0xEA, 0x1A, 0x24, 0x12, 0x23, 0x12, 0x92, 0x48, 0x09, 0x05, 0x89,
+    0xA5, 0x10, 0x72, 0x05, 0xA9, 0xC9, 0x9A, 0x8A, 0x1A, 0x1C, 0x0B, 0x99, 0xA1, 0xF3, 0x00, 0x09	}
+	},
+  {-4801, 53, 0, {
+    0xFF, 0x08, 0x02, 0x13, 0x12, 0x02, 0x30, 0x4D, 0x30, 0x26, 0x89, 0xB9, 0xAA, 0xB9, 0x0B, 0x98,
+    0xA8, 0x08, 0xFF, 0x9C, 0x10, 0x32, 0x41, 0x10, 0x21, 0x53, 0x25, 0xB0, 0x9B, 0xBB, 0xA9, 0x99,
+    0x8A, 0xFC, 0x9F, 0x00, 0x22, 0x31, 0x20, 0x72, 0x04, 0x90, 0xAA, 0xA9, 0xA9, 0xA8, 0xF0, 0x8F,
+    0x00, 0x21, 0x20, 0x31, 0x35, 0x81, 0xBA, 0xBA, 0xC9, 0x09, 0xDE, 0x8A, 0x21, 0x22, 0x42, 0x45	}
+	},
+  {14771, 74, 0, {
+    0x01, 0xA9, 0xAA, 0xAA, 0xC8, 0xAF, 0x08, 0x31, 0x12, 0x55, 0x12, 0x99, 0xA9, 0xAA, 0xF9, 0x9B,
+    0x29, 0x22, 0x62, 0x34, 0x81, 0xB9, 0xAA, 0xBA, 0xCF, 0x08, 0x21, 0x42, 0x25, 0x81, 0xA9, 0xAA,
+    0xEA, 0x9C, 0x10, 0x12, 0x64, 0x11, 0x98, 0xA9, 0xD8, 0xAB, 0x08, 0x31, 0x74, 0x11, 0x90, 0xA9,
+    0xC9, 0x9C, 0x08, 0x22, 0x36, 0x02, 0xA8, 0x9A, 0xCE, 0x89, 0x10, 0x72, 0x02, 0x80, 0x99, 0xCA	}
+	},
+  {-9928, 79, 0, {
+    0x8C, 0x18, 0x42, 0x15, 0x80, 0x99, 0xDA, 0xAA, 0x10, 0x53, 0x14, 0x80, 0x99, 0xCD, 0x89, 0x01,
+    0x44, 0x02, 0x98, 0xB9, 0xAE, 0x08, 0x41, 0x24, 0x00, 0x9A, 0xBD, 0x8A, 0x21, 0x27, 0x01, 0x89,
+    0xEB, 0x99, 0x10, 0x34, 0x12, 0x99, 0xDC, 0x8A, 0x10, 0x35, 0x01, 0x98, 0xDC, 0x89, 0x20, 0x25,
+    0x00, 0xA8, 0xAE, 0x88, 0x51, 0x12, 0x80, 0xD9, 0x9B, 0x00, 0x35, 0x01, 0x98, 0xAE, 0x89, 0x51	}
+	},
+  {299, 86, 0, {
+    0x12, 0x80, 0xEA, 0x99, 0x20, 0x24, 0x00, 0xC9, 0x9C, 0x18, 0x34, 0x02, 0xA9, 0xAF, 0x08, 0x43,
+    0x11, 0xA8, 0xAD, 0x89, 0x63, 0x11, 0xA8, 0xAC, 0x09, 0x53, 0x02, 0xA8, 0xAE, 0x08, 0x24, 0x02,
+    0xB9, 0x9E, 0x28, 0x14, 0x01, 0xDA, 0x9A, 0x40, 0x23, 0x90, 0xBD, 0x89, 0x63, 0x11, 0xB9, 0x9C,
+    0x28, 0x25, 0x81, 0xCC, 0x89, 0x42, 0x02, 0xC0, 0x9C, 0x28, 0x24, 0x80, 0xBC, 0x89, 0x44, 0x01	}
+	},
+  {28865, 84, 0, {
+    0xD9, 0x8A, 0x40, 0x13, 0xB8, 0xAD, 0x28, 0x15, 0x91, 0xAC, 0x09, 0x25, 0x81, 0xCB, 0x8A, 0x34,
+    0x12, 0xEB, 0x8A, 0x42, 0x12, 0xE9, 0x8A, 0x41, 0x02, 0xC8, 0x9B, 0x51, 0x12, 0xC9, 0x9B, 0x51,
+    0x12, 0xD9, 0x8A, 0x41, 0x12, 0xCA, 0x9A, 0x43, 0x12, 0xEB, 0x89, 0x33, 0x02, 0xBD, 0x1A, 0x25,
+    0x91, 0xAD, 0x28, 0x14, 0xB1, 0x9D, 0x40, 0x12, 0xC9, 0x9A, 0x43, 0x11, 0xCC, 0x19, 0x33, 0xB1	}
+	},
+  {14235, 82, 0, {
+    0x9E, 0x48, 0x12, 0xD8, 0x8A, 0x33, 0x82, 0xBD, 0x39, 0x15, 0xC0, 0x9B, 0x52, 0x01, 0xCB, 0x29,
+    0x14, 0xC1, 0x9B, 0x42, 0x02, 0xBC, 0x2A, 0x16, 0xC0, 0x9A, 0x42, 0x01, 0xBC, 0x28, 0x24, 0xC0,
+    0x8C, 0x41, 0x01, 0xBB, 0x1A, 0x16, 0xA1, 0xAC, 0x40, 0x22, 0xD9, 0x8A, 0x43, 0x81, 0xBC, 0x18,
+    0x15, 0xB1, 0x9C, 0x40, 0x12, 0xD9, 0x8A, 0x42, 0x82, 0xCB, 0x09, 0x25, 0x80, 0xBC, 0x28, 0x24	}
+	},
+  {25232, 85, 0, {
+    0xA0, 0xAD, 0x30, 0x14, 0xC0, 0xAB, 0x41, 0x13, 0xD8, 0x9B, 0x51, 0x12, 0xC9, 0x9B, 0x52, 0x11,
+    0xC9, 0x8B, 0x51, 0x02, 0xD8, 0x8A, 0x31, 0x13, 0xE8, 0x9A, 0x40, 0x03, 0xC0, 0xAB, 0x40, 0x23,
+    0xB1, 0xAF, 0x28, 0x33, 0x91, 0xAE, 0x09, 0x43, 0x01, 0xDA, 0x8A, 0x51, 0x02, 0xC0, 0x9B, 0x38,
+    0x24, 0x91, 0xBD, 0x89, 0x35, 0x01, 0xD9, 0x9A, 0x40, 0x13, 0x90, 0xBD, 0x09, 0x44, 0x01, 0xC9	}
+	},
+  {-2013, 85, 0, {
+    0x9B, 0x30, 0x25, 0x80, 0xBC, 0x9A, 0x53, 0x13, 0xA8, 0xAE, 0x09, 0x34, 0x11, 0xC9, 0x9C, 0x18,
+    0x25, 0x81, 0xC9, 0x9B, 0x38, 0x16, 0x81, 0xC9, 0x9B, 0x30, 0x25, 0x81, 0xCA, 0x9C, 0x38, 0x25,
+    0x00, 0xC9, 0x9C, 0x28, 0x24, 0x01, 0xB8, 0xBD, 0x08, 0x63, 0x02, 0x88, 0xBC, 0x9A, 0x42, 0x24,
+    0x80, 0xD9, 0xAB, 0x28, 0x44, 0x02, 0x89, 0xBD, 0x99, 0x41, 0x24, 0x80, 0xC8, 0x9C, 0x09, 0x52	}
+	},
+  {1675, 83, 0, {
+    0x22, 0x88, 0xE9, 0x9A, 0x08, 0x53, 0x12, 0x98, 0xD9, 0x9B, 0x18, 0x63, 0x12, 0x98, 0xC9, 0x9C,
+    0x08, 0x52, 0x13, 0x90, 0xA9, 0xAE, 0x89, 0x22, 0x26, 0x00, 0x89, 0xDB, 0x9A, 0x10, 0x63, 0x12,
+    0x98, 0x99, 0xBD, 0x89, 0x21, 0x45, 0x11, 0x99, 0xA9, 0x9F, 0x88, 0x11, 0x34, 0x02, 0xA8, 0xB9,
+    0xBE, 0x09, 0x21, 0x73, 0x12, 0x98, 0x9A, 0xEA, 0x99, 0x10, 0x31, 0x17, 0x00, 0x89, 0x9A, 0xBC	}
+	},
+  {-17271, 76, 0, {
+    0x0A, 0x21, 0x62, 0x14, 0x80, 0xA9, 0x99, 0xBD, 0x0A, 0x20, 0x33, 0x37, 0x81, 0x99, 0xAA, 0xE9,
+    0xAB, 0x10, 0x22, 0x54, 0x14, 0x98, 0x99, 0x9A, 0xDA, 0x8C, 0x18, 0x32, 0x51, 0x15, 0x90, 0x99,
+    0x9A, 0x99, 0xBE, 0x08, 0x21, 0x23, 0x72, 0x13, 0x98, 0xAA, 0x9A, 0x9B, 0xBD, 0x8C, 0x21, 0x14,
+    0x23, 0x27, 0x82, 0xA9, 0xAA, 0x9A, 0x9A, 0xFB, 0x9B, 0x31, 0x42, 0x12, 0x63, 0x23, 0x98, 0xCA	}
+	},
+  {6126, 66, 0, {
+    0x9A, 0xB9, 0xB1, 0xF0, 0x9C, 0x28, 0x41, 0x20, 0x02, 0x63, 0x13, 0x99, 0xCA, 0x9A, 0xA9, 0x98,
+    0x91, 0xFA, 0x8E, 0x10, 0x31, 0x02, 0x21, 0x11, 0x54, 0x83, 0xA8, 0xAC, 0xAA, 0x99, 0x88, 0x9A,
+    0xE3, 0xA2, 0xBF, 0x2A, 0x22, 0x32, 0x23, 0x84, 0x11, 0x88, 0x56, 0x03, 0xB9, 0xA9, 0xDB, 0x99,
+    0xA1, 0x08, 0x3B, 0xAA, 0x11, 0x0F, 0x01, 0xDE, 0x99, 0x22, 0x04, 0x22, 0x11, 0x21, 0x8A, 0x96	}
+	},
+  {1843, 57, 0, {
+    0x29, 0x39, 0xB0, 0x72, 0x01, 0xA6, 0x8A, 0x9B, 0x8A, 0xB9, 0x01, 0x8A, 0x99, 0x0B, 0x98, 0x2F,
+    0x98, 0x00, 0x81, 0x19, 0xFF, 0x9D, 0x03, 0x14, 0x13, 0x21, 0x00, 0x11, 0x59, 0x28, 0x75, 0x01,
+    0xB9, 0x8B, 0x0C, 0x8C, 0xB0, 0x90, 0xB2, 0x92, 0xCA, 0xDF, 0x08, 0x21, 0x41, 0x21, 0x00, 0x92,
+    0x66, 0x01, 0x89, 0xB9, 0x9A, 0xB8, 0x88, 0xE1, 0x81, 0xBF, 0x09, 0x21, 0x14, 0x02, 0x31, 0x74	}
+	},
+  {9395, 70, 0, {
+    0x01, 0xA8, 0xAA, 0xA9, 0x89, 0x0A, 0xFA, 0x9E, 0x10, 0x21, 0x22, 0x21, 0x37, 0x01, 0xA9, 0xBB,
+    0x9A, 0xAA, 0xF8, 0x8F, 0x08, 0x22, 0x11, 0x43, 0x25, 0x88, 0xBA, 0x9A, 0x8B, 0xFA, 0xAC, 0x10,
+    0x32, 0x32, 0x37, 0x02, 0xA8, 0xBB, 0xAA, 0xF9, 0x9D, 0x18, 0x22, 0x32, 0x27, 0x81, 0x99, 0x9A,
+    0xAB, 0xCE, 0x88, 0x21, 0x22, 0x37, 0x01, 0xA8, 0xAA, 0xBA, 0xAF, 0x09, 0x21, 0x62, 0x24, 0x80	}
+	},
+  {19789, 75, 0, {
+    0x99, 0x9B, 0xFB, 0x8A, 0x28, 0x41, 0x44, 0x01, 0x9A, 0x99, 0xDC, 0x8A, 0x10, 0x42, 0x25, 0x00,
+    0x99, 0xAA, 0xBE, 0x09, 0x30, 0x54, 0x12, 0x88, 0xAA, 0xFB, 0x8A, 0x10, 0x61, 0x13, 0x90, 0xA8,
+    0xFA, 0x99, 0x00, 0x52, 0x22, 0x90, 0x99, 0xDC, 0x99, 0x20, 0x63, 0x02, 0x88, 0xB9, 0xAE, 0x08,
+    0x31, 0x25, 0x81, 0x99, 0xDC, 0x99, 0x11, 0x44, 0x01, 0x88, 0xDA, 0x9B, 0x18, 0x73, 0x11, 0x88	}
+	},
+  {20721, 81, 0, {
+    0xC9, 0xAB, 0x18, 0x73, 0x02, 0x90, 0xD9, 0x9A, 0x18, 0x44, 0x11, 0x89, 0xEB, 0x99, 0x20, 0x25,
+    0x81, 0xA8, 0xAD, 0x89, 0x52, 0x13, 0x90, 0xE9, 0x9A, 0x28, 0x34, 0x82, 0xB8, 0xAE, 0x89, 0x63,
+    0x11, 0x90, 0xDB, 0x89, 0x40, 0x23, 0x80, 0xFA, 0x99, 0x20, 0x24, 0x80, 0xC9, 0x9C, 0x20, 0x34,
+    0x00, 0xDA, 0x9B, 0x38, 0x26, 0x00, 0xCA, 0x9B, 0x48, 0x24, 0x80, 0xEA, 0x99, 0x31, 0x23, 0x90	}
+	},
+  {21786, 79, 0, {
+    0xBE, 0x89, 0x53, 0x02, 0xB0, 0x9E, 0x18, 0x33, 0x02, 0xFB, 0x8A, 0x40, 0x22, 0xA0, 0xAD, 0x09,
+    0x34, 0x02, 0xDA, 0x9B, 0x50, 0x13, 0xA0, 0xAD, 0x19, 0x34, 0x01, 0xEB, 0x8A, 0x32, 0x13, 0xD8,
+    0x9C, 0x30, 0x14, 0xA1, 0x9E, 0x19, 0x24, 0x80, 0xCB, 0x0A, 0x25, 0x01, 0xCB, 0x8A, 0x53, 0x11,
+    0xDA, 0x8A, 0x42, 0x02, 0xD9, 0x8A, 0x51, 0x11, 0xC9, 0x9A, 0x42, 0x12, 0xE9, 0x8A, 0x42, 0x11	}
+	},
+  {32767, 85, 0, {
+    0xCA, 0x9A, 0x53, 0x01, 0xDA, 0x89, 0x24, 0x81, 0xCB, 0x09, 0x25, 0x91, 0xAC, 0x29, 0x15, 0xA0,
+    0xAC, 0x40, 0x12, 0xD8, 0x8A, 0x42, 0x01, 0xCB, 0x1A, 0x24, 0xA2, 0x9E, 0x38, 0x23, 0xE8, 0x9A,
+    0x33, 0x02, 0xBD, 0x2A, 0x25, 0xC0, 0x9B, 0x51, 0x02, 0xCB, 0x19, 0x24, 0xA0, 0x9D, 0x40, 0x02,
+    0xCA, 0x1A, 0x24, 0xC1, 0x9B, 0x51, 0x11, 0xCB, 0x19, 0x24, 0xB0, 0xAC, 0x51, 0x11, 0xCA, 0x0A	}
+	},
+  {-29163, 85, 0, {
+    0x15, 0xA2, 0xAC, 0x48, 0x13, 0xD9, 0x8A, 0x33, 0x02, 0xBD, 0x2A, 0x25, 0xB0, 0xAC, 0x50, 0x12,
+    0xC9, 0x9A, 0x43, 0x11, 0xBC, 0x0A, 0x25, 0x81, 0xAD, 0x18, 0x24, 0xA0, 0x9D, 0x48, 0x12, 0xC8,
+    0x9A, 0x50, 0x11, 0xC8, 0x9A, 0x51, 0x11, 0xC9, 0x9A, 0x42, 0x12, 0xDA, 0x8A, 0x42, 0x11, 0xD9,
+    0x8A, 0x41, 0x12, 0xD9, 0x9A, 0x41, 0x12, 0xC8, 0xAB, 0x50, 0x13, 0xB0, 0xAD, 0x38, 0x24, 0x90	}
+	},
+  {20729, 82, 0, {
+    0xAD, 0x09, 0x25, 0x81, 0xDA, 0x89, 0x42, 0x02, 0xC9, 0x9B, 0x50, 0x22, 0xA0, 0x9E, 0x19, 0x33,
+    0x01, 0xEB, 0x8A, 0x41, 0x03, 0xA0, 0x9E, 0x19, 0x24, 0x01, 0xCB, 0x9B, 0x51, 0x13, 0xA0, 0xAD,
+    0x89, 0x44, 0x01, 0xB8, 0x9D, 0x28, 0x43, 0x81, 0xCA, 0xAB, 0x50, 0x23, 0x00, 0xCC, 0x9A, 0x41,
+    0x14, 0x90, 0xDB, 0x89, 0x41, 0x13, 0x90, 0xCC, 0x99, 0x51, 0x22, 0x88, 0xEA, 0x99, 0x40, 0x13	}
+	},
+  {22860, 83, 0, {
+    0x80, 0xD9, 0x9B, 0x20, 0x25, 0x01, 0xB9, 0xAD, 0x19, 0x63, 0x11, 0x98, 0xDB, 0x89, 0x40, 0x23,
+    0x80, 0xC9, 0x9D, 0x18, 0x52, 0x02, 0x98, 0xDA, 0x9A, 0x30, 0x25, 0x01, 0x99, 0xBD, 0x89, 0x41,
+    0x24, 0x91, 0xB8, 0xBD, 0x09, 0x41, 0x15, 0x81, 0x99, 0xAE, 0x88, 0x21, 0x25, 0x00, 0x99, 0xCC,
+    0x89, 0x10, 0x35, 0x01, 0x98, 0xCA, 0xAC, 0x18, 0x62, 0x03, 0x00, 0x9A, 0xDC, 0x89, 0x01, 0x44	}
+	},
+  {11135, 82, 0, {
+    0x11, 0x98, 0xA9, 0xAD, 0x89, 0x21, 0x35, 0x03, 0x99, 0xB9, 0xBF, 0x88, 0x11, 0x54, 0x02, 0x98,
+    0x99, 0xEB, 0x99, 0x20, 0x41, 0x24, 0x80, 0xA9, 0xB9, 0xAE, 0x09, 0x21, 0x73, 0x12, 0x88, 0xA9,
+    0xAA, 0x9E, 0x09, 0x21, 0x53, 0x23, 0x90, 0xAA, 0x9B, 0xCE, 0x89, 0x11, 0x32, 0x36, 0x82, 0xA9,
+    0xB9, 0xB9, 0xBF, 0x08, 0x31, 0x32, 0x36, 0x02, 0xAA, 0xBA, 0x9A, 0xED, 0x89, 0x20, 0x22, 0x62	}
+	},
+  {5584, 74, 0, {
+    0x23, 0x98, 0xAA, 0xBA, 0x89, 0xCE, 0x8A, 0x22, 0x32, 0x70, 0x33, 0x90, 0xC9, 0xA8, 0xB8, 0x89,
+    0xBE, 0x09, 0x41, 0x31, 0x11, 0x37, 0x01, 0xB9, 0xB9, 0xA9, 0x99, 0xD0, 0xAE, 0x18, 0x31, 0x32,
+    0x30, 0x73, 0x04, 0x98, 0xA9, 0xAB, 0xA8, 0x88, 0x98, 0xEF, 0x08, 0x20, 0x21, 0x12, 0x01, 0x32,
+    0x27, 0x08, 0x9C, 0xAA, 0x99, 0x98, 0x98, 0x00, 0xF0, 0x9F, 0x00, 0x31, 0x21, 0x11, 0x01, 0x80	}
+	},
+  {1408, 57, 0, {
+    0x72, 0x04, 0x98, 0xB9, 0x8B, 0x9B, 0xA0, 0xC1, 0x10, 0xA9, 0x29, 0x9B, 0xFF, 0x89, 0x13, 0x32,
+    0x50, 0x18, 0x82, 0x19, 0x10, 0x28, 0x79, 0x24, 0xA0, 0xAA, 0xCB, 0xB8, 0xA9, 0x99, 0x02, 0x8E,
+    0x18, 0x89, 0x3C, 0x81, 0x19, 0x19, 0xC0, 0x21, 0xF8, 0xCF, 0x30, 0x83, 0x24, 0x21, 0x08, 0x03,
+    0x6A, 0x98, 0x92, 0x35, 0x17, 0x89, 0xAB, 0xAB, 0x8B, 0x9B, 0xA9, 0xA5, 0xB9, 0x29, 0x2A, 0xFF	}
+	},
+  {-6998, 63, 0, {
+    0x8C, 0x10, 0x23, 0x23, 0x82, 0x23, 0x81, 0x67, 0x02, 0x98, 0x9C, 0xA8, 0x8B, 0x08, 0xA9, 0x81,
+    0xFF, 0x99, 0x20, 0x21, 0x12, 0x32, 0x38, 0x57, 0x00, 0xB8, 0xB9, 0x99, 0x9A, 0x08, 0xF8, 0x9F,
+    0x00, 0x30, 0x21, 0x02, 0x35, 0x14, 0xA9, 0xBA, 0xC9, 0x99, 0x88, 0xDF, 0x09, 0x11, 0x22, 0x22,
+    0x45, 0x03, 0xA9, 0xBA, 0x9B, 0xAA, 0xFC, 0xAB, 0x31, 0x22, 0x15, 0x27, 0x01, 0xA9, 0xA9, 0x9A	}
+	},
+  {106, 66, 0, {
+    0xE9, 0x9C, 0x18, 0x41, 0x11, 0x27, 0x01, 0x99, 0xAA, 0x99, 0xFB, 0x9A, 0x21, 0x21, 0x45, 0x13,
+    0x98, 0xAA, 0x9B, 0xED, 0x99, 0x20, 0x12, 0x36, 0x12, 0x99, 0xAA, 0xDA, 0xAD, 0x08, 0x21, 0x44,
+    0x14, 0x90, 0xA9, 0xB9, 0xAF, 0x09, 0x21, 0x63, 0x13, 0x90, 0xAA, 0xE9, 0x9C, 0x00, 0x21, 0x35,
+    0x02, 0xA8, 0x9A, 0xBF, 0x89, 0x20, 0x73, 0x12, 0x88, 0xA9, 0xEB, 0x99, 0x10, 0x63, 0x12, 0x90	}
+	},
+  {20173, 78, 0, {
+    0x99, 0xBD, 0x8A, 0x10, 0x36, 0x13, 0xA8, 0xB9, 0xAF, 0x89, 0x41, 0x24, 0x01, 0x99, 0xFB, 0x99,
+    0x00, 0x34, 0x12, 0x98, 0xE9, 0xAB, 0x18, 0x72, 0x02, 0x80, 0xB9, 0x9D, 0x09, 0x52, 0x13, 0x80,
+    0xD9, 0xAB, 0x09, 0x73, 0x12, 0x88, 0xD9, 0x9A, 0x18, 0x63, 0x01, 0x88, 0xDB, 0x99, 0x30, 0x25,
+    0x81, 0xA9, 0xAE, 0x08, 0x52, 0x02, 0x90, 0xDB, 0x8A, 0x40, 0x14, 0x81, 0xC9, 0x9C, 0x18, 0x34	}
+	},
+  {15260, 83, 0, {
+    0x01, 0xB8, 0xAE, 0x08, 0x53, 0x02, 0xA8, 0xAD, 0x09, 0x43, 0x03, 0xA0, 0xAE, 0x0A, 0x62, 0x11,
+    0x98, 0xBC, 0x88, 0x34, 0x12, 0xB8, 0x9F, 0x09, 0x24, 0x02, 0xC9, 0xAB, 0x38, 0x26, 0x80, 0xE9,
+    0x89, 0x30, 0x23, 0xA0, 0xAE, 0x09, 0x53, 0x01, 0xC8, 0xAB, 0x40, 0x23, 0x91, 0xCD, 0x09, 0x43,
+    0x11, 0xD9, 0x9A, 0x48, 0x23, 0xA0, 0xBD, 0x19, 0x25, 0x01, 0xDB, 0x8A, 0x52, 0x11, 0xC8, 0x9B	}
+	},
+  {-30661, 84, 0, {
+    0x40, 0x13, 0xB0, 0xAD, 0x28, 0x25, 0x90, 0xBC, 0x19, 0x25, 0x81, 0xBC, 0x0A, 0x35, 0x01, 0xCC,
+    0x89, 0x24, 0x11, 0xDB, 0x89, 0x43, 0x01, 0xDB, 0x89, 0x43, 0x01, 0xDB, 0x09, 0x43, 0x81, 0xBC,
+    0x19, 0x15, 0x92, 0xAD, 0x28, 0x14, 0xA1, 0x9D, 0x38, 0x23, 0xD8, 0x9B, 0x51, 0x12, 0xDA, 0x89,
+    0x33, 0x82, 0xBD, 0x19, 0x15, 0xA1, 0x9D, 0x40, 0x12, 0xC9, 0x8A, 0x43, 0x81, 0xBC, 0x39, 0x15	}
+	},
+  {27334, 86, 0, {
+    0xC0, 0x9B, 0x42, 0x02, 0xDB, 0x19, 0x24, 0xB0, 0x9D, 0x41, 0x11, 0xCB, 0x19, 0x14, 0xC1, 0x9B,
+    0x51, 0x01, 0xBB, 0x19, 0x16, 0xA0, 0x9C, 0x41, 0x02, 0xCB, 0x09, 0x25, 0xA1, 0xAC, 0x50, 0x02,
+    0xC9, 0x8A, 0x34, 0x80, 0xBC, 0x38, 0x24, 0xC0, 0x9C, 0x41, 0x02, 0xD9, 0x0A, 0x33, 0x82, 0xBD,
+    0x2A, 0x15, 0xA1, 0xAC, 0x38, 0x24, 0xD0, 0xAA, 0x50, 0x12, 0xC9, 0x9A, 0x42, 0x11, 0xD9, 0x8A	}
+	},
+  {-31189, 85, 0, {
+    0x42, 0x11, 0xCB, 0x8A, 0x53, 0x01, 0xDA, 0x89, 0x33, 0x12, 0xDC, 0x89, 0x42, 0x11, 0xCA, 0x9A,
+    0x53, 0x02, 0xD9, 0x9A, 0x42, 0x02, 0xC8, 0xAB, 0x41, 0x23, 0xC0, 0x9D, 0x28, 0x14, 0x91, 0xBC,
+    0x09, 0x35, 0x01, 0xDB, 0x8A, 0x51, 0x11, 0xB8, 0x9C, 0x38, 0x24, 0x80, 0xBD, 0x09, 0x53, 0x02,
+    0xD8, 0xAA, 0x40, 0x23, 0x80, 0xBD, 0x89, 0x53, 0x02, 0xB8, 0x9D, 0x29, 0x25, 0x00, 0xDA, 0x99	}
+	},
+  {-25050, 84, 0, {
+    0x40, 0x22, 0x90, 0xCC, 0x89, 0x52, 0x11, 0x98, 0xBC, 0x09, 0x34, 0x12, 0xB8, 0xAF, 0x08, 0x43,
+    0x11, 0xA9, 0xAD, 0x09, 0x34, 0x03, 0xB8, 0xAE, 0x09, 0x53, 0x11, 0x98, 0xCC, 0x89, 0x51, 0x12,
+    0x80, 0xDB, 0x8A, 0x38, 0x34, 0x81, 0xC8, 0xAC, 0x18, 0x63, 0x11, 0x98, 0xEB, 0x89, 0x30, 0x24,
+    0x80, 0xB8, 0xAE, 0x08, 0x42, 0x13, 0x88, 0xEA, 0x8B, 0x18, 0x54, 0x10, 0x89, 0xDA, 0x99, 0x10	}
+	},
+  {-22634, 80, 0, {
+    0x34, 0x11, 0x99, 0xEA, 0x9A, 0x10, 0x44, 0x02, 0x88, 0xDA, 0xAA, 0x18, 0x73, 0x02, 0x90, 0xA8,
+    0xAD, 0x08, 0x30, 0x35, 0x00, 0x99, 0xEA, 0x8B, 0x18, 0x52, 0x13, 0x80, 0x9A, 0xCD, 0x99, 0x01,
+    0x73, 0x11, 0x88, 0x99, 0xDB, 0x8A, 0x20, 0x62, 0x12, 0x88, 0xA9, 0xEA, 0x9A, 0x10, 0x32, 0x26,
+    0x00, 0x9A, 0xA9, 0xAE, 0x09, 0x11, 0x53, 0x14, 0x88, 0xA9, 0xB9, 0xAE, 0x08, 0x21, 0x62, 0x13	}
+	},
+  {17656, 76, 0, {
+    0x90, 0xA9, 0x9A, 0xAF, 0x09, 0x20, 0x22, 0x27, 0x81, 0x99, 0xA9, 0xB9, 0x9E, 0x19, 0x22, 0x32,
+    0x27, 0x91, 0x99, 0xA9, 0xAA, 0xBD, 0x09, 0x31, 0x24, 0x64, 0x11, 0x99, 0xA9, 0xB9, 0xA8, 0xAF,
+    0x18, 0x31, 0x22, 0x72, 0x12, 0x98, 0xAA, 0x9A, 0x9A, 0xFA, 0x8B, 0x10, 0x14, 0x22, 0x62, 0x13,
+    0xA8, 0xBA, 0x9A, 0x8B, 0xB9, 0xCF, 0x09, 0x31, 0x32, 0x31, 0x73, 0x23, 0xA8, 0xD9, 0xA9, 0x98	}
+	},
+  {-194, 63, 0, {
+    0x99, 0xA0, 0xBF, 0x1A, 0x31, 0x34, 0x11, 0x11, 0x74, 0x11, 0xA9, 0xB9, 0x9A, 0x9B, 0x98, 0x91,
+    0xE1, 0xCD, 0x09, 0x04, 0x22, 0x31, 0x10, 0x28, 0x71, 0x04, 0xA8, 0xB9, 0xA9, 0x8B, 0x3A, 0x0D,
+    0x80, 0xA9, 0x81, 0xFB, 0xAD, 0x32, 0x58, 0x02, 0x21, 0x18, 0x81, 0x18, 0x11, 0x37, 0x12, 0x9B,
+    0x9E, 0xA9, 0x8B, 0x98, 0xC1, 0xB3, 0x4A, 0x2C, 0x9A, 0xB2, 0xB7, 0x28, 0x28, 0x0B, 0xAF, 0x18	}
+	},
+  {-5755, 56, 0, {
+    0x22, 0x60, 0x84, 0x81, 0x81, 0xA1, 0x22, 0x10, 0x4D, 0x09, 0x15, 0x06, 0x8A, 0xAA, 0x9B, 0xBA,
+    0x1A, 0x2C, 0xA9, 0x10, 0x8D, 0x19, 0xB8, 0xFF, 0x99, 0x32, 0x32, 0x13, 0x13, 0x31, 0x3A, 0x72,
+    0x37, 0x99, 0xB8, 0xAB, 0x99, 0xA9, 0xA8, 0x2A, 0xAA, 0xFF, 0x8D, 0x02, 0x32, 0x11, 0x02, 0x78,
+    0x33, 0xA2, 0xD9, 0xA8, 0x8A, 0x8B, 0x19, 0xDA, 0xBF, 0x18, 0x12, 0x24, 0x20, 0x62, 0x14, 0x90	}
+	},
+  {11392, 66, 0, {
+    0xAA, 0xC9, 0x89, 0x89, 0xDC, 0xAB, 0x38, 0x42, 0x23, 0x53, 0x26, 0x91, 0x9A, 0xAB, 0x8B, 0x9A,
+    0xDF, 0x09, 0x20, 0x23, 0x52, 0x15, 0x92, 0xAA, 0xAA, 0xA9, 0xF9, 0x9C, 0x10, 0x22, 0x42, 0x36,
+    0x80, 0x99, 0x9B, 0xAA, 0xFC, 0x89, 0x11, 0x21, 0x73, 0x12, 0x98, 0x9A, 0x9A, 0xFB, 0x9A, 0x11,
+    0x22, 0x55, 0x02, 0x98, 0xAA, 0xB9, 0xAE, 0x1A, 0x21, 0x63, 0x24, 0x80, 0xAA, 0xA9, 0xDD, 0x98	}
+	},
+  {-25862, 77, 0, {
+    0x21, 0x41, 0x15, 0x81, 0x8A, 0xAA, 0xAF, 0x08, 0x01, 0x63, 0x12, 0x88, 0x9A, 0xEA, 0x9A, 0x00,
+    0x42, 0x25, 0x00, 0x9A, 0xD9, 0xAB, 0x08, 0x42, 0x26, 0x81, 0x99, 0xD9, 0x8C, 0x08, 0x41, 0x14,
+    0x81, 0x99, 0xEB, 0x8A, 0x18, 0x44, 0x12, 0x88, 0xBA, 0xAE, 0x88, 0x41, 0x24, 0x81, 0x99, 0xDC,
+    0x99, 0x11, 0x35, 0x01, 0x98, 0xEB, 0x9A, 0x10, 0x54, 0x01, 0x98, 0xCA, 0x9B, 0x20, 0x45, 0x01	}
+	},
+  {27637, 82, 0, {
+    0x98, 0xDB, 0x9A, 0x21, 0x26, 0x00, 0xA8, 0xAD, 0x89, 0x42, 0x14, 0x80, 0xCA, 0x9C, 0x18, 0x25,
+    0x02, 0x99, 0xAD, 0x8A, 0x52, 0x13, 0x90, 0xEA, 0x9A, 0x30, 0x34, 0x00, 0xD9, 0x9C, 0x18, 0x25,
+    0x01, 0xA9, 0xAD, 0x08, 0x34, 0x02, 0xB8, 0xAE, 0x09, 0x34, 0x02, 0xB8, 0xAE, 0x08, 0x25, 0x01,
+    0xB8, 0x9D, 0x19, 0x25, 0x01, 0xD9, 0x9A, 0x38, 0x15, 0x81, 0xDB, 0x99, 0x51, 0x11, 0x90, 0xAD	}
+	},
+  {-26984, 86, 0, {
+    0x08, 0x43, 0x01, 0xC9, 0xAB, 0x40, 0x24, 0x90, 0xAD, 0x89, 0x34, 0x02, 0xD9, 0x9B, 0x40, 0x14,
+    0xA0, 0xAC, 0x19, 0x34, 0x82, 0xFB, 0x89, 0x32, 0x03, 0xD9, 0x9B, 0x50, 0x22, 0xB0, 0xAD, 0x28,
+    0x15, 0x91, 0xBC, 0x19, 0x25, 0x81, 0xBC, 0x89, 0x25, 0x01, 0xCB, 0x8A, 0x44, 0x01, 0xCB, 0x0A,
+    0x43, 0x01, 0xEA, 0x89, 0x33, 0x02, 0xCC, 0x0A, 0x34, 0x81, 0xBC, 0x1A, 0x25, 0x81, 0xAD, 0x29	}
+	},
+  {-17380, 84, 0, {
+    0x24, 0xA1, 0x9E, 0x38, 0x23, 0xD0, 0xAB, 0x51, 0x12, 0xCA, 0x9A, 0x53, 0x01, 0xAC, 0x1A, 0x24,
+    0xA2, 0xAD, 0x48, 0x22, 0xC9, 0x9B, 0x43, 0x02, 0xCC, 0x19, 0x24, 0xB1, 0x9D, 0x31, 0x22, 0xEB,
+    0x89, 0x24, 0x91, 0xAD, 0x40, 0x12, 0xCA, 0x0A, 0x24, 0xA1, 0xAC, 0x40, 0x22, 0xDB, 0x1A, 0x24,
+    0xB1, 0xAC, 0x50, 0x12, 0xCA, 0x0A, 0x24, 0x91, 0xAD, 0x30, 0x23, 0xE9, 0x8A, 0x42, 0x01, 0xBC	}
+	},
+  {-24631, 86, 0, {
+    0x29, 0x24, 0xA0, 0xAD, 0x40, 0x12, 0xD8, 0x8A, 0x42, 0x01, 0xCB, 0x09, 0x34, 0xA1, 0xBC, 0x39,
+    0x25, 0xB0, 0x9D, 0x48, 0x22, 0xD8, 0x9A, 0x41, 0x12, 0xCA, 0x9A, 0x52, 0x11, 0xCA, 0x8A, 0x52,
+    0x11, 0xCB, 0x8A, 0x53, 0x01, 0xCA, 0x8A, 0x43, 0x02, 0xDA, 0x9A, 0x52, 0x11, 0xC9, 0x8B, 0x51,
+    0x11, 0xC8, 0xAA, 0x50, 0x12, 0xB0, 0xAC, 0x38, 0x24, 0x91, 0xBD, 0x09, 0x25, 0x01, 0xDA, 0x8A	}
+	},
+  {-31784, 84, 0, {
+    0x42, 0x12, 0xC8, 0x9C, 0x38, 0x24, 0x90, 0xBC, 0x0A, 0x35, 0x11, 0xE9, 0x9A, 0x40, 0x12, 0x91,
+    0xAD, 0x89, 0x34, 0x02, 0xC9, 0x9C, 0x38, 0x24, 0x81, 0xEB, 0x99, 0x41, 0x03, 0x90, 0xCC, 0x09,
+    0x43, 0x02, 0xA8, 0x9E, 0x09, 0x34, 0x01, 0xB8, 0x9E, 0x19, 0x24, 0x82, 0xC8, 0x9C, 0x18, 0x34,
+    0x01, 0xB9, 0x9E, 0x19, 0x34, 0x01, 0xA8, 0xAE, 0x88, 0x43, 0x12, 0x88, 0xBD, 0x8A, 0x51, 0x23	}
+	},
+  {24654, 81, 0, {
+    0x90, 0xE9, 0x9A, 0x28, 0x34, 0x02, 0xA9, 0xAF, 0x09, 0x41, 0x13, 0x80, 0xDA, 0x9B, 0x18, 0x35,
+    0x12, 0x99, 0xDC, 0x8A, 0x30, 0x25, 0x81, 0xA8, 0xCC, 0x89, 0x31, 0x16, 0x81, 0xA8, 0xBC, 0x89,
+    0x40, 0x25, 0x00, 0x99, 0xBC, 0x8B, 0x21, 0x27, 0x01, 0x98, 0xE9, 0x9A, 0x00, 0x52, 0x22, 0x88,
+    0x9A, 0xBD, 0x89, 0x21, 0x36, 0x01, 0x99, 0xC9, 0x9D, 0x08, 0x31, 0x35, 0x00, 0xA9, 0xD9, 0x9C	}
+	},
+  {-23519, 79, 0, {
+    0x18, 0x21, 0x26, 0x81, 0x98, 0xAA, 0x9F, 0x08, 0x01, 0x44, 0x01, 0x98, 0x99, 0xDB, 0x9A, 0x11,
+    0x42, 0x25, 0x80, 0xA8, 0x9A, 0xBD, 0x8A, 0x31, 0x62, 0x24, 0x80, 0xA9, 0x9A, 0xDC, 0x89, 0x10,
+    0x32, 0x45, 0x01, 0x99, 0xAA, 0xB9, 0x9F, 0x19, 0x11, 0x32, 0x27, 0x80, 0x99, 0xA9, 0xA9, 0xBD,
+    0x09, 0x22, 0x14, 0x45, 0x02, 0x99, 0xAA, 0xAA, 0xD9, 0x9C, 0x28, 0x22, 0x42, 0x73, 0x01, 0xA8	}
+	},
+  {10813, 71, 0, {
+    0xA9, 0x99, 0x8A, 0xBE, 0x89, 0x22, 0x14, 0x12, 0x37, 0x00, 0xB9, 0x99, 0x9B, 0x0A, 0xFA, 0x9B,
+    0x38, 0x42, 0x22, 0x21, 0x27, 0x82, 0xAA, 0xAB, 0xAA, 0xA8, 0x98, 0xFC, 0x8B, 0x31, 0x42, 0x31,
+    0x30, 0x72, 0x03, 0xA8, 0xCB, 0xB8, 0x89, 0x8A, 0x08, 0xF1, 0x8F, 0x18, 0x11, 0x12, 0x11, 0x01,
+    0x30, 0x27, 0x91, 0xB9, 0xCA, 0x89, 0x0A, 0x89, 0x3A, 0x9A, 0x1A, 0xFF, 0x89, 0x11, 0x23, 0x02	}
+	},
+  {-1844, 58, 0, {
+    0x95, 0x02, 0x39, 0x09, 0x73, 0x13, 0x9A, 0xBA, 0xBA, 0x9D, 0x90, 0xA8, 0x20, 0x8B, 0xD9, 0x5A,
+    0x99, 0xA3, 0x91, 0xFA, 0x9C, 0x04, 0x23, 0x60, 0x28, 0x08, 0x18, 0x00, 0x30, 0x0A, 0x89, 0x95,
+    0x22, 0x57, 0x90, 0x9B, 0x9C, 0x8B, 0xA9, 0x88, 0xC8, 0xB4, 0x8A, 0x30, 0x2C, 0xAA, 0xF3, 0xAF,
+    0x18, 0x32, 0x52, 0x20, 0x10, 0x81, 0x22, 0x7C, 0x05, 0xA1, 0xA8, 0xAA, 0xB8, 0x99, 0x19, 0x0A	}
+	},
+  {-1480, 52, 0, {
+    0x98, 0xF8, 0xCF, 0x18, 0x22, 0x30, 0x12, 0x01, 0x62, 0x26, 0x98, 0xB9, 0xA9, 0x0B, 0xA9, 0x91,
+    0xEA, 0xBF, 0x18, 0x12, 0x43, 0x10, 0x33, 0x27, 0x81, 0xAA, 0xAB, 0xAB, 0x89, 0xB9, 0xFF, 0x1A,
+    0x11, 0x13, 0x22, 0x45, 0x12, 0x99, 0xCB, 0x8A, 0x9A, 0xFA, 0xBB, 0x11, 0x42, 0x32, 0x73, 0x04,
+    0x90, 0xB9, 0xA9, 0x8A, 0xFC, 0x99, 0x21, 0x40, 0x41, 0x33, 0x91, 0xC9, 0xB9, 0x8A, 0xCF, 0x88	}
+	},
+  {-18489, 73, 0, {
+    0x20, 0x22, 0x54, 0x12, 0x98, 0xAA, 0xAA, 0xFC, 0x99, 0x20, 0x22, 0x72, 0x12, 0x98, 0x9A, 0x9A,
+    0xAF, 0x09, 0x10, 0x43, 0x25, 0x00, 0x99, 0x9B, 0xFB, 0x9A, 0x10, 0x42, 0x25, 0x01, 0x99, 0x9B,
+    0xEC, 0x89, 0x10, 0x42, 0x15, 0x80, 0x99, 0xB9, 0xAE, 0x08, 0x21, 0x45, 0x01, 0x98, 0xA9, 0xBD,
+    0x99, 0x21, 0x36, 0x13, 0x89, 0xBA, 0xCE, 0x09, 0x20, 0x44, 0x02, 0x98, 0xC9, 0x9D, 0x09, 0x31	}
+	},
+  {-10503, 77, 0, {
+    0x26, 0x81, 0x99, 0xEA, 0x9A, 0x10, 0x63, 0x11, 0x90, 0xB9, 0x9E, 0x08, 0x41, 0x23, 0x80, 0xB9,
+    0xBE, 0x09, 0x41, 0x15, 0x81, 0xA9, 0xAD, 0x89, 0x41, 0x15, 0x80, 0xB8, 0xBC, 0x88, 0x72, 0x02,
+    0x80, 0xC9, 0xAA, 0x18, 0x44, 0x02, 0x88, 0xDC, 0x89, 0x30, 0x24, 0x81, 0xC9, 0xAC, 0x08, 0x44,
+    0x02, 0x98, 0xCC, 0x89, 0x51, 0x12, 0x80, 0xDA, 0x9A, 0x48, 0x24, 0x80, 0xC9, 0xAB, 0x38, 0x35	}
+	},
+  {17995, 82, 0, {
+    0x01, 0xD9, 0x9C, 0x28, 0x34, 0x81, 0xC9, 0x9C, 0x29, 0x25, 0x01, 0xD9, 0x9B, 0x38, 0x25, 0x00,
+    0xEA, 0x99, 0x40, 0x12, 0x91, 0xBC, 0x8A, 0x63, 0x02, 0xA8, 0x9D, 0x19, 0x34, 0x81, 0xE9, 0x8A,
+    0x40, 0x12, 0x90, 0xAD, 0x09, 0x25, 0x01, 0xCA, 0x9A, 0x41, 0x13, 0xB0, 0xAE, 0x28, 0x24, 0x81,
+    0xBC, 0x9A, 0x44, 0x02, 0xC9, 0xAB, 0x61, 0x12, 0xB8, 0xAC, 0x38, 0x15, 0x91, 0xAD, 0x19, 0x24	}
+	},
+  {18575, 85, 0, {
+    0x81, 0xBC, 0x0A, 0x35, 0x01, 0xCC, 0x09, 0x33, 0x02, 0xDC, 0x89, 0x24, 0x01, 0xDA, 0x89, 0x43,
+    0x01, 0xDB, 0x89, 0x24, 0x82, 0xBC, 0x09, 0x25, 0x81, 0xAD, 0x19, 0x24, 0xA1, 0xAC, 0x49, 0x13,
+    0xC0, 0xAB, 0x60, 0x02, 0xC8, 0x9A, 0x43, 0x01, 0xDB, 0x09, 0x24, 0x91, 0xBC, 0x48, 0x13, 0xD0,
+    0x9B, 0x42, 0x02, 0xDB, 0x09, 0x15, 0xA1, 0xAC, 0x40, 0x12, 0xC9, 0x0B, 0x24, 0x92, 0x9E, 0x38	}
+	},
+  {-4217, 85, 0, {
+    0x23, 0xE9, 0x8A, 0x33, 0x92, 0xAE, 0x48, 0x12, 0xC9, 0x8A, 0x24, 0xA2, 0xBC, 0x40, 0x13, 0xD9,
+    0x8A, 0x43, 0x81, 0xAD, 0x28, 0x14, 0xC0, 0x9B, 0x42, 0x02, 0xDB, 0x09, 0x15, 0x91, 0x9D, 0x38,
+    0x23, 0xE8, 0x9A, 0x42, 0x11, 0xCB, 0x0A, 0x34, 0x91, 0xAD, 0x29, 0x24, 0xB1, 0xAD, 0x30, 0x14,
+    0xD0, 0x9A, 0x50, 0x11, 0xC8, 0x9A, 0x51, 0x11, 0xD9, 0x99, 0x42, 0x11, 0xDA, 0x89, 0x42, 0x01	}
+	},
+  {29775, 85, 0, {
+    0xCA, 0x8A, 0x43, 0x02, 0xEA, 0x99, 0x42, 0x01, 0xC9, 0x9A, 0x42, 0x12, 0xD8, 0x9B, 0x41, 0x13,
+    0xB8, 0xAD, 0x38, 0x15, 0xA1, 0xAC, 0x19, 0x34, 0x01, 0xCC, 0x8A, 0x53, 0x01, 0xC8, 0x9B, 0x40,
+    0x23, 0x90, 0x9F, 0x09, 0x24, 0x81, 0xD9, 0x99, 0x41, 0x12, 0x98, 0xAD, 0x19, 0x24, 0x02, 0xDA,
+    0x9B, 0x50, 0x22, 0x88, 0xBC, 0x8A, 0x44, 0x02, 0xA8, 0xAD, 0x19, 0x34, 0x01, 0xD8, 0xAB, 0x38	}
+	},
+  {-17823, 80, 0, {
+    0x16, 0x01, 0xCA, 0x9B, 0x30, 0x16, 0x00, 0xCA, 0x9A, 0x48, 0x14, 0x81, 0xCA, 0x9B, 0x48, 0x24,
+    0x81, 0xD9, 0x9B, 0x28, 0x25, 0x01, 0xB8, 0xAD, 0x09, 0x44, 0x11, 0x98, 0xBC, 0x8A, 0x51, 0x23,
+    0x91, 0xE9, 0x9B, 0x18, 0x35, 0x11, 0x99, 0xBD, 0x8A, 0x41, 0x15, 0x81, 0xA9, 0x9E, 0x88, 0x42,
+    0x12, 0x80, 0xCA, 0x9C, 0x08, 0x63, 0x02, 0x90, 0xD9, 0x9A, 0x08, 0x63, 0x11, 0x88, 0xC9, 0xAB	}
+	},
+  {-26167, 79, 0, {
+    0x08, 0x63, 0x13, 0x90, 0xA9, 0xAE, 0x09, 0x30, 0x26, 0x00, 0x99, 0xDA, 0x9A, 0x10, 0x63, 0x12,
+    0x88, 0x9A, 0xAE, 0x09, 0x11, 0x25, 0x02, 0x98, 0xBA, 0xAE, 0x88, 0x21, 0x36, 0x01, 0x99, 0xA9,
+    0xAE, 0x89, 0x12, 0x73, 0x11, 0x98, 0x99, 0xDA, 0x8A, 0x28, 0x32, 0x26, 0x81, 0xA9, 0x99, 0xBE,
+    0x89, 0x12, 0x52, 0x24, 0x80, 0x9A, 0xAA, 0xBD, 0x8A, 0x31, 0x42, 0x27, 0x81, 0xA9, 0x99, 0xD9	}
+	},
+  {-7579, 75, 0, {
+    0x9B, 0x29, 0x32, 0x72, 0x04, 0x90, 0x99, 0x99, 0xE9, 0x9A, 0x28, 0x31, 0x32, 0x27, 0x80, 0x9A,
+    0xAA, 0x89, 0xBE, 0x09, 0x21, 0x32, 0x72, 0x14, 0xA0, 0x99, 0xAA, 0x99, 0xFA, 0x99, 0x11, 0x22,
+    0x32, 0x55, 0x01, 0xA9, 0x9A, 0x8B, 0x8A, 0xFA, 0x9B, 0x21, 0x32, 0x41, 0x32, 0x27, 0x90, 0xB9,
+    0xB9, 0xA9, 0xA0, 0xC8, 0xAF, 0x29, 0x12, 0x14, 0x31, 0x40, 0x44, 0x98, 0xAA, 0xAA, 0x9A, 0x99	}
+	},
+  {-2355, 58, 0, {
+    0xA1, 0xF1, 0x8F, 0x08, 0x12, 0x12, 0x12, 0x00, 0x43, 0x25, 0x98, 0xAB, 0xAC, 0x98, 0x8A, 0x89,
+    0x90, 0x08, 0xFF, 0x89, 0x20, 0x31, 0x21, 0x23, 0x29, 0x00, 0x32, 0x47, 0xB3, 0x8B, 0xBC, 0x0A,
+    0xBB, 0x92, 0x09, 0x8B, 0xE1, 0x01, 0x2C, 0x5A, 0xCF, 0x80, 0x22, 0x21, 0x82, 0x84, 0x00, 0x18,
+    0x92, 0xA4, 0xA1, 0x42, 0x7B, 0x30, 0xA0, 0x9C, 0xAA, 0xA9, 0x9A, 0x88, 0xB8, 0xFB, 0x95, 0x0A	}
+	},
+  {-3223, 54, 0, {
+    0x80, 0x10, 0x0A, 0x4A, 0xF1, 0xAE, 0x08, 0x52, 0x20, 0x22, 0x01, 0x90, 0x33, 0xB1, 0x74, 0x15,
+    0x89, 0xBA, 0x8B, 0xCB, 0x18, 0xAA, 0x08, 0xC1, 0x98, 0xFF, 0x0A, 0x20, 0x13, 0x13, 0x22, 0x19,
+    0x63, 0x17, 0x90, 0xA9, 0x8A, 0x9B, 0x9A, 0x81, 0x9A, 0xFF, 0x8A, 0x21, 0x22, 0x02, 0x13, 0x74,
+    0x12, 0xA8, 0xAA, 0xAA, 0x9A, 0xA8, 0xF1, 0x9F, 0x29, 0x11, 0x12, 0x13, 0x45, 0x12, 0xB8, 0xBB	}
+	},
+  {4476, 63, 0, {
+    0xAA, 0xAA, 0xF1, 0x9F, 0x18, 0x30, 0x21, 0x51, 0x14, 0x91, 0xB9, 0xC9, 0x98, 0xCA, 0x9D, 0x29,
+    0x13, 0x42, 0x45, 0x02, 0x99, 0xB9, 0xBA, 0xD9, 0xAE, 0x00, 0x22, 0x42, 0x35, 0x11, 0xBA, 0xAA,
+    0xB9, 0xCF, 0x89, 0x21, 0x22, 0x37, 0x01, 0xA8, 0x9A, 0xBA, 0xBF, 0x19, 0x21, 0x62, 0x24, 0x80,
+    0xA9, 0xAA, 0xFB, 0x8A, 0x20, 0x41, 0x25, 0x01, 0xA9, 0xA9, 0xEC, 0x89, 0x10, 0x32, 0x17, 0x80	}
+	},
+  {19593, 79, 0, {
+    0x98, 0xA9, 0x9E, 0x09, 0x20, 0x73, 0x01, 0x90, 0x99, 0xDB, 0x8A, 0x01, 0x63, 0x13, 0x88, 0x99,
+    0xDC, 0x8A, 0x10, 0x62, 0x03, 0x80, 0x9A, 0xBD, 0x8A, 0x20, 0x36, 0x03, 0x98, 0xDA, 0xAC, 0x08,
+    0x51, 0x33, 0x81, 0x9A, 0xCE, 0x89, 0x20, 0x44, 0x01, 0x98, 0xDB, 0xAA, 0x20, 0x73, 0x11, 0x98,
+    0xD9, 0x9A, 0x00, 0x44, 0x11, 0x98, 0xDA, 0x9A, 0x28, 0x35, 0x01, 0x98, 0xDC, 0x99, 0x21, 0x16	}
+	},
+  {19680, 85, 0, {
+    0x81, 0xB8, 0xAC, 0x09, 0x62, 0x12, 0x88, 0xDA, 0x9A, 0x20, 0x25, 0x01, 0xA9, 0xAE, 0x08, 0x43,
+    0x12, 0x98, 0xBD, 0x8A, 0x61, 0x13, 0x88, 0xEA, 0x99, 0x30, 0x24, 0x91, 0xDA, 0x9A, 0x48, 0x24,
+    0x80, 0xDA, 0x9A, 0x30, 0x25, 0x80, 0xDA, 0x9A, 0x40, 0x14, 0x80, 0xDB, 0x89, 0x41, 0x12, 0x90,
+    0xAE, 0x88, 0x43, 0x02, 0xC8, 0x9C, 0x28, 0x24, 0x81, 0xEA, 0x99, 0x41, 0x12, 0x98, 0xAD, 0x19	}
+	},
+  {-24374, 83, 0, {
+    0x34, 0x81, 0xDA, 0x9A, 0x51, 0x12, 0xB0, 0xBC, 0x28, 0x25, 0x81, 0xEB, 0x89, 0x42, 0x02, 0xD8,
+    0x9A, 0x40, 0x13, 0xA8, 0xAD, 0x28, 0x15, 0x91, 0xBC, 0x19, 0x34, 0x81, 0xCC, 0x89, 0x34, 0x01,
+    0xDB, 0x8A, 0x43, 0x02, 0xDA, 0x8A, 0x52, 0x11, 0xCA, 0x9A, 0x43, 0x02, 0xDA, 0x8A, 0x43, 0x11,
+    0xDB, 0x8A, 0x34, 0x01, 0xBC, 0x0A, 0x35, 0x81, 0xBD, 0x18, 0x24, 0xA1, 0xAD, 0x38, 0x14, 0xC0	}
+	},
+  {2008, 86, 0, {
+    0x9B, 0x51, 0x21, 0xCA, 0x8B, 0x34, 0x01, 0xAD, 0x1A, 0x15, 0xA1, 0xAC, 0x40, 0x12, 0xC9, 0x9A,
+    0x34, 0x92, 0xBC, 0x3A, 0x25, 0xD0, 0x9A, 0x42, 0x01, 0xCB, 0x19, 0x15, 0xB1, 0x9C, 0x41, 0x02,
+    0xCB, 0x2A, 0x24, 0xC0, 0x9B, 0x52, 0x11, 0xBC, 0x29, 0x24, 0xC0, 0xAB, 0x52, 0x11, 0xCB, 0x1A,
+    0x15, 0xA1, 0xAC, 0x40, 0x22, 0xCA, 0x0B, 0x43, 0x82, 0xBD, 0x28, 0x24, 0xC0, 0x9B, 0x50, 0x12	}
+	},
+  {31226, 85, 0, {
+    0xD9, 0x8A, 0x33, 0x02, 0xBD, 0x09, 0x25, 0x91, 0xBC, 0x38, 0x24, 0xB0, 0xAD, 0x30, 0x24, 0xC8,
+    0x9C, 0x31, 0x23, 0xE9, 0x9A, 0x41, 0x12, 0xC9, 0x9B, 0x52, 0x12, 0xD9, 0x9A, 0x42, 0x02, 0xD8,
+    0x9A, 0x41, 0x12, 0xD8, 0x9A, 0x40, 0x13, 0xC8, 0xAB, 0x40, 0x23, 0xB0, 0xAE, 0x28, 0x15, 0x91,
+    0xAC, 0x09, 0x34, 0x01, 0xEB, 0x89, 0x32, 0x03, 0xD8, 0xAB, 0x58, 0x23, 0x90, 0xAE, 0x09, 0x34	}
+	},
+  {19191, 85, 0, {
+    0x10, 0xDA, 0x9A, 0x41, 0x22, 0xA0, 0xAE, 0x08, 0x24, 0x01, 0xD9, 0x9A, 0x40, 0x13, 0x80, 0xBD,
+    0x89, 0x53, 0x02, 0xB0, 0xAD, 0x18, 0x34, 0x81, 0xD8, 0x9B, 0x38, 0x25, 0x81, 0xEA, 0x8A, 0x48,
+    0x13, 0x81, 0xDB, 0x9A, 0x40, 0x14, 0x80, 0xDA, 0x99, 0x30, 0x15, 0x00, 0xCA, 0x9B, 0x38, 0x26,
+    0x00, 0xB9, 0x9D, 0x08, 0x25, 0x01, 0x98, 0xAD, 0x89, 0x52, 0x12, 0x90, 0xDA, 0x9A, 0x20, 0x35	}
+	},
+  {19785, 82, 0, {
+    0x81, 0xA9, 0xBD, 0x09, 0x62, 0x12, 0x90, 0xD8, 0x9B, 0x18, 0x44, 0x11, 0x98, 0xDB, 0x9A, 0x20,
+    0x35, 0x01, 0x98, 0xDC, 0x89, 0x28, 0x25, 0x01, 0x98, 0xEB, 0x99, 0x10, 0x44, 0x01, 0x98, 0xD9,
+    0x9A, 0x08, 0x53, 0x13, 0x90, 0xA9, 0xAF, 0x88, 0x11, 0x25, 0x01, 0x98, 0xD9, 0xAB, 0x18, 0x52,
+    0x14, 0x80, 0xA8, 0xDA, 0x9B, 0x10, 0x62, 0x23, 0x90, 0x99, 0xEA, 0x9B, 0x28, 0x41, 0x25, 0x00	}
+	},
+  {21889, 77, 0, {
+    0xA9, 0xB9, 0xBD, 0x09, 0x22, 0x55, 0x11, 0x98, 0xA9, 0xDA, 0xAA, 0x10, 0x32, 0x46, 0x01, 0x99,
+    0xA9, 0xDA, 0x9B, 0x20, 0x31, 0x55, 0x11, 0xA8, 0xA9, 0xB9, 0xAE, 0x19, 0x31, 0x32, 0x27, 0x91,
+    0xA8, 0x9A, 0xCA, 0x9D, 0x18, 0x31, 0x41, 0x35, 0x80, 0x9A, 0xAA, 0x9A, 0xCE, 0x98, 0x22, 0x22,
+    0x72, 0x12, 0x90, 0xAA, 0x9A, 0xA9, 0xDC, 0x8A, 0x30, 0x23, 0x43, 0x36, 0x81, 0xA9, 0x8C, 0x8B	}
+	},
+  {-423, 66, 0, {
+    0x89, 0xDD, 0x88, 0x21, 0x31, 0x21, 0x54, 0x83, 0xA8, 0xD8, 0x89, 0x9A, 0x18, 0xBE, 0x89, 0x40,
+    0x21, 0x12, 0x03, 0x37, 0x81, 0xC9, 0x99, 0x9B, 0x90, 0x89, 0xB0, 0xDF, 0x18, 0x21, 0x22, 0x12,
+    0x01, 0x72, 0x13, 0xB0, 0xBB, 0x9B, 0xAA, 0xB9, 0xA2, 0xB2, 0xF0, 0xCF, 0x28, 0x40, 0x11, 0x10,
+    0x01, 0x00, 0x31, 0x36, 0x91, 0xBB, 0xF0, 0x99, 0xA0, 0xA0, 0x18, 0x00, 0x8A, 0x29, 0xAC, 0xCF	}
+	},
+  {-8015, 61, 0, {
+    0x89, 0x14, 0x32, 0x32, 0x28, 0x39, 0x3A, 0x30, 0xC2, 0xB7, 0x13, 0x35, 0x8A, 0xF9, 0x99, 0x08,
+    0x8B, 0x0A, 0x92, 0xC0, 0xA8, 0x82, 0x5A, 0x2E, 0x98, 0x92, 0x08, 0x39, 0xFD, 0x99, 0x02, 0x16,
+    0x01, 0x83, 0x01, 0x49, 0x28, 0x0A, 0x73, 0x13, 0x80, 0xAD, 0xAA, 0x9C, 0xD2, 0xA1, 0x80, 0x19,
+    0xB9, 0xF3, 0x9F, 0x18, 0x01, 0x33, 0x11, 0x20, 0x20, 0x71, 0x16, 0x89, 0xA9, 0x9A, 0x9A, 0x09	}
+	},
+  {-646, 57, 0, {
+    0xA9, 0xA2, 0xEF, 0x8B, 0x12, 0x22, 0x13, 0x33, 0x78, 0x25, 0x80, 0x9A, 0x9C, 0x99, 0x99, 0x89,
+    0xDE, 0x9A, 0x21, 0x14, 0x13, 0x41, 0x36, 0x90, 0xA9, 0xBA, 0x8B, 0x8A, 0xFC, 0xAB, 0x21, 0x23,
+    0x24, 0x72, 0x04, 0x90, 0xA9, 0xAA, 0x0A, 0xFA, 0xAB, 0x20, 0x32, 0x32, 0x57, 0x01, 0x89, 0xAA,
+    0xA9, 0xC9, 0xBD, 0x28, 0x31, 0x42, 0x37, 0x00, 0x99, 0xAA, 0xA9, 0xEC, 0x99, 0x11, 0x22, 0x55	}
+	},
+  {10645, 77, 0, {
+    0x02, 0x98, 0x9A, 0x9A, 0xDD, 0x89, 0x11, 0x32, 0x36, 0x01, 0x99, 0xBA, 0xF9, 0x9B, 0x08, 0x32,
+    0x55, 0x02, 0x88, 0xAA, 0xD9, 0x9C, 0x19, 0x22, 0x54, 0x02, 0xA0, 0xA9, 0xFB, 0x8A, 0x00, 0x42,
+    0x34, 0x80, 0x99, 0xCA, 0x9E, 0x09, 0x12, 0x35, 0x02, 0xA8, 0xB9, 0xBF, 0x08, 0x20, 0x36, 0x01,
+    0xA8, 0xB9, 0x9F, 0x19, 0x30, 0x25, 0x81, 0xA8, 0xEA, 0x9A, 0x00, 0x63, 0x12, 0x90, 0xA9, 0xAE	}
+	},
+  {-23110, 82, 0, {
+    0x09, 0x31, 0x25, 0x01, 0xA9, 0xBD, 0x8A, 0x20, 0x27, 0x01, 0x98, 0xEB, 0x99, 0x20, 0x44, 0x81,
+    0x88, 0xCC, 0x89, 0x20, 0x25, 0x81, 0xA8, 0xAD, 0x0A, 0x41, 0x24, 0x80, 0xC9, 0xAC, 0x08, 0x44,
+    0x02, 0x88, 0xCC, 0x99, 0x31, 0x15, 0x81, 0xD8, 0xAB, 0x18, 0x35, 0x01, 0x98, 0xAE, 0x89, 0x52,
+    0x12, 0x90, 0xDB, 0x8A, 0x41, 0x23, 0x80, 0xFB, 0x8A, 0x30, 0x24, 0x80, 0xEA, 0x8A, 0x30, 0x15	}
+	},
+  {25180, 85, 0, {
+    0x80, 0xDA, 0x99, 0x31, 0x14, 0x80, 0xCC, 0x89, 0x42, 0x12, 0xA0, 0xAE, 0x09, 0x34, 0x01, 0xC8,
+    0x9C, 0x28, 0x25, 0x80, 0xDA, 0x8A, 0x42, 0x12, 0xA8, 0xAD, 0x19, 0x25, 0x01, 0xDA, 0x9A, 0x51,
+    0x02, 0xA0, 0x9D, 0x29, 0x33, 0x81, 0xDC, 0x89, 0x43, 0x02, 0xD9, 0x9A, 0x40, 0x13, 0xB0, 0x9E,
+    0x28, 0x14, 0x91, 0xAD, 0x19, 0x24, 0x81, 0xDB, 0x89, 0x34, 0x01, 0xDB, 0x8A, 0x43, 0x12, 0xDB	}
+	},
+  {-10475, 86, 0, {
+    0x8A, 0x52, 0x11, 0xCA, 0x9A, 0x52, 0x11, 0xD9, 0x8A, 0x42, 0x11, 0xBB, 0x8C, 0x24, 0x02, 0xDB,
+    0x0A, 0x34, 0x81, 0xBC, 0x1A, 0x16, 0x91, 0xAC, 0x38, 0x14, 0xC0, 0x9B, 0x50, 0x12, 0xD9, 0x8A,
+    0x33, 0x02, 0xBD, 0x1A, 0x16, 0xA1, 0xAC, 0x40, 0x12, 0xD8, 0x8A, 0x42, 0x01, 0xBC, 0x29, 0x24,
+    0xC0, 0x9B, 0x51, 0x02, 0xCB, 0x1A, 0x15, 0xB1, 0xBB, 0x61, 0x02, 0xCA, 0x1A, 0x14, 0xB1, 0x9C	}
+	},
+  {-30466, 85, 0, {
+    0x51, 0x02, 0xCB, 0x19, 0x15, 0xA0, 0xAC, 0x51, 0x11, 0xBB, 0x1B, 0x16, 0xA1, 0xAC, 0x40, 0x12,
+    0xD9, 0x0A, 0x33, 0x92, 0xAD, 0x3A, 0x24, 0xC0, 0x9C, 0x40, 0x12, 0xD9, 0x99, 0x42, 0x01, 0xAC,
+    0x09, 0x15, 0x91, 0xAC, 0x38, 0x14, 0xA0, 0x9D, 0x48, 0x22, 0xC8, 0x9B, 0x51, 0x02, 0xD8, 0x8A,
+    0x32, 0x12, 0xDA, 0x8B, 0x62, 0x01, 0xC9, 0x8A, 0x42, 0x11, 0xDA, 0x8A, 0x42, 0x02, 0xD9, 0x8A	}
+	},
+  {-29931, 85, 0, {
+    0x50, 0x11, 0xC8, 0x9A, 0x41, 0x12, 0xC0, 0xAB, 0x48, 0x23, 0xB1, 0xAE, 0x18, 0x24, 0x81, 0xCC,
+    0x09, 0x33, 0x12, 0xFA, 0x8A, 0x40, 0x12, 0xA0, 0x9E, 0x18, 0x23, 0x81, 0xEB, 0x89, 0x41, 0x12,
+    0xB8, 0x9D, 0x28, 0x34, 0x00, 0xCC, 0x99, 0x42, 0x13, 0xB0, 0x9E, 0x19, 0x24, 0x01, 0xC9, 0xAB,
+    0x40, 0x24, 0x80, 0xDB, 0x8A, 0x50, 0x13, 0x90, 0xCC, 0x89, 0x42, 0x12, 0xA0, 0xCC, 0x09, 0x42	}
+	},
+  {5557, 83, 0, {
+    0x03, 0xA8, 0xBD, 0x89, 0x63, 0x12, 0x88, 0xCC, 0x09, 0x41, 0x12, 0x90, 0xDB, 0x9A, 0x41, 0x23,
+    0x81, 0xFA, 0x9A, 0x28, 0x34, 0x00, 0xA8, 0xAE, 0x88, 0x52, 0x12, 0x98, 0xDA, 0x9A, 0x10, 0x35,
+    0x81, 0xA8, 0xCC, 0x09, 0x41, 0x14, 0x80, 0xB8, 0x9E, 0x08, 0x52, 0x02, 0x80, 0xC9, 0x9C, 0x00,
+    0x52, 0x12, 0x88, 0xD9, 0x9B, 0x08, 0x72, 0x11, 0x90, 0xA8, 0x9D, 0x09, 0x31, 0x15, 0x81, 0x99	}
+	},
+  {14782, 77, 0, {
+    0xCC, 0x8A, 0x11, 0x53, 0x02, 0x98, 0xB9, 0xAE, 0x18, 0x31, 0x26, 0x00, 0x99, 0xDA, 0x9B, 0x29,
+    0x51, 0x14, 0x81, 0x9A, 0xE9, 0x9B, 0x10, 0x31, 0x26, 0x81, 0xA8, 0xB9, 0x9F, 0x09, 0x11, 0x63,
+    0x01, 0x98, 0xA8, 0xDA, 0x8A, 0x10, 0x32, 0x27, 0x81, 0x98, 0x9A, 0xDB, 0x8A, 0x11, 0x33, 0x37,
+    0x81, 0xA8, 0x9A, 0xDA, 0xAB, 0x10, 0x32, 0x55, 0x13, 0x98, 0xAA, 0xAA, 0xDC, 0x9A, 0x21, 0x13	}
+	},
+  {-3757, 68, 0, {
+    0x73, 0x13, 0x98, 0xAB, 0x9A, 0xEC, 0x8B, 0x10, 0x32, 0x43, 0x35, 0x80, 0xA9, 0xAA, 0xBA, 0xF9,
+    0x8B, 0x28, 0x22, 0x23, 0x46, 0x01, 0x9A, 0xAB, 0xB9, 0x89, 0xCF, 0x09, 0x22, 0x22, 0x21, 0x73,
+    0x92, 0x98, 0xAB, 0xAA, 0x88, 0x9A, 0xCF, 0x08, 0x22, 0x33, 0x32, 0x72, 0x05, 0x90, 0x9A, 0x99,
+    0x89, 0x88, 0x90, 0xBF, 0x08, 0x21, 0x24, 0x22, 0x01, 0x71, 0x04, 0xB0, 0x99, 0x8C, 0x0B, 0xA8	}
+	},
+  {418, 60, 0, {
+    0x80, 0x09, 0xCF, 0x0A, 0x10, 0x23, 0x32, 0x93, 0x92, 0x23, 0x77, 0x80, 0xB9, 0xA8, 0xAA, 0x88,
+    0x0A, 0x89, 0xB9, 0x94, 0x9A, 0xFE, 0x09, 0x11, 0x42, 0x28, 0x02, 0x38, 0x08, 0x00, 0x90, 0x37,
+    0x05, 0xC0, 0xA8, 0x0B, 0xAA, 0x88, 0x3A, 0x9C, 0xC3, 0xA1, 0x49, 0xA8, 0x91, 0x60, 0x99, 0x41,
+    0x99, 0xCF, 0x18, 0x13, 0x32, 0x70, 0x80, 0x10, 0x00, 0xB2, 0xB5, 0x83, 0x71, 0x03, 0x90, 0xCC	}
+	},
+  {3705, 61, 0, {
+    0x98, 0x9A, 0x0A, 0x8A, 0x29, 0x8C, 0xB1, 0xB3, 0xF8, 0xBF, 0x18, 0x21, 0x34, 0x21, 0x11, 0x93,
+    0x22, 0x77, 0x01, 0x9A, 0xB9, 0xB8, 0x99, 0xA8, 0x81, 0x0A, 0xFF, 0x8B, 0x21, 0x21, 0x33, 0x20,
+    0x31, 0x67, 0x81, 0xC8, 0xB0, 0x89, 0x1A, 0x1A, 0xDA, 0xAD, 0x19, 0x23, 0x32, 0x13, 0x74, 0x14,
+    0x98, 0x9A, 0xAB, 0xA9, 0x19, 0xEE, 0x99, 0x11, 0x22, 0x22, 0x73, 0x04, 0x90, 0xB9, 0xA9, 0x99	}
+	},
+  {-1248, 63, 0, {
+    0xD9, 0x9F, 0x00, 0x21, 0x12, 0x73, 0x12, 0xA0, 0xAA, 0xA9, 0x99, 0xBF, 0x99, 0x22, 0x42, 0x72,
+    0x13, 0x98, 0xB9, 0xB9, 0xD8, 0xBC, 0x19, 0x33, 0x61, 0x25, 0x01, 0xB9, 0xA9, 0xBA, 0xBF, 0x08,
+    0x22, 0x62, 0x24, 0x80, 0x99, 0x9B, 0xDC, 0x9A, 0x11, 0x31, 0x37, 0x02, 0x99, 0xAA, 0xFA, 0x8B,
+    0x18, 0x31, 0x36, 0x02, 0xA8, 0xAA, 0xFB, 0x9B, 0x11, 0x52, 0x24, 0x81, 0xA9, 0xC9, 0xBD, 0x08	}
+	},
+  {-24789, 76, 0, {
+    0x12, 0x36, 0x12, 0x99, 0xAA, 0xAF, 0x89, 0x11, 0x35, 0x12, 0x98, 0xBA, 0xAF, 0x0A, 0x21, 0x36,
+    0x81, 0xA0, 0xD9, 0xAB, 0x08, 0x62, 0x14, 0x80, 0x99, 0xCC, 0x89, 0x20, 0x44, 0x82, 0x98, 0xDA,
+    0x9B, 0x00, 0x54, 0x12, 0x98, 0xC9, 0xAC, 0x18, 0x62, 0x12, 0x88, 0xC9, 0x9C, 0x08, 0x53, 0x12,
+    0x88, 0xDA, 0x9B, 0x18, 0x45, 0x01, 0x98, 0xDB, 0x8A, 0x31, 0x25, 0x81, 0xC9, 0xAC, 0x08, 0x63	}
+	},
+  {8038, 85, 0, {
+    0x02, 0x88, 0xBC, 0x8A, 0x50, 0x23, 0x81, 0xEA, 0xAA, 0x28, 0x25, 0x02, 0xA9, 0x9F, 0x88, 0x43,
+    0x11, 0xA8, 0xBC, 0x89, 0x73, 0x01, 0x90, 0xAC, 0x89, 0x53, 0x02, 0xA0, 0xAD, 0x09, 0x43, 0x03,
+    0xA8, 0x9F, 0x09, 0x43, 0x01, 0xB8, 0xAD, 0x28, 0x25, 0x00, 0xDA, 0x8A, 0x40, 0x13, 0x90, 0xBD,
+    0x09, 0x53, 0x02, 0xC8, 0x9C, 0x38, 0x24, 0x80, 0xCC, 0x89, 0x43, 0x02, 0xC8, 0x9C, 0x48, 0x22	}
+	},
+  {24731, 84, 0, {
+    0x90, 0xBC, 0x0A, 0x26, 0x01, 0xDA, 0x99, 0x32, 0x13, 0xD8, 0xAB, 0x58, 0x23, 0xA0, 0xAE, 0x18,
+    0x24, 0x91, 0xBC, 0x09, 0x35, 0x81, 0xDB, 0x0A, 0x43, 0x02, 0xDB, 0x8A, 0x53, 0x01, 0xCA, 0x8A,
+    0x43, 0x11, 0xDA, 0x9A, 0x53, 0x01, 0xCA, 0x8A, 0x34, 0x01, 0xCC, 0x09, 0x24, 0x81, 0xBC, 0x19,
+    0x25, 0xA1, 0xAC, 0x39, 0x24, 0xC0, 0xAB, 0x60, 0x02, 0xC8, 0x9A, 0x33, 0x03, 0xDC, 0x09, 0x24	}
+	},
+  {20112, 86, 0, {
+    0x91, 0xAD, 0x38, 0x23, 0xE0, 0x9A, 0x42, 0x01, 0xCB, 0x19, 0x24, 0xB1, 0xAC, 0x50, 0x12, 0xDA,
+    0x89, 0x24, 0xA1, 0xAC, 0x40, 0x12, 0xD9, 0x0A, 0x14, 0xA2, 0xAC, 0x40, 0x12, 0xCA, 0x0A, 0x24,
+    0xA2, 0x9E, 0x48, 0x12, 0xD9, 0x0A, 0x33, 0x92, 0xAE, 0x38, 0x23, 0xE8, 0x8A, 0x32, 0x12, 0xBD,
+    0x1A, 0x25, 0xA1, 0x9D, 0x38, 0x23, 0xD9, 0x9A, 0x52, 0x11, 0xCB, 0x0A, 0x34, 0x91, 0xAD, 0x29	}
+	},
+  {-17380, 84, 0, {
+    0x24, 0xA0, 0xAD, 0x30, 0x14, 0xC0, 0xAB, 0x41, 0x13, 0xD9, 0x9A, 0x51, 0x02, 0xC9, 0x9A, 0x52,
+    0x11, 0xCA, 0x8A, 0x52, 0x11, 0xCA, 0x9A, 0x52, 0x11, 0xC9, 0x8B, 0x51, 0x02, 0xC8, 0x9B, 0x41,
+    0x13, 0xC8, 0xBB, 0x50, 0x13, 0xB1, 0xAD, 0x29, 0x25, 0x80, 0xDB, 0x09, 0x43, 0x01, 0xE9, 0x99,
+    0x31, 0x13, 0xC0, 0xAC, 0x38, 0x24, 0x81, 0xBD, 0x89, 0x53, 0x02, 0xC9, 0xAB, 0x40, 0x14, 0x91	}
+	},
+  {21653, 82, 0, {
+    0xBC, 0x8A, 0x44, 0x02, 0xB8, 0xAD, 0x28, 0x25, 0x00, 0xDA, 0x8A, 0x40, 0x13, 0x90, 0xCC, 0x89,
+    0x43, 0x12, 0xA8, 0xBD, 0x88, 0x35, 0x01, 0xA8, 0x9E, 0x19, 0x33, 0x03, 0xC8, 0x9E, 0x19, 0x33,
+    0x03, 0xC8, 0xAD, 0x88, 0x34, 0x03, 0x98, 0xBE, 0x89, 0x43, 0x23, 0x98, 0xFB, 0x99, 0x30, 0x15,
+    0x00, 0xC9, 0x9B, 0x19, 0x35, 0x02, 0xA8, 0xBD, 0x89, 0x50, 0x14, 0x80, 0xC8, 0xAB, 0x19, 0x54	}
+	},
+  {10255, 84, 0, {
+    0x11, 0x98, 0xDA, 0x9A, 0x11, 0x44, 0x01, 0x99, 0xEA, 0x89, 0x10, 0x25, 0x81, 0x98, 0xDB, 0x8A,
+    0x20, 0x35, 0x01, 0x98, 0xEB, 0x9A, 0x10, 0x44, 0x11, 0x98, 0xC9, 0x9C, 0x19, 0x51, 0x23, 0x80,
+    0x9A, 0xDC, 0x99, 0x11, 0x53, 0x03, 0x98, 0xA9, 0xAF, 0x88, 0x21, 0x34, 0x02, 0xA8, 0xC9, 0x9E,
+    0x09, 0x21, 0x34, 0x12, 0x99, 0xAA, 0xBF, 0x89, 0x11, 0x44, 0x13, 0x90, 0xAA, 0xEA, 0xAB, 0x10	}
+	},
+  {-19259, 73, 0, {
+    0x41, 0x35, 0x01, 0xA8, 0xB9, 0xFA, 0x9A, 0x20, 0x21, 0x36, 0x01, 0x99, 0xAA, 0xF9, 0x9A, 0x00,
+    0x22, 0x72, 0x02, 0x90, 0x9A, 0xA9, 0xDB, 0x8A, 0x12, 0x22, 0x37, 0x11, 0x99, 0xAA, 0xAA, 0xEB,
+    0x8B, 0x30, 0x32, 0x54, 0x05, 0x90, 0xA9, 0xB8, 0x89, 0xAE, 0x1A, 0x21, 0x32, 0x72, 0x13, 0x90,
+    0xB9, 0xBA, 0xB8, 0xF9, 0xAB, 0x21, 0x41, 0x22, 0x72, 0x03, 0x98, 0x9A, 0xBB, 0x98, 0xA8, 0xDE	}
+	},
+  {-12770, 70, 0, {
+    0x19, 0x30, 0x22, 0x12, 0x44, 0x14, 0xB0, 0xBA, 0xC9, 0x88, 0x8A, 0xF0, 0xAB, 0x28, 0x51, 0x11,
+    0x12, 0x31, 0x36, 0x91, 0xC9, 0xBA, 0xB8, 0x88, 0x89, 0x18, 0xFE, 0x0A, 0x28, 0x23, 0x22, 0x20,
+    0x01, 0x62, 0x06, 0x90, 0xAA, 0xB9, 0x8A, 0x1A, 0xD8, 0x02, 0x8A, 0xA0, 0xDF, 0x19, 0x21, 0x31,
+    0x13, 0x02, 0x28, 0x80, 0x04, 0x72, 0x24, 0xB9, 0xCA, 0xC8, 0x88, 0x1D, 0x88, 0xA1, 0x80, 0x90	}
+	},
+  {-2740, 53, 0, {
+    0xC1, 0x91, 0x21, 0x2E, 0xC0, 0x8D, 0x39, 0x42, 0x01, 0x85, 0x82, 0x00, 0x18, 0x08, 0x28, 0x21,
+    0x2E, 0x59, 0x43, 0xB3, 0xD8, 0xAB, 0x9C, 0xC2, 0x8A, 0xA1, 0xB3, 0x4E, 0x0B, 0x08, 0xB1, 0xF2,
+    0x9D, 0x10, 0x32, 0x60, 0x00, 0x01, 0x01, 0x80, 0x45, 0x93, 0xA2, 0xCB, 0x9A, 0x8B, 0xAA, 0x29,
+    0xBA, 0x91, 0xFF, 0x0F, 0x10, 0x20, 0x11, 0x00, 0x02, 0x54, 0x02, 0xB0, 0xCA, 0x99, 0x89, 0xAA	}
+	},
+  {-2227, 57, 0, {
+    0x01, 0xFD, 0x0C, 0x28, 0x30, 0x21, 0x03, 0x36, 0x23, 0xB8, 0x9C, 0x9C, 0xA9, 0x88, 0xEC, 0x8C,
+    0x10, 0x32, 0x31, 0x62, 0x15, 0x00, 0xBA, 0xC8, 0x99, 0x89, 0xBE, 0x0A, 0x40, 0x22, 0x42, 0x36,
+    0x91, 0xA9, 0xAA, 0xBA, 0xF8, 0x9C, 0x08, 0x32, 0x32, 0x46, 0x02, 0xA8, 0xBA, 0xB9, 0xF9, 0x9C,
+    0x20, 0x21, 0x62, 0x23, 0x81, 0xBA, 0xAB, 0xF9, 0x9C, 0x08, 0x22, 0x62, 0x14, 0x00, 0xAA, 0xA9	}
+	},
+  {2652, 70, 0, {
+    0xFB, 0x8A, 0x00, 0x32, 0x45, 0x02, 0x98, 0xAA, 0xEA, 0xAB, 0x18, 0x32, 0x55, 0x12, 0x98, 0xAA,
+    0xEA, 0xAB, 0x10, 0x32, 0x37, 0x01, 0x99, 0x9A, 0xAF, 0x89, 0x01, 0x54, 0x02, 0x80, 0x9A, 0xEB,
+    0x9A, 0x01, 0x53, 0x14, 0x80, 0x9A, 0xEB, 0x8A, 0x10, 0x72, 0x11, 0x90, 0x99, 0xBC, 0x89, 0x30,
+    0x36, 0x02, 0xA8, 0xE9, 0xAB, 0x18, 0x62, 0x13, 0x80, 0xB9, 0xBD, 0x0A, 0x40, 0x26, 0x00, 0x99	}
+	},
+  {13980, 79, 0, {
+    0xDB, 0x8A, 0x20, 0x26, 0x01, 0x98, 0xCC, 0x99, 0x21, 0x25, 0x01, 0x99, 0xBD, 0x0A, 0x50, 0x33,
+    0x80, 0xC8, 0xAD, 0x09, 0x62, 0x12, 0x88, 0xDA, 0x9A, 0x10, 0x16, 0x01, 0xA8, 0xBC, 0x88, 0x53,
+    0x13, 0x88, 0xCC, 0x9A, 0x40, 0x24, 0x80, 0xC9, 0xAB, 0x18, 0x27, 0x01, 0xA9, 0xAD, 0x08, 0x34,
+    0x02, 0xB8, 0xAE, 0x08, 0x53, 0x01, 0xB0, 0xAD, 0x08, 0x34, 0x02, 0xC8, 0x9D, 0x18, 0x24, 0x01	}
+	},
+  {26693, 82, 0, {
+    0xD9, 0x9A, 0x38, 0x25, 0x80, 0xDB, 0x8A, 0x51, 0x12, 0x98, 0xAD, 0x08, 0x43, 0x02, 0xD9, 0x9B,
+    0x40, 0x23, 0x90, 0xBD, 0x0A, 0x44, 0x11, 0xC9, 0xAB, 0x50, 0x13, 0x90, 0xBD, 0x19, 0x34, 0x82,
+    0xFA, 0x89, 0x31, 0x13, 0xD8, 0xAB, 0x40, 0x23, 0xB1, 0xAE, 0x29, 0x24, 0x81, 0xBD, 0x09, 0x25,
+    0x01, 0xDB, 0x89, 0x43, 0x01, 0xDA, 0x89, 0x42, 0x11, 0xDA, 0x8A, 0x33, 0x03, 0xEB, 0x8A, 0x43	}
+	},
+  {11393, 85, 0, {
+    0x02, 0xDB, 0x8A, 0x34, 0x01, 0xDB, 0x0A, 0x24, 0x82, 0xBC, 0x1A, 0x25, 0xA2, 0xBC, 0x39, 0x15,
+    0xB1, 0xAC, 0x58, 0x12, 0xC8, 0xAA, 0x52, 0x11, 0xDA, 0x89, 0x24, 0x91, 0xCB, 0x28, 0x24, 0xC0,
+    0xAB, 0x42, 0x12, 0xDB, 0x0A, 0x25, 0xA1, 0xAC, 0x30, 0x14, 0xC9, 0x8B, 0x34, 0x81, 0xAD, 0x39,
+    0x24, 0xC9, 0x8B, 0x43, 0x82, 0xBD, 0x48, 0x22, 0xD9, 0x8A, 0x24, 0x81, 0xAD, 0x38, 0x23, 0xE8	}
+	},
+  {-5462, 88, 0, {
+    0x8A, 0x33, 0x01, 0xAE, 0x29, 0x14, 0xC0, 0x9A, 0x51, 0x11, 0xCB, 0x09, 0x24, 0x91, 0xAD, 0x38,
+    0x14, 0xC8, 0x9A, 0x51, 0x01, 0xBA, 0x0B, 0x35, 0x81, 0xBD, 0x28, 0x14, 0xA1, 0xAD, 0x30, 0x14,
+    0xC8, 0xAA, 0x51, 0x21, 0xD9, 0x8A, 0x32, 0x12, 0xDA, 0x8B, 0x53, 0x11, 0xCB, 0x8A, 0x43, 0x12,
+    0xCC, 0x0A, 0x43, 0x11, 0xDB, 0x8A, 0x43, 0x11, 0xDA, 0x8A, 0x42, 0x02, 0xD8, 0x9A, 0x50, 0x02	}
+	},
+  {23840, 85, 0, {
+    0xB0, 0xAC, 0x40, 0x22, 0xA0, 0xAD, 0x29, 0x25, 0x80, 0xDB, 0x89, 0x43, 0x02, 0xD9, 0x9A, 0x50,
+    0x02, 0x90, 0x9D, 0x19, 0x24, 0x81, 0xDA, 0x99, 0x42, 0x12, 0xA8, 0x9E, 0x19, 0x24, 0x81, 0xD9,
+    0x9A, 0x41, 0x22, 0x98, 0xAD, 0x89, 0x34, 0x02, 0xC8, 0x9C, 0x29, 0x25, 0x81, 0xD9, 0x9A, 0x30,
+    0x24, 0x81, 0xEB, 0x8A, 0x40, 0x13, 0x80, 0xEB, 0x99, 0x41, 0x22, 0x80, 0xCC, 0x99, 0x31, 0x15	}
+	},
+  {20980, 83, 0, {
+    0x80, 0xCA, 0x9B, 0x40, 0x24, 0x81, 0xD9, 0x9B, 0x29, 0x35, 0x01, 0xB8, 0xBD, 0x09, 0x53, 0x13,
+    0x88, 0xCC, 0x9A, 0x30, 0x26, 0x00, 0xA9, 0xAD, 0x88, 0x52, 0x12, 0x80, 0xCA, 0x9C, 0x18, 0x34,
+    0x03, 0x98, 0xFB, 0x9A, 0x20, 0x34, 0x02, 0x99, 0xDC, 0x8A, 0x20, 0x44, 0x01, 0x98, 0xDB, 0x9A,
+    0x10, 0x54, 0x01, 0x88, 0xBA, 0x9D, 0x08, 0x52, 0x13, 0x80, 0x9A, 0xAE, 0x89, 0x11, 0x35, 0x02	}
+	},
+  {22726, 77, 0, {
+    0xA8, 0xCA, 0x8E, 0x19, 0x31, 0x24, 0x81, 0x99, 0xEB, 0x9B, 0x00, 0x43, 0x25, 0x80, 0xA9, 0xD9,
+    0x9B, 0x29, 0x31, 0x27, 0x82, 0x99, 0x9A, 0xAE, 0x89, 0x12, 0x63, 0x03, 0x90, 0x9A, 0xDA, 0xAB,
+    0x18, 0x22, 0x46, 0x11, 0x98, 0xA9, 0xBA, 0x9F, 0x08, 0x21, 0x63, 0x21, 0x98, 0xA9, 0xA9, 0xDC,
+    0x09, 0x20, 0x22, 0x36, 0x82, 0xA9, 0xAA, 0xA9, 0xAF, 0x89, 0x22, 0x22, 0x55, 0x01, 0x98, 0xAA	}
+	},
+  {4996, 70, 0, {
+    0x8A, 0xEB, 0x9A, 0x20, 0x22, 0x33, 0x37, 0x01, 0xBA, 0xAA, 0xA9, 0xEA, 0x9C, 0x28, 0x22, 0x33,
+    0x72, 0x04, 0x98, 0xA9, 0xAA, 0xA8, 0xD0, 0xAC, 0x28, 0x32, 0x22, 0x43, 0x27, 0x00, 0xAA, 0xAA,
+    0x9A, 0x9A, 0xD2, 0xAE, 0x29, 0x21, 0x33, 0x11, 0x63, 0x24, 0xA0, 0xAA, 0xBB, 0xAA, 0xB1, 0x89,
+    0xF1, 0x9F, 0x18, 0x31, 0x12, 0x12, 0x11, 0x73, 0x13, 0xB9, 0xBA, 0x9C, 0x9A, 0xA0, 0xA0, 0x10	}
+	},
+  {-2109, 52, 0, {
+    0xFA, 0xAE, 0x08, 0x33, 0x41, 0x21, 0x91, 0x03, 0x38, 0x76, 0x18, 0x9A, 0x99, 0xBA, 0x88, 0x09,
+    0x1B, 0x09, 0x8A, 0xD5, 0xC2, 0xE2, 0x8A, 0x39, 0x30, 0x53, 0x20, 0x18, 0x88, 0x93, 0x94, 0x10,
+    0xA8, 0x72, 0x05, 0x08, 0xAC, 0xB0, 0xA9, 0x8A, 0xA8, 0xC4, 0x18, 0x8B, 0x80, 0x3C, 0x2B, 0x01,
+    0xBA, 0xB4, 0xF5, 0xAD, 0x18, 0x14, 0x32, 0x13, 0x11, 0x69, 0x80, 0x92, 0x20, 0x67, 0x80, 0x8A	}
+	},
+  {6471, 61, 0, {
+    0x8C, 0xB9, 0x98, 0x98, 0x91, 0x90, 0x8A, 0xF8, 0xBF, 0x00, 0x22, 0x14, 0x11, 0x12, 0x58, 0x70,
+    0x11, 0xA8, 0xB8, 0xB9, 0xC9, 0xA1, 0xA1, 0x90, 0xFF, 0x09, 0x01, 0x13, 0x21, 0x01, 0x64, 0x12,
+    0x89, 0x9B, 0x9C, 0xA9, 0xB1, 0xC8, 0xBF, 0x08, 0x23, 0x42, 0x21, 0x73, 0x13, 0xA8, 0xAB, 0xAB,
+    0xA9, 0xB9, 0xFF, 0x08, 0x20, 0x12, 0x41, 0x34, 0x92, 0xAA, 0xBA, 0x9B, 0xD9, 0xAF, 0x88, 0x12	}
+	},
+  {-11162, 67, 0, {
+    0x14, 0x72, 0x12, 0x90, 0xAA, 0x9A, 0xA9, 0xCE, 0x89, 0x12, 0x33, 0x64, 0x02, 0xA0, 0xA9, 0x9A,
+    0xFB, 0x8B, 0x28, 0x40, 0x53, 0x14, 0x88, 0xA9, 0xAA, 0xFA, 0x9A, 0x28, 0x13, 0x55, 0x02, 0xA8,
+    0xA9, 0xB9, 0xAF, 0x08, 0x12, 0x73, 0x12, 0x98, 0xA8, 0xAA, 0x9F, 0x09, 0x12, 0x63, 0x02, 0x90,
+    0xA9, 0xF9, 0x8A, 0x18, 0x40, 0x24, 0x81, 0xA8, 0xB9, 0xAF, 0x08, 0x11, 0x44, 0x02, 0x98, 0xAA	}
+	},
+  {4897, 74, 0, {
+    0xAE, 0x0A, 0x21, 0x45, 0x01, 0x98, 0xB9, 0xAE, 0x08, 0x31, 0x26, 0x81, 0x99, 0xEA, 0x9A, 0x10,
+    0x62, 0x12, 0x88, 0xB9, 0xAD, 0x09, 0x41, 0x24, 0x81, 0x99, 0xAE, 0x8A, 0x30, 0x26, 0x01, 0x99,
+    0xEB, 0x99, 0x11, 0x35, 0x00, 0x98, 0xBD, 0x8A, 0x31, 0x26, 0x81, 0xA8, 0xAE, 0x09, 0x41, 0x23,
+    0x80, 0xDA, 0x9C, 0x18, 0x34, 0x12, 0x89, 0xCD, 0x8A, 0x41, 0x23, 0x81, 0xE9, 0xAB, 0x28, 0x35	}
+	},
+  {15564, 82, 0, {
+    0x01, 0xB8, 0xAE, 0x88, 0x53, 0x02, 0x90, 0xCC, 0x89, 0x51, 0x12, 0x90, 0xDB, 0x99, 0x51, 0x12,
+    0x80, 0xDB, 0x8A, 0x41, 0x23, 0x90, 0xDC, 0x89, 0x32, 0x14, 0x98, 0xAD, 0x0A, 0x53, 0x02, 0xA8,
+    0x9E, 0x19, 0x24, 0x01, 0xC9, 0xAB, 0x40, 0x24, 0x80, 0xCC, 0x89, 0x42, 0x12, 0xB8, 0xAD, 0x28,
+    0x25, 0x00, 0xBC, 0x9A, 0x34, 0x13, 0xD8, 0x9C, 0x38, 0x24, 0x80, 0xBD, 0x09, 0x34, 0x02, 0xEA	}
+	},
+  {-7101, 86, 0, {
+    0x9A, 0x42, 0x12, 0xC8, 0xAB, 0x58, 0x13, 0xB1, 0xAD, 0x39, 0x24, 0x91, 0xAD, 0x1A, 0x25, 0x81,
+    0xBC, 0x09, 0x34, 0x82, 0xCC, 0x89, 0x34, 0x01, 0xEB, 0x09, 0x42, 0x01, 0xAC, 0x0A, 0x24, 0x82,
+    0xBC, 0x1A, 0x25, 0x81, 0xAD, 0x19, 0x15, 0x91, 0xAC, 0x39, 0x24, 0xB0, 0xAD, 0x40, 0x22, 0xC9,
+    0x9B, 0x52, 0x02, 0xDA, 0x09, 0x33, 0x92, 0xAE, 0x39, 0x23, 0xD1, 0xAB, 0x42, 0x13, 0xEB, 0x89	}
+	},
+  {-27968, 85, 0, {
+    0x24, 0x91, 0x9D, 0x38, 0x22, 0xD8, 0x8B, 0x43, 0x82, 0xAD, 0x39, 0x23, 0xE0, 0x9A, 0x33, 0x83,
+    0xAE, 0x39, 0x23, 0xE0, 0x9A, 0x43, 0x81, 0xBC, 0x38, 0x14, 0xD0, 0x9A, 0x42, 0x82, 0xBC, 0x28,
+    0x24, 0xC0, 0xAB, 0x52, 0x02, 0xDA, 0x09, 0x33, 0x91, 0xAE, 0x38, 0x14, 0xC8, 0x9A, 0x42, 0x02,
+    0xCB, 0x0A, 0x34, 0x81, 0xAE, 0x18, 0x24, 0xA0, 0x9D, 0x20, 0x23, 0xD8, 0x9B, 0x51, 0x12, 0xD9	}
+	},
+  {-6980, 87, 0, {
+    0x8A, 0x32, 0x22, 0xEB, 0x8A, 0x33, 0x03, 0xFB, 0x89, 0x33, 0x02, 0xCC, 0x0A, 0x43, 0x11, 0xEB,
+    0x89, 0x33, 0x02, 0xEB, 0x99, 0x43, 0x11, 0xD9, 0x9A, 0x32, 0x23, 0xF8, 0x9A, 0x40, 0x12, 0xB0,
+    0xAC, 0x38, 0x24, 0x91, 0xBD, 0x09, 0x34, 0x02, 0xFA, 0x99, 0x32, 0x12, 0xC0, 0xAC, 0x38, 0x24,
+    0x81, 0xBD, 0x0A, 0x34, 0x02, 0xD8, 0xAB, 0x30, 0x25, 0x81, 0xBD, 0x0A, 0x43, 0x03, 0xC0, 0x9D	}
+	},
+  {-22320, 84, 0, {
+    0x29, 0x43, 0x01, 0xDA, 0xAA, 0x31, 0x24, 0x81, 0xDC, 0x89, 0x31, 0x14, 0x90, 0xBD, 0x09, 0x43,
+    0x12, 0xA0, 0xBE, 0x08, 0x52, 0x02, 0xA0, 0xAD, 0x09, 0x33, 0x04, 0xA0, 0xBD, 0x89, 0x53, 0x12,
+    0x80, 0xDC, 0x99, 0x32, 0x33, 0x80, 0xFA, 0x9B, 0x20, 0x34, 0x01, 0xB8, 0xAF, 0x08, 0x32, 0x14,
+    0x90, 0xEA, 0x9A, 0x30, 0x43, 0x01, 0xA8, 0xBE, 0x09, 0x32, 0x15, 0x81, 0xC9, 0x9D, 0x08, 0x33	}
+	},
+  {2104, 78, 0, {
+    0x23, 0x90, 0xF9, 0x8C, 0x19, 0x33, 0x13, 0x91, 0xFA, 0xAB, 0x18, 0x43, 0x33, 0x88, 0xC9, 0xAE,
+    0x09, 0x32, 0x34, 0x81, 0x99, 0xDD, 0x8A, 0x20, 0x24, 0x03, 0xA1, 0xD9, 0xAC, 0x09, 0x42, 0x42,
+    0x01, 0x98, 0xEA, 0xAB, 0x00, 0x52, 0x23, 0x81, 0xA8, 0xEA, 0x9C, 0x08, 0x42, 0x23, 0x02, 0xA9,
+    0xBA, 0xBF, 0x0A, 0x32, 0x25, 0x13, 0x90, 0xAA, 0xFB, 0x9C, 0x10, 0x41, 0x23, 0x02, 0x98, 0xBB	}
+	},
+  {4607, 68, 0, {
+    0xFB, 0x8C, 0x28, 0x32, 0x24, 0x02, 0x98, 0xAB, 0xEA, 0x9D, 0x19, 0x22, 0x25, 0x02, 0x92, 0xA9,
+    0xAB, 0xFB, 0x8C, 0x10, 0x41, 0x23, 0x12, 0x91, 0xAA, 0x9C, 0xE9, 0x9D, 0x00, 0x21, 0x53, 0x02,
+    0x11, 0x99, 0xAA, 0xBA, 0xEB, 0x9D, 0x28, 0x31, 0x53, 0x03, 0x11, 0x90, 0xC9, 0xBA, 0x98, 0xED,
+    0x8A, 0x30, 0x21, 0x34, 0x14, 0x18, 0x81, 0xAB, 0xCA, 0xB8, 0xB0, 0xDF, 0x09, 0x30, 0x31, 0x32	}
+	},
+  {975, 62, 0, {
+    0x16, 0x80, 0x10, 0x99, 0x9C, 0xA9, 0xA8, 0x09, 0xDF, 0x8A, 0x21, 0x32, 0x12, 0x25, 0x03, 0xA1,
+    0x39, 0x99, 0xEA, 0x8A, 0xC8, 0x29, 0x0C, 0xF8, 0xAB, 0x20, 0x50, 0x02, 0x03, 0x41, 0x12, 0xB2,
+    0xA8, 0x29, 0x10, 0xAC, 0x8C, 0x9D, 0x90, 0x1A, 0xD8, 0x00, 0xF1, 0x8E, 0x29, 0x11, 0x04, 0x30,
+    0x80, 0x11, 0x00, 0x53, 0x00, 0x1B, 0xAC, 0x98, 0x11, 0x80, 0xF1, 0xA9, 0x8A, 0x3B, 0x0D, 0x09	}
+	},
+  {-2236, 50, 0, {
+    0x2C, 0x18, 0x4A, 0xF8, 0xA4, 0x92, 0x98, 0x9F, 0x10, 0x40, 0x20, 0x22, 0x00, 0x00, 0xB1, 0x05,
+    0x15, 0x12, 0x9B, 0xAB, 0x1D, 0x41, 0x0C, 0xBA, 0xC8, 0xA8, 0xC1, 0x90, 0x3B, 0x1E, 0xFC, 0xA9,
+    0x12, 0x23, 0x42, 0x82, 0x43, 0x50, 0x80, 0x89, 0x39, 0x09, 0x99, 0xFA, 0xC8, 0x90, 0x09, 0xFA,
+    0xAD, 0x38, 0x40, 0x11, 0x22, 0x16, 0x91, 0x88, 0x10, 0xB0, 0x89, 0x0F, 0x0B, 0x99, 0xDF, 0x09	}
+	},
+  {-12741, 68, 0, {
+    0x11, 0x22, 0x33, 0x06, 0x80, 0x00, 0x90, 0x8A, 0xCA, 0x1B, 0xDD, 0xAC, 0x00, 0x33, 0x53, 0x24,
+    0x80, 0x00, 0x90, 0xBA, 0xAB, 0xFA, 0xAF, 0x09, 0x12, 0x63, 0x12, 0x80, 0x11, 0xA8, 0xAA, 0x8B,
+    0xEF, 0x8A, 0x11, 0x41, 0x14, 0x01, 0x10, 0x99, 0x9B, 0xCA, 0xCF, 0x08, 0x11, 0x44, 0x01, 0x00,
+    0x91, 0xA9, 0xCA, 0xBE, 0x09, 0x31, 0x35, 0x12, 0x11, 0x99, 0xCA, 0xFA, 0x9C, 0x18, 0x62, 0x11	}
+	},
+  {7802, 76, 0, {
+    0x01, 0x81, 0xAA, 0xE9, 0x9C, 0x09, 0x24, 0x14, 0x20, 0x88, 0xA9, 0xFB, 0xAB, 0x10, 0x35, 0x21,
+    0x02, 0xA8, 0xBA, 0xDF, 0x09, 0x22, 0x14, 0x11, 0x80, 0x9A, 0xCF, 0x98, 0x31, 0x23, 0x22, 0x91,
+    0xCA, 0xBF, 0x09, 0x41, 0x22, 0x12, 0xA1, 0xEA, 0xAD, 0x18, 0x33, 0x32, 0x02, 0xB9, 0xDF, 0x99,
+    0x32, 0x22, 0x13, 0x90, 0xFC, 0xAA, 0x30, 0x32, 0x23, 0x91, 0xFA, 0x9D, 0x18, 0x23, 0x22, 0x81	}
+	},
+  {19719, 74, 0, {
+    0xFA, 0x9C, 0x20, 0x22, 0x22, 0x80, 0xFB, 0x9C, 0x21, 0x22, 0x13, 0xA0, 0xBF, 0x8A, 0x33, 0x33,
+    0x12, 0xFA, 0x9D, 0x18, 0x23, 0x22, 0x80, 0xBF, 0x8A, 0x23, 0x43, 0x00, 0xF9, 0x9B, 0x21, 0x23,
+    0x12, 0xD8, 0xAD, 0x28, 0x32, 0x13, 0xB0, 0xCF, 0x08, 0x13, 0x14, 0xA0, 0xAE, 0x19, 0x23, 0x13,
+    0xA0, 0xBF, 0x29, 0x32, 0x13, 0xD0, 0xAD, 0x28, 0x32, 0x13, 0xF8, 0xAB, 0x21, 0x42, 0x11, 0xFB	}
+	},
+  {-9993, 86, 0, {
+    0x0A, 0x21, 0x22, 0x91, 0xAF, 0x19, 0x32, 0x12, 0xE8, 0x9B, 0x21, 0x33, 0x01, 0xBF, 0x1A, 0x33,
+    0x22, 0xF8, 0xAB, 0x22, 0x33, 0xA2, 0xBF, 0x29, 0x33, 0x22, 0xDD, 0x0A, 0x22, 0x23, 0xE8, 0x8C,
+    0x11, 0x23, 0xB1, 0xAE, 0x10, 0x23, 0x93, 0xAF, 0x18, 0x22, 0x12, 0xCD, 0x19, 0x31, 0x13, 0xEC,
+    0x09, 0x22, 0x12, 0xFA, 0x09, 0x21, 0x12, 0xEA, 0x09, 0x31, 0x12, 0xFB, 0x19, 0x21, 0x02, 0xBC	}
+	},
+  {-15807, 83, 0, {
+    0x19, 0x42, 0x82, 0xBD, 0x18, 0x43, 0x91, 0x9F, 0x10, 0x22, 0xC1, 0x8C, 0x11, 0x23, 0xE9, 0x0A,
+    0x31, 0x03, 0xDC, 0x18, 0x22, 0xA2, 0x9F, 0x20, 0x22, 0xD8, 0x0A, 0x21, 0x13, 0xCD, 0x18, 0x32,
+    0xB1, 0x8F, 0x20, 0x22, 0xEA, 0x08, 0x22, 0xA1, 0x9D, 0x21, 0x22, 0xFA, 0x08, 0x22, 0xA1, 0x8E,
+    0x20, 0x12, 0xDA, 0x19, 0x32, 0xB2, 0x8F, 0x20, 0x12, 0xE9, 0x19, 0x21, 0x92, 0xAD, 0x11, 0x23	}
+	},
+  {21221, 81, 0, {
+    0xE8, 0x0A, 0x31, 0x12, 0xCD, 0x00, 0x32, 0xA1, 0x8F, 0x10, 0x22, 0xD8, 0x0A, 0x21, 0x13, 0xDC,
+    0x08, 0x22, 0x93, 0xBD, 0x10, 0x33, 0xB2, 0xAF, 0x11, 0x23, 0xD1, 0x8C, 0x20, 0x23, 0xE8, 0x0B,
+    0x21, 0x23, 0xF9, 0x0A, 0x21, 0x13, 0xF9, 0x1A, 0x11, 0x22, 0xDA, 0x1B, 0x31, 0x32, 0xF9, 0x0B,
+    0x21, 0x23, 0xE8, 0x8B, 0x21, 0x23, 0xD1, 0x9D, 0x11, 0x32, 0xA1, 0xBE, 0x20, 0x32, 0x02, 0xDD	}
+	},
+  {-16535, 85, 0, {
+    0x19, 0x31, 0x12, 0xF9, 0x0A, 0x11, 0x22, 0xB1, 0x9F, 0x10, 0x31, 0x11, 0xCD, 0x19, 0x21, 0x22,
+    0xD0, 0x9C, 0x20, 0x22, 0x12, 0xDD, 0x09, 0x11, 0x32, 0xA0, 0x9F, 0x28, 0x31, 0x21, 0xF9, 0x9A,
+    0x12, 0x31, 0x82, 0xEC, 0x09, 0x02, 0x22, 0x81, 0xAF, 0x19, 0x12, 0x12, 0x91, 0xAF, 0x18, 0x02,
+    0x13, 0xB1, 0xBF, 0x18, 0x13, 0x22, 0xA1, 0xBF, 0x29, 0x22, 0x32, 0x92, 0xCF, 0x09, 0x22, 0x22	}
+	},
+  {14509, 77, 0, {
+    0x11, 0xFB, 0x9B, 0x23, 0x12, 0x13, 0xE0, 0xAD, 0x20, 0x21, 0x31, 0x80, 0xDD, 0x8A, 0x32, 0x11,
+    0x03, 0xC0, 0xAF, 0x18, 0x22, 0x20, 0x82, 0xF8, 0x9C, 0x20, 0x12, 0x21, 0x00, 0xFB, 0x9B, 0x31,
+    0x12, 0x31, 0x91, 0xFC, 0x9B, 0x31, 0x22, 0x22, 0x02, 0xFA, 0x9D, 0x10, 0x22, 0x01, 0x02, 0xC0,
+    0xAF, 0x19, 0x22, 0x01, 0x12, 0x91, 0xFB, 0x9C, 0x38, 0x23, 0x21, 0x01, 0xA8, 0xEE, 0x8A, 0x31	}
+	},
+  {-10945, 77, 0, {
+    0x12, 0x01, 0x12, 0x99, 0xDE, 0x8A, 0x41, 0x12, 0x01, 0x11, 0x98, 0xFB, 0x9C, 0x30, 0x23, 0x82,
+    0x21, 0x91, 0xC9, 0xBF, 0x8A, 0x53, 0x12, 0x80, 0x01, 0x80, 0xDA, 0xAE, 0x09, 0x43, 0x11, 0x80,
+    0x11, 0x88, 0x9A, 0xEF, 0x98, 0x31, 0x22, 0x00, 0x88, 0x01, 0xA8, 0xF9, 0x9D, 0x19, 0x32, 0x12,
+    0x08, 0x00, 0x12, 0x80, 0xDA, 0xCF, 0x09, 0x41, 0x13, 0x81, 0x88, 0x18, 0x91, 0xC8, 0xE9, 0x9E	}
+	},
+  {-18055, 75, 0, {
+    0x08, 0x41, 0x22, 0x80, 0x98, 0x00, 0x32, 0x9A, 0xDA, 0xEC, 0x8B, 0x10, 0x34, 0x22, 0x00, 0x99,
+    0x29, 0x02, 0xA1, 0xB8, 0xF8, 0xBF, 0x08, 0x32, 0x54, 0x11, 0x08, 0x99, 0xA0, 0x31, 0xA2, 0x90,
+    0xDB, 0xE1, 0x9E, 0x08, 0x31, 0x50, 0x11, 0x81, 0xA8, 0x99, 0x98, 0x20, 0x22, 0xD9, 0xAA, 0x9A,
+    0xFB, 0x9F, 0x18, 0x02, 0x13, 0x53, 0x00, 0x89, 0xAA, 0x88, 0x99, 0x9C, 0x38, 0x33, 0x81, 0x88	}
+	},
+  {-216, 49, 0, {
+    0x08, 0xD9, 0xC0, 0xFF, 0x88, 0x21, 0x12, 0x11, 0x31, 0x03, 0xD8, 0xA1, 0x8C, 0x09, 0x3D, 0x88,
+    0x1A, 0x10, 0x96, 0x84, 0x8A, 0xF8, 0x98, 0x98, 0x2A, 0x19, 0x08, 0xB2, 0x40, 0xFA, 0x0A, 0x34,
+    0x69, 0x21, 0x10, 0x92, 0x84, 0x25, 0x88, 0x09, 0x1A, 0x1A, 0xA9, 0x88, 0x49, 0x99, 0x9A, 0x33,
+    0x54, 0xBC, 0xC0, 0xC8, 0x1C, 0xA9, 0xF1, 0x9F, 0x19, 0x12, 0x12, 0x50, 0x03, 0x80, 0xA8, 0x9A	}
+	},
+  {1820, 55, 0, {
+    0x8B, 0x90, 0xA0, 0x71, 0x31, 0xEA, 0xB0, 0x8A, 0xEB, 0xAF, 0x08, 0x32, 0x50, 0x04, 0x92, 0xA8,
+    0x88, 0x89, 0x18, 0x42, 0x93, 0x0D, 0x8B, 0xFB, 0x9F, 0x28, 0x21, 0x24, 0x01, 0x98, 0x09, 0x89,
+    0x48, 0x31, 0x9A, 0xBA, 0xFF, 0x8B, 0x10, 0x34, 0x04, 0x81, 0x89, 0x09, 0x39, 0x82, 0xC1, 0xF8,
+    0x9F, 0x19, 0x40, 0x22, 0x91, 0x90, 0x88, 0x11, 0x92, 0xA8, 0xFF, 0x8A, 0x28, 0x34, 0x01, 0x88	}
+	},
+  {5290, 68, 0, {
+    0x89, 0x30, 0x10, 0x9B, 0xFF, 0x9A, 0x32, 0x14, 0x00, 0x88, 0x29, 0x82, 0xA8, 0xEF, 0x99, 0x31,
+    0x23, 0x10, 0x89, 0x30, 0x00, 0xFA, 0xAF, 0x08, 0x23, 0x03, 0x81, 0x19, 0x12, 0xB9, 0xFF, 0x0A,
+    0x31, 0x12, 0x00, 0x18, 0x01, 0xD0, 0xBF, 0x19, 0x33, 0x21, 0x08, 0x48, 0x80, 0xFB, 0x8E, 0x20,
+    0x12, 0x00, 0x18, 0x82, 0xF8, 0xAC, 0x30, 0x21, 0x11, 0x18, 0x83, 0xF9, 0x9F, 0x20, 0x11, 0x81	}
+	},
+  {3799, 76, 0, {
+    0x20, 0x00, 0xFB, 0x9B, 0x32, 0x12, 0x81, 0x13, 0xC0, 0xCF, 0x29, 0x12, 0x11, 0x20, 0x01, 0xEE,
+    0x0A, 0x12, 0x02, 0x20, 0x11, 0xFB, 0x8C, 0x21, 0x11, 0x10, 0x12, 0xFB, 0x8D, 0x12, 0x01, 0x20,
+    0x11, 0xDD, 0x0A, 0x22, 0x01, 0x11, 0x92, 0xDF, 0x18, 0x02, 0x01, 0x12, 0xF8, 0x8B, 0x21, 0x01,
+    0x21, 0x92, 0xCF, 0x18, 0x21, 0x00, 0x22, 0xFA, 0x0B, 0x21, 0x01, 0x32, 0xF0, 0x9C, 0x21, 0x01	}
+	},
+  {2767, 78, 0, {
+    0x21, 0xB1, 0xAF, 0x10, 0x02, 0x31, 0xB2, 0xCF, 0x10, 0x02, 0x21, 0xA1, 0xAF, 0x10, 0x02, 0x21,
+    0xC2, 0x8F, 0x10, 0x10, 0x21, 0xF0, 0x8A, 0x21, 0x10, 0x21, 0xFB, 0x09, 0x11, 0x21, 0x01, 0xAF,
+    0x18, 0x02, 0x31, 0xF0, 0x8A, 0x11, 0x11, 0x03, 0xCE, 0x00, 0x02, 0x31, 0xD8, 0x0C, 0x11, 0x20,
+    0x02, 0xAF, 0x28, 0x01, 0x22, 0xFA, 0x09, 0x11, 0x31, 0xE0, 0x0B, 0x11, 0x21, 0xA3, 0xAF, 0x20	}
+	},
+  {-4781, 80, 0, {
+    0x11, 0x03, 0xAF, 0x18, 0x11, 0x23, 0xCD, 0x18, 0x01, 0x32, 0xFB, 0x08, 0x01, 0x32, 0xFA, 0x19,
+    0x10, 0x31, 0xEA, 0x19, 0x11, 0x31, 0xFB, 0x08, 0x11, 0x12, 0xEB, 0x18, 0x11, 0x22, 0xAF, 0x10,
+    0x01, 0x83, 0x8F, 0x00, 0x11, 0xB2, 0x8C, 0x11, 0x41, 0xF0, 0x88, 0x01, 0x22, 0xBC, 0x00, 0x12,
+    0x94, 0x8E, 0x10, 0x20, 0xE2, 0x09, 0x10, 0x31, 0xCC, 0x00, 0x21, 0xB3, 0x8E, 0x20, 0x31, 0xF9	}
+	},
+  {-9422, 85, 0, {
+    0x08, 0x11, 0x82, 0x8E, 0x10, 0x40, 0xC9, 0x08, 0x11, 0x93, 0x8F, 0x10, 0x21, 0xD9, 0x08, 0x21,
+    0xA3, 0x0F, 0x00, 0x31, 0xE9, 0x08, 0x11, 0x82, 0x9D, 0x01, 0x31, 0xF1, 0x09, 0x10, 0x12, 0xAC,
+    0x18, 0x12, 0xB5, 0x8C, 0x11, 0x31, 0xF0, 0x09, 0x10, 0x32, 0xAE, 0x00, 0x11, 0x83, 0x8F, 0x18,
+    0x11, 0xC3, 0x0C, 0x10, 0x30, 0xE1, 0x0A, 0x11, 0x31, 0xF8, 0x09, 0x11, 0x40, 0xDA, 0x08, 0x11	}
+	},
+  {1004, 80, 0, {
+    0x31, 0xFA, 0x08, 0x01, 0x22, 0xDB, 0x29, 0x10, 0x51, 0xDA, 0x08, 0x01, 0x31, 0xF8, 0x09, 0x11,
+    0x20, 0xE1, 0x0A, 0x11, 0x20, 0xB2, 0x8F, 0x01, 0x01, 0x03, 0x9F, 0x00, 0x01, 0x22, 0xEB, 0x08,
+    0x01, 0x21, 0xE2, 0x0B, 0x11, 0x20, 0x03, 0xBF, 0x10, 0x01, 0x32, 0xF8, 0x0A, 0x01, 0x11, 0x03,
+    0xAF, 0x28, 0x10, 0x40, 0xD0, 0x8B, 0x12, 0x01, 0x23, 0xFC, 0x19, 0x11, 0x10, 0x82, 0xAF, 0x10	}
+	},
+  {-8464, 80, 0, {
+    0x11, 0x20, 0xB2, 0x9F, 0x10, 0x01, 0x21, 0xF2, 0x8B, 0x11, 0x01, 0x31, 0xF1, 0x8B, 0x21, 0x10,
+    0x30, 0xE2, 0x0E, 0x10, 0x00, 0x11, 0xB2, 0x9F, 0x01, 0x01, 0x01, 0x83, 0xAF, 0x18, 0x11, 0x00,
+    0x32, 0xFB, 0x1B, 0x11, 0x01, 0x30, 0xC3, 0xAF, 0x20, 0x01, 0x81, 0x23, 0xFA, 0x0C, 0x21, 0x00,
+    0x10, 0x02, 0xBF, 0x29, 0x21, 0x10, 0x28, 0xA3, 0xEF, 0x10, 0x01, 0x00, 0x10, 0xA2, 0xAF, 0x10	}
+	},
+  {-9350, 78, 0, {
+    0x02, 0x00, 0x20, 0x82, 0xDF, 0x00, 0x02, 0x00, 0x00, 0x12, 0xFB, 0x0B, 0x22, 0x01, 0x80, 0x31,
+    0xB1, 0xEF, 0x28, 0x11, 0x00, 0x08, 0x02, 0xF0, 0x8C, 0x11, 0x11, 0x00, 0x08, 0x13, 0xFA, 0x8D,
+    0x21, 0x01, 0x00, 0x08, 0x12, 0xF8, 0x8D, 0x20, 0x11, 0x00, 0x88, 0x30, 0x00, 0xEF, 0x08, 0x12,
+    0x00, 0x80, 0x80, 0x12, 0xC1, 0xBF, 0x20, 0x12, 0x01, 0x90, 0x08, 0x22, 0xA1, 0xFF, 0x19, 0x21	}
+	},
+  {-466, 75, 0, {
+    0x01, 0x88, 0x80, 0x18, 0x03, 0xF8, 0x9F, 0x11, 0x02, 0x01, 0x09, 0x88, 0x18, 0x03, 0xF9, 0x9E,
+    0x20, 0x22, 0x00, 0x88, 0x88, 0x88, 0x23, 0x91, 0xFF, 0x8A, 0x23, 0x12, 0x80, 0x19, 0x99, 0x88,
+    0x33, 0x11, 0xFA, 0xBF, 0x28, 0x14, 0x01, 0x80, 0x89, 0x88, 0xA0, 0x42, 0x11, 0xD9, 0xBF, 0x0A,
+    0x34, 0x03, 0x80, 0xA8, 0xA1, 0x90, 0x28, 0x7A, 0x11, 0x09, 0xCF, 0x9A, 0x20, 0x25, 0x01, 0x90	}
+	},
+  {3092, 66, 0, {
+    0x88, 0x89, 0x08, 0x09, 0x09, 0x41, 0x05, 0xB0, 0xFA, 0xAE, 0x18, 0x42, 0x12, 0x81, 0x98, 0x98,
+    0x80, 0x0A, 0x19, 0x80, 0x38, 0xAB, 0x57, 0x80, 0xA9, 0xD9, 0xBE, 0x89, 0x42, 0x53, 0x11, 0x88,
+    0xA8, 0x88, 0x09, 0xB0, 0x02, 0xA8, 0x92, 0x89, 0x6D, 0x19, 0x08, 0x08, 0x15, 0xA8, 0xF2, 0x89,
+    0x98, 0xFA, 0x9A, 0x22, 0x60, 0x10, 0x52, 0x08, 0x99, 0xA1, 0x99, 0xB3, 0x28, 0x0A, 0xD3, 0x3A	}
+	},
+  {103, 51, 0, {
+    0xB1, 0x19, 0xB0, 0x19, 0x87, 0x90, 0xF1, 0x20, 0x3A, 0x70, 0x00, 0x9C, 0x89, 0xF9, 0x8E, 0x10,
+    0x31, 0x24, 0x00, 0x88, 0xA9, 0x08, 0x09, 0x09, 0x89, 0xC5, 0x82, 0x29, 0x1B, 0x44, 0x12, 0xD8,
+    0xFB, 0xAF, 0x18, 0x43, 0x21, 0x08, 0x09, 0xA8, 0x88, 0xA8, 0x01, 0x28, 0x2B, 0x46, 0x94, 0xC9,
+    0xCF, 0x89, 0x32, 0x14, 0x81, 0x88, 0x1A, 0x8A, 0xA1, 0x00, 0x30, 0x46, 0x88, 0xEF, 0x9A, 0x32	}
+	},
+  {-4891, 69, 0, {
+    0x22, 0x01, 0xA8, 0xA1, 0x08, 0x8A, 0x11, 0x47, 0x89, 0xCF, 0x1A, 0x22, 0x12, 0x81, 0x89, 0x98,
+    0x90, 0x11, 0x26, 0xF0, 0xAE, 0x20, 0x12, 0x11, 0x09, 0x19, 0x8A, 0x29, 0x07, 0xD0, 0xAD, 0x30,
+    0x12, 0x01, 0x88, 0xA0, 0x08, 0x61, 0x01, 0xEF, 0x18, 0x11, 0x01, 0x88, 0x90, 0x90, 0x23, 0xF3,
+    0x9E, 0x10, 0x12, 0x00, 0x08, 0x89, 0x30, 0x84, 0xDF, 0x18, 0x11, 0x01, 0x08, 0x98, 0x21, 0x94	}
+	},
+  {6584, 66, 0, {
+    0xCF, 0x29, 0x12, 0x00, 0x80, 0x88, 0x52, 0xF0, 0x9B, 0x22, 0x11, 0x08, 0x90, 0x30, 0xA5, 0xCF,
+    0x20, 0x01, 0x81, 0x90, 0x11, 0xA4, 0xBF, 0x11, 0x11, 0x00, 0x90, 0x32, 0xF4, 0x8D, 0x11, 0x10,
+    0x18, 0x09, 0x42, 0xEC, 0x08, 0x11, 0x00, 0x80, 0x30, 0xF1, 0x0C, 0x01, 0x01, 0x80, 0x10, 0xA5,
+    0x8F, 0x00, 0x01, 0x00, 0x18, 0x94, 0x9F, 0x10, 0x81, 0x00, 0x10, 0xC4, 0x0D, 0x10, 0x00, 0x00	}
+	},
+  {2091, 72, 0, {
+    0x30, 0xF1, 0x1C, 0x10, 0x00, 0x80, 0x32, 0xBF, 0x00, 0x02, 0x00, 0x20, 0xE4, 0x8B, 0x21, 0x00,
+    0x00, 0x33, 0xDF, 0x00, 0x01, 0x00, 0x40, 0xF9, 0x08, 0x01, 0x00, 0x38, 0xF2, 0x0A, 0x01, 0x10,
+    0x28, 0xF2, 0x0A, 0x20, 0x18, 0x28, 0xF3, 0x0A, 0x10, 0x00, 0x30, 0xF2, 0x1B, 0x10, 0x00, 0x60,
+    0xD9, 0x08, 0x01, 0x00, 0x31, 0x9F, 0x18, 0x00, 0x01, 0xA4, 0x8E, 0x11, 0x18, 0x48, 0xF8, 0x80	}
+	},
+  {-7112, 80, 0, {
+    0x01, 0x08, 0x02, 0x8E, 0x00, 0x01, 0x48, 0xE8, 0x80, 0x81, 0x81, 0x94, 0x8C, 0x10, 0x00, 0x50,
+    0x9C, 0x18, 0x00, 0x30, 0xF2, 0x89, 0x01, 0x00, 0xA5, 0x0C, 0x00, 0x00, 0x04, 0x8E, 0x00, 0x00,
+    0x41, 0x9D, 0x00, 0x81, 0x41, 0xAC, 0x00, 0x01, 0x41, 0xEA, 0x80, 0x82, 0x41, 0xCB, 0x00, 0x01,
+    0x60, 0xBA, 0x80, 0x82, 0x51, 0xCB, 0x01, 0x00, 0x33, 0xAF, 0x81, 0x82, 0x84, 0x0E, 0x18, 0x00	}
+	},
+  {1121, 74, 0, {
+    0xB4, 0x0B, 0x20, 0x48, 0xF1, 0x08, 0x00, 0x40, 0xAB, 0x00, 0x81, 0x85, 0x0D, 0x18, 0x10, 0xE4,
+    0x08, 0x00, 0x40, 0xBB, 0x81, 0x82, 0x95, 0x0C, 0x28, 0x48, 0xD8, 0x80, 0x01, 0x12, 0x0F, 0x18,
+    0x28, 0xE1, 0x80, 0x81, 0x12, 0x0E, 0x18, 0x20, 0xE0, 0x80, 0x01, 0x02, 0x0E, 0x18, 0x28, 0xF2,
+    0x80, 0x81, 0x21, 0x8D, 0x00, 0x10, 0xD3, 0x09, 0x10, 0x58, 0xBA, 0x81, 0x81, 0x85, 0x0D, 0x18	}
+	},
+  {-1859, 74, 0, {
+    0x10, 0xE3, 0x88, 0x10, 0x58, 0xAA, 0x80, 0x92, 0x43, 0x8F, 0x80, 0x01, 0x93, 0x0E, 0x10, 0x08,
+    0xC4, 0x19, 0x18, 0x28, 0xF2, 0x08, 0x10, 0x49, 0xD8, 0x00, 0x00, 0x48, 0xC9, 0x00, 0x01, 0x48,
+    0xCA, 0x10, 0x00, 0x68, 0xC9, 0x00, 0x10, 0x49, 0xE0, 0x80, 0x01, 0x28, 0xF2, 0x08, 0x00, 0x00,
+    0xC3, 0x0A, 0x10, 0x80, 0x05, 0x0F, 0x18, 0x18, 0x48, 0xBB, 0x81, 0x02, 0x28, 0xE6, 0x88, 0x01	}
+	},
+  {-907, 75, 0, {
+    0x80, 0x03, 0x0F, 0x18, 0x18, 0x38, 0xD9, 0x80, 0x81, 0x92, 0x85, 0x0E, 0x18, 0x18, 0x28, 0xF1,
+    0x80, 0x00, 0x81, 0x31, 0x8F, 0x08, 0x01, 0x08, 0xA4, 0x0C, 0x28, 0x18, 0x28, 0xF4, 0x09, 0x10,
+    0x18, 0x38, 0xF0, 0x88, 0x01, 0x00, 0x58, 0xD9, 0x00, 0x18, 0x28, 0x59, 0xE8, 0x80, 0x01, 0x18,
+    0x29, 0xF2, 0x08, 0x18, 0x00, 0x80, 0xA5, 0x0C, 0x28, 0x08, 0x81, 0x42, 0x9F, 0x00, 0x81, 0x00	}
+	},
+  {964, 69, 0, {
+    0x38, 0xF2, 0x89, 0x01, 0x00, 0x90, 0x53, 0x9F, 0x10, 0x80, 0x81, 0x80, 0xA6, 0x0C, 0x10, 0x18,
+    0x19, 0x38, 0xF3, 0x8A, 0x11, 0x18, 0x08, 0x58, 0xF1, 0x09, 0x10, 0x18, 0x08, 0x39, 0xE5, 0x09,
+    0x18, 0x00, 0x00, 0x09, 0x86, 0x0E, 0x18, 0x18, 0x80, 0x80, 0x68, 0xE9, 0x00, 0x81, 0x00, 0x80,
+    0x08, 0x13, 0xAF, 0x10, 0x00, 0x10, 0x98, 0x92, 0x97, 0x0E, 0x18, 0x00, 0x00, 0x88, 0x81, 0x95	}
+	},
+  {3170, 67, 0, {
+    0x8E, 0x00, 0x11, 0x19, 0x88, 0x00, 0x78, 0xF9, 0x00, 0x00, 0x81, 0x80, 0x08, 0x80, 0x33, 0xCF,
+    0x00, 0x01, 0x81, 0x00, 0x89, 0x81, 0x73, 0xAE, 0x10, 0x10, 0x80, 0x81, 0x09, 0x80, 0x68, 0xF2,
+    0x0A, 0x20, 0x18, 0x80, 0x19, 0x19, 0x88, 0x70, 0xF1, 0x0A, 0x01, 0x01, 0x81, 0x89, 0x91, 0x10,
+    0x5B, 0x13, 0xDF, 0x10, 0x81, 0x81, 0x80, 0x08, 0x90, 0x80, 0xA1, 0x37, 0xCE, 0x18, 0x11, 0x00	}
+	},
+  {278, 64, 0, {
+    0x08, 0x88, 0x00, 0x0A, 0xB3, 0x81, 0x77, 0xCC, 0x00, 0x01, 0x01, 0x00, 0x0A, 0x19, 0x19, 0x09,
+    0x91, 0xC1, 0x37, 0xF8, 0x1C, 0x10, 0x81, 0x81, 0x80, 0x88, 0x80, 0x4A, 0x1B, 0x08, 0x00, 0x00,
+    0x37, 0xFA, 0x8C, 0x12, 0x20, 0x29, 0x89, 0x19, 0x98, 0x80, 0x88, 0x00, 0x81, 0x91, 0x01, 0xA2,
+    0x75, 0xD6, 0x8E, 0x28, 0x11, 0x00, 0x08, 0x09, 0x08, 0xA0, 0x90, 0xB4, 0x21, 0x1E, 0x28, 0x08	}
+	},
+  {-110, 51, 0, {
+    0x18, 0x98, 0xA0, 0xA0, 0xA2, 0x77, 0x00, 0xCF, 0x88, 0x03, 0x22, 0x18, 0x99, 0x09, 0xA1, 0x91,
+    0xB1, 0x84, 0x89, 0x59, 0x09, 0x0D, 0x02, 0x91, 0xA2, 0xA2, 0xA8, 0xB0, 0x43, 0x3B, 0x3C, 0x30,
+    0x4C, 0x3B, 0x6F, 0x15, 0xCF, 0x09, 0x02, 0x84, 0x08, 0x80, 0x98, 0x91, 0x11, 0x9B, 0xA4, 0x38,
+    0x1A, 0x1D, 0x20, 0x18, 0x29, 0x2A, 0xAA, 0x78, 0xB7, 0xAF, 0x20, 0x03, 0x90, 0x84, 0x8A, 0x80	}
+	},
+  {-414, 52, 0, {
+    0x28, 0x3F, 0x99, 0x81, 0x81, 0x80, 0x92, 0x13, 0x87, 0xEF, 0x11, 0x00, 0x10, 0x09, 0x08, 0x98,
+    0x88, 0x80, 0x01, 0x91, 0x91, 0x73, 0xF6, 0x8A, 0x21, 0x91, 0x82, 0x1A, 0x08, 0x0A, 0x19, 0x28,
+    0x29, 0x7C, 0xF7, 0x08, 0x10, 0x08, 0x91, 0x08, 0x08, 0x09, 0x29, 0x90, 0x79, 0xF2, 0x88, 0x11,
+    0x88, 0x81, 0x08, 0x08, 0x09, 0x2A, 0x7A, 0xF6, 0x18, 0x18, 0x88, 0x81, 0x08, 0x08, 0x88, 0x88	}
+	},
+  {-1059, 56, 0, {
+    0x06, 0x8E, 0x00, 0x01, 0x08, 0x08, 0x80, 0x90, 0xB0, 0x07, 0x0E, 0x18, 0x10, 0x08, 0x08, 0x08,
+    0x18, 0x7C, 0xD9, 0x81, 0x01, 0x91, 0x81, 0x80, 0x88, 0x79, 0xBA, 0x10, 0x38, 0xA0, 0xB3, 0xB4,
+    0xC3, 0x07, 0x0F, 0x00, 0x10, 0x09, 0x08, 0x90, 0x68, 0xBB, 0x00, 0x03, 0x80, 0x80, 0x81, 0x7A,
+    0xDA, 0x91, 0x12, 0x00, 0x08, 0x18, 0x7B, 0x9C, 0x00, 0xB4, 0xA4, 0x91, 0xB2, 0x96, 0x2D, 0x3A	}
+	},
+  {-35, 59, 0, {
+    0x90, 0x91, 0x91, 0x01, 0x8D, 0x90, 0x32, 0x4C, 0x29, 0x5B, 0xE8, 0x80, 0x01, 0x80, 0x92, 0x48,
+    0xF3, 0x09, 0x19, 0x11, 0x2A, 0x7A, 0xAB, 0x92, 0x18, 0x93, 0x80, 0x62, 0x8F, 0x80, 0x10, 0x91,
+    0x90, 0x95, 0x2D, 0x29, 0x08, 0x1A, 0x50, 0xF9, 0x81, 0x10, 0x88, 0x91, 0xB2, 0x2A, 0x28, 0x5A,
+    0x09, 0x38, 0x9F, 0x01, 0x93, 0x00, 0x59, 0x9D, 0x00, 0x81, 0x92, 0x40, 0xCB, 0x38, 0x08, 0xA4	}
+	},
+  {-192, 48, 0, {
+    0xA1, 0xF5, 0x81, 0x80, 0x01, 0x08, 0xF1, 0x49, 0x08, 0x08, 0x28, 0x2F, 0x1A, 0x91, 0xA2, 0x21,
+    0x8E, 0xC2, 0x84, 0x80, 0xD1, 0x92, 0x10, 0x5C, 0x3A, 0xAA, 0x80, 0xB6, 0x82, 0xA0, 0x00, 0x6A,
+    0x19, 0x2A, 0xC9, 0x92, 0x94, 0xA1, 0x01, 0x3E, 0x2A, 0x80, 0x48, 0x0E, 0x18, 0x91, 0xB2, 0xC4,
+    0x10, 0xD1, 0x82, 0xA3, 0x3E, 0x98, 0x20, 0x08, 0x1C, 0x29, 0x00, 0x59, 0x1D, 0x88, 0xA3, 0x01	}
+	},
+  {155, 49, 0, {
+    0xDB, 0x82, 0x93, 0x10, 0xF2, 0x00, 0x81, 0x19, 0x10, 0x19, 0x89, 0x4F, 0x0B, 0x95, 0x90, 0x91,
+    0x91, 0x29, 0x2A, 0x7A, 0x8E, 0x81, 0xB3, 0x03, 0x8D, 0x82, 0x91, 0x93, 0xF3, 0x7B, 0x1A, 0x00,
+    0x9A, 0x41, 0x1B, 0xA2, 0xF0, 0x84, 0x90, 0x91, 0x91, 0x1A, 0x29, 0x81, 0x09, 0x21, 0x2A, 0x3A,
+    0x9F, 0xA1, 0x02, 0xB2, 0xB3, 0x40, 0xC3, 0x03, 0x3C, 0xBF, 0x01, 0x94, 0x01, 0xB2, 0x30, 0x7B	}
+	},
+  {244, 45, 0, {
+    0x8F, 0x00, 0x81, 0x18, 0x01, 0x2A, 0x0A, 0x0B, 0x3C, 0xB3, 0xD7, 0x19, 0x11, 0x29, 0x28, 0x2A,
+    0x3A, 0xBC, 0xC0, 0x33, 0x4B, 0xB8, 0xC4, 0x96, 0x91, 0xA1, 0x3A, 0x3B, 0x3C, 0x3B, 0x4B, 0x3C,
+    0xB3, 0xB4, 0xC3, 0xB3, 0xF4, 0x48, 0x19, 0x19, 0x2A, 0xE0, 0x19, 0x20, 0x8A, 0x23, 0x0B, 0xB4,
+    0xC3, 0x4B, 0xB8, 0xB3, 0xC4, 0xB3, 0x24, 0x4B, 0x3B, 0x4B, 0x3B, 0x3C, 0x4B, 0x08, 0x08, 0x3D	}
+	},
+  {-3, 37, 0, {
+    0x3C, 0xC0, 0xB3, 0xC3, 0xB4, 0x83, 0x00, 0xD8, 0x03, 0x08, 0xD8, 0xB3, 0xC4, 0x03, 0xC8, 0xB3,
+    0xB4, 0x03, 0x3D, 0xB8, 0xB4, 0xC3, 0xB3, 0xB4, 0xC3, 0x03, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80,
+    0x08, 0x80, 0xF8, 0xF3, 0xD3, 0xC3, 0xB4, 0xB3, 0x48, 0x8B, 0xB4, 0x84, 0x4B, 0x3B, 0x3C, 0x4B,
+    0x3B, 0x80, 0x3C, 0x3C, 0x4B, 0xB8, 0x84, 0x4B, 0x3B, 0x3C, 0x4B, 0x3B, 0xD0, 0xB3, 0x03, 0x3D	}
+	},
+  {-12, 38, 0, {
+    0x4B, 0xB8, 0xB3, 0xC4, 0xB3, 0x84, 0xC0, 0xB3, 0x03, 0x3D, 0x3B, 0x4B, 0x3C, 0xC0, 0xB3, 0x03,
+    0x3D, 0x3B, 0x4B, 0x3C, 0xC0, 0xB3, 0xC3, 0x30, 0x3C, 0x00, 0x08, 0xE8, 0xB3, 0x84, 0x3B, 0x4C,
+    0x3B, 0xC0, 0x83, 0xD0, 0xB3, 0xB4, 0xC3, 0xB3, 0x84, 0x80, 0x80, 0x80, 0x80, 0x08, 0x3F, 0x3C,
+    0x3C, 0x4B, 0xB8, 0xB4, 0xC3, 0x03, 0x3C, 0x4B, 0xB8, 0xC3, 0x84, 0x80, 0x0C, 0xC3, 0xB3, 0x84	}
+	},
+  {-30, 37, 0, {
+    0x80, 0x4C, 0x3B, 0x3C, 0xC0, 0xB3, 0x03, 0x08, 0x3D, 0x3C, 0x4B, 0x3B, 0x3C, 0x4B, 0x3B, 0x3C,
+    0x4B, 0xB8, 0x84, 0x80, 0x4C, 0x3B, 0x0C, 0xC3, 0x03, 0x08, 0x08, 0x3E, 0x3B, 0x4C, 0x3B, 0xB8,
+    0x84, 0x4B, 0x3B, 0x3C, 0x4B, 0x3B, 0x3C, 0x4B, 0xB8, 0xB4, 0x03, 0xD8, 0x03, 0x3C, 0x3B, 0xD0,
+    0xB3, 0xB4, 0xC3, 0xB3, 0xB4, 0xC3, 0x03, 0x3C, 0x3B, 0x4C, 0x3B, 0x3C, 0x4B, 0x3B, 0x3C, 0x80	}
+	},
+  {-16, 36, 0, {
+    0x80, 0x3D, 0x4B, 0x3B, 0x3C, 0x4B, 0x3B, 0x3C, 0x4B, 0x3B, 0x80, 0x80, 0x80, 0xF0, 0xC3, 0xB3,
+    0xC4, 0xB3, 0xB3, 0x84, 0x4B, 0xB8, 0xC3, 0xB4, 0x03, 0x3C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00	}
+	}
+};
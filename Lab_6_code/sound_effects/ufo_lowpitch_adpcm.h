@@ -0,0 +1,11 @@
+#ifndef ufo_lowpitch_adpcm_ADPCM_H
+#define ufo_lowpitch_adpcm_ADPCM_H
+
+#include <adpcm.h>
+
+// Generated by adpcm_convert from ufo_lowpitch.raw
+#define NUM_ufo_lowpitch_adpcm_BLOCKS 	168
+#define ufo_lowpitch_adpcm_RATE 	8000
+extern const adpcm_block ufo_lowpitch_adpcm[NUM_ufo_lowpitch_adpcm_BLOCKS];
+
+#endif
@@ -83,6 +83,10 @@ static volatile AXI_timer_device_t timer_device[NUM_AXI_TIMERS/2] = {
 void AXI_timer_handler(volatile AXI_timer_device_t *device)
 {
   int i;
+  // clear the interrupt in the Cortex M3 NVIC. Timer 0 is on hardware
+  // interrupt 0. This is done first, so that an interrupt raised
+  // while a handler runs is taken again when this one returns.
+  NVIC_ClearPendingIRQ(device->NVIC_IRQ_NUM);
   // Examine the device to see which timer is signalling an interrupt.
   // It could be both, so lets do a loop.  We could unroll the loop
   // to get more speed, but the code would probably be longer.  You
@@ -93,19 +97,17 @@ void AXI_timer_handler(volatile AXI_timer_device_t *device)
       // If timer i is signalling an interruptt, 
       if(device->device[i]->TCSR.bits.TINT)
         {
+	  // Clear the interrupt in the timer device before the handler
+	  // runs: a handler that restarts a one-shot with a short count
+	  // would have its new interrupt cleared otherwise.
+          device->device[i]->TCSR.bits.TINT = 1;
           //then call its handler (if it has one)
           if(device->handler[i] != NULL)
             device->handler[i]();
 	  // else
 	  // it should be disabled.  There is a problem.
-
-	  // Clear the interrupt in the timer device.
-          device->device[i]->TCSR.bits.TINT = 1;
         }
     }
-  // clear the interrupt in the Cortex M3 NVIC. Timer 0 is on hardware
-  // interrupt 0
-  NVIC_ClearPendingIRQ(device->NVIC_IRQ_NUM);
 }
 
 
@@ -279,6 +281,20 @@ void AXI_TIMER_set_oneshot(unsigned int timer, int count)
   NVIC_EnableIRQ(timer_device[dev].NVIC_IRQ_NUM);
 }
 
+// The same, for use in the timer's own handler. The owner is not
+// checked, and the NVIC interrupt is already enabled.
+void AXI_TIMER_set_oneshot_from_ISR(unsigned int timer, int count)
+{
+  // Get the device number for the timer.
+  int dev = timer>>1;
+  // Get the channel number for the timer.
+  int channel = timer & 1;
+  ASSERT(timer<NUM_AXI_TIMERS);
+  timer_device[dev].device[channel]->TLR = count;
+  timer_device[dev].device[channel]->TCR = count;
+  timer_device[dev].device[channel]->TCSR.TCSR = 0x1C2;
+}
+
 // The timers also have a PWM mode, which we may want to support
 // someday. These are are a couple of functions that may be useful at
 // that point, but we are not going to implement them now.
@@ -142,6 +142,9 @@ typedef struct{
   SemaphoreHandle_t RX_mutex;     // Recursive mutex for the receiver
   SemaphoreHandle_t TX_mutex;     // Recursive mutex for the transmitter
   UART_tx_state_t tx_state;       // Transmitter state for this UART
+  uint32_t tx_count;              // Characters accepted for transmission
+  UART_16550_rx_callback_t rx_callback; // Called from the ISR on receive
+  void *rx_callback_arg;          // Passed to rx_callback
 }UART_16550_descriptor_t;
 
 // Define an array that holds the private information for each
@@ -267,6 +270,11 @@ static BaseType_t UART_handler(UART_16550_descriptor_t *device)
 						1,
 						&HigherPriorityTaskWoken);
             }
+	  // Let a waiting task know that there is input, so that it
+	  // can block on its own queue instead of polling
+	  if(device->rx_callback != NULL)
+	    device->rx_callback(device->rx_callback_arg,
+				&HigherPriorityTaskWoken);
 	  break;
 
         case 0b001: // Transmitter Holding Register Empty
@@ -497,6 +505,7 @@ BaseType_t UART_16550_put_char(int UART,
   while (!uart[UART].dev->LSR.THRE);
   // Send the character
   uart[UART].dev->THR = c;
+  uart[UART].tx_count++;
 
   // Release the mutex.
 
@@ -610,6 +619,10 @@ BaseType_t UART_16550_put_char(int UART,
       if(still_in_critical_section)
 	vPortExitCritical();
 
+      // Count the character (we still hold the mutex).
+      if(result == pdPASS)
+	my_uart->tx_count++;
+
       // Release the mutex.
       xSemaphoreGiveRecursive(my_uart->TX_mutex);
     }
@@ -730,6 +743,32 @@ int UART_16550_chars_available(int UART_number)
   return xStreamBufferBytesAvailable(uart[UART_number].RX_buffer);
 }
 
+/*****************************************************************************/
+// Set the function that the ISR calls after characters are received
+void UART_16550_set_rx_callback(int UART_number,
+				UART_16550_rx_callback_t callback,
+				void *arg)
+{
+  vPortEnterCritical();
+  uart[UART_number].rx_callback = callback;
+  uart[UART_number].rx_callback_arg = arg;
+  vPortExitCritical();
+}
+
+/*****************************************************************************/
+// Return the number of characters written to the transmitter so far
+uint32_t UART_16550_tx_count(int UART_number)
+{
+  return uart[UART_number].tx_count;
+}
+
+/*****************************************************************************/
+// Return the number of characters waiting in the transmit stream buffer
+int UART_16550_tx_pending(int UART_number)
+{
+  return xStreamBufferBytesAvailable(uart[UART_number].TX_buffer);
+}
+
 /*****************************************************************************/
 // Flush the UART receiver
 void UART_16550_flush_rx(int UART_number)
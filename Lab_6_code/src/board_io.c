@@ -0,0 +1,134 @@
+// This file implements the API for the LED and slide switch driver.
+
+#include <board_io.h>
+#include <device_addrs.h>
+#include <timers.h>
+#include <pmod_gpio.h>
+
+#define LEDS_MASK      0xFFFF
+#define RGB_LED_BITS   3
+
+// Shadow registers, and the values last written to the hardware
+static volatile uint32_t leds_shadow;
+static volatile uint32_t rgb_shadow;
+static uint32_t leds_written;
+static uint32_t rgb_written;
+
+static StaticTimer_t flush_timer_struct;
+static TimerHandle_t flush_timer;
+
+static volatile uint32_t switches;
+static volatile TaskHandle_t switches_task;
+
+/*****************************************************************************/
+// This is the ISR for GPIO 1. Put this function in the interrupt
+// vector table.
+void GPIO1_handler()
+{
+  BaseType_t hptw = pdFALSE;
+  uint32_t now;
+  (void)DEVICE_REG(SWITCHES_isr);  // clear the interrupt in the GPIO device
+  now = DEVICE_REG(SWITCHES) & 0xFFFF;
+  if(now != switches)
+    {
+      switches = now;
+      if(switches_task != NULL)
+        xTaskNotifyFromISR(switches_task, now, eSetValueWithOverwrite, &hptw);
+    }
+  // The PMOD GPIO shares this interrupt.
+  PMOD_GPIO_handler(&hptw);
+  NVIC_ClearPendingIRQ(GPIO1_IRQ);
+  portYIELD_FROM_ISR(hptw);
+}
+
+/*****************************************************************************/
+// Runs in the timer task. Only registers that changed are written.
+static void flush_callback(TimerHandle_t timer)
+{
+  LEDS_flush();
+}
+
+/*****************************************************************************/
+// Initialize the driver, start the flush timer and enable the switch
+// interrupt.
+void BOARD_IO_init()
+{
+  leds_shadow = leds_written = 0;
+  rgb_shadow = rgb_written = 0;
+  DEVICE_REG(LEDS) = 0;
+  DEVICE_REG(RGB_LEDS) = 0;
+  flush_timer = xTimerCreateStatic("board_io",
+                                   pdMS_TO_TICKS(BOARD_IO_FLUSH_MS),
+                                   pdTRUE, NULL, flush_callback,
+                                   &flush_timer_struct);
+  xTimerStart(flush_timer, 0);
+
+  switches = DEVICE_REG(SWITCHES) & 0xFFFF;
+  (void)DEVICE_REG(SWITCHES_isr);
+  DEVICE_REG(SWITCHES_ier) = 0x02;
+  DEVICE_REG(SWITCHES_gier) = 0x80000000;
+  NVIC_EnableIRQ(GPIO1_IRQ);
+}
+
+/*****************************************************************************/
+// Set the LEDs selected by mask to the matching bits of value.
+void LEDS_set(uint32_t mask, uint32_t value)
+{
+  vPortEnterCritical();
+  leds_shadow = (leds_shadow & ~mask) | (value & mask & LEDS_MASK);
+  vPortExitCritical();
+}
+
+/*****************************************************************************/
+// Return the state that the LEDs will have after the next flush
+uint32_t LEDS_get()
+{
+  return leds_shadow;
+}
+
+/*****************************************************************************/
+// Set RGB LED 0 or 1 to one of the RGB_ colours.
+void RGB_LEDS_set(int led, uint32_t colour)
+{
+  int shift = led * RGB_LED_BITS;
+  ASSERT(led == 0 || led == 1);
+  vPortEnterCritical();
+  rgb_shadow = (rgb_shadow & ~(RGB_WHITE << shift)) |
+    ((colour & RGB_WHITE) << shift);
+  vPortExitCritical();
+}
+
+/*****************************************************************************/
+// Write any changed shadow registers to the GPIO now.
+void LEDS_flush()
+{
+  uint32_t leds, rgb;
+  vPortEnterCritical();
+  leds = leds_shadow;
+  rgb = rgb_shadow;
+  if(leds != leds_written)
+    {
+      DEVICE_REG(LEDS) = leds;
+      leds_written = leds;
+    }
+  if(rgb != rgb_written)
+    {
+      DEVICE_REG(RGB_LEDS) = rgb;
+      rgb_written = rgb;
+    }
+  vPortExitCritical();
+}
+
+/*****************************************************************************/
+// Return the state of the slide switches.
+uint32_t SWITCHES_state()
+{
+  return switches;
+}
+
+/*****************************************************************************/
+// Notify task (or nobody, with NULL) when the switches change.
+void SWITCHES_notify(TaskHandle_t task)
+{
+  switches_task = task;
+}
@@ -0,0 +1,115 @@
+// This file implements the API for the push button driver.
+
+#include <buttons.h>
+#include <device_addrs.h>
+#include <queue.h>
+#include <timers.h>
+
+// The driver only needs one queue and one timer, so they are
+// allocated statically.
+static StaticQueue_t event_queue_struct;
+static uint8_t event_queue_storage[BUTTONS_QUEUE_LENGTH * sizeof(BUTTONS_event_t)];
+static QueueHandle_t event_queue;
+
+static StaticTimer_t debounce_timer_struct;
+static TimerHandle_t debounce_timer;
+
+static volatile uint32_t state;  // last state that was reported
+static BUTTONS_callback_t callback;
+static void *callback_arg;
+
+/*****************************************************************************/
+// Read the buttons, and queue an event if they differ from the last
+// state that was reported.
+static void buttons_sample(BaseType_t *HigherPriorityTaskWoken)
+{
+  uint32_t now = DEVICE_REG(BUTTONS) & BUTTON_ALL;
+  uint32_t changed = now ^ state;
+  BUTTONS_event_t event;
+
+  if(changed == 0)
+    return;
+  event.pressed = changed & now;
+  event.released = changed & state;
+  event.state = now;
+  state = now;
+  // If the queue is full, the reader is not keeping up, and the
+  // oldest presses matter more than the newest.
+  if(xQueueSendFromISR(event_queue, &event, HigherPriorityTaskWoken) == pdPASS &&
+     callback != NULL)
+    callback(callback_arg, HigherPriorityTaskWoken);
+}
+
+/*****************************************************************************/
+// This is the ISR for GPIO 0. Put this function in the interrupt
+// vector table.
+void GPIO0_handler()
+{
+  BaseType_t hptw = pdFALSE;
+  (void)DEVICE_REG(BUTTON_isr);     // clear the interrupt in the GPIO device
+  buttons_sample(&hptw); // the first edge is the press (or release)
+  // Ignore the bounces until the debounce timer expires.
+  DEVICE_REG(BUTTON_ier) = 0;
+  xTimerResetFromISR(debounce_timer, &hptw);
+  NVIC_ClearPendingIRQ(GPIO0_IRQ);
+  portYIELD_FROM_ISR(hptw);
+}
+
+/*****************************************************************************/
+// Runs in the timer task when the contacts have settled. A button that
+// was released (or pressed) while interrupts were ignored is reported
+// now.
+static void buttons_debounce(TimerHandle_t timer)
+{
+  BaseType_t hptw = pdFALSE;
+  vPortEnterCritical();
+  buttons_sample(&hptw);
+  (void)DEVICE_REG(BUTTON_isr);     // drop the bounces
+  DEVICE_REG(BUTTON_ier) = 0x02;
+  vPortExitCritical();
+  // The timer task has the highest priority, so hptw can be ignored.
+}
+
+/*****************************************************************************/
+// Initialize the push button driver and enable its interrupt.
+void BUTTONS_init()
+{
+  event_queue = xQueueCreateStatic(BUTTONS_QUEUE_LENGTH,
+				   sizeof(BUTTONS_event_t),
+				   event_queue_storage,
+				   &event_queue_struct);
+  debounce_timer = xTimerCreateStatic("buttons",
+				      pdMS_TO_TICKS(BUTTONS_DEBOUNCE_MS),
+				      pdFALSE, NULL, buttons_debounce,
+				      &debounce_timer_struct);
+  state = DEVICE_REG(BUTTONS) & BUTTON_ALL;
+  (void)DEVICE_REG(BUTTON_isr);
+  DEVICE_REG(BUTTON_ier) = 0x02;
+  DEVICE_REG(BUTTON_gier) = 0x80000000;
+  NVIC_EnableIRQ(GPIO0_IRQ);
+}
+
+/*****************************************************************************/
+// Set (or clear, with NULL) the event callback
+void BUTTONS_set_callback(BUTTONS_callback_t cb, void *arg)
+{
+  vPortEnterCritical();
+  callback = cb;
+  callback_arg = arg;
+  vPortExitCritical();
+}
+
+/*****************************************************************************/
+// Get the next button event.
+BaseType_t BUTTONS_get_event(BUTTONS_event_t *event,
+			     TickType_t xTicksToWait)
+{
+  return xQueueReceive(event_queue, event, xTicksToWait);
+}
+
+/*****************************************************************************/
+// Return the debounced state of the buttons
+uint32_t BUTTONS_state()
+{
+  return state;
+}
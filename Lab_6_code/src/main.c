@@ -7,9 +7,14 @@
 #include <stats_task.h>
 // #include <firework_task.h>
 #include <device_addrs.h>
+#include <buttons.h>
+#include <board_io.h>
+#include <pmod_gpio.h>
 // #include <ninvaders.h>
 #include <nInvaders.h>
 #include <sound_effects.h>
+// #include <mixer_bench_task.h>
+// #include <sprite_test_task.h>
 
 // "screen /dev/ttyUSB1 9600"
 
@@ -18,6 +23,7 @@ int main( void )
 {
   TaskHandle_t hello_handle = NULL;
   TaskHandle_t stats_handle = NULL;
+  TaskHandle_t load_handle = NULL;
   TaskHandle_t firework_handle = NULL;
   TaskHandle_t nInvaders_handle = NULL;
   TaskHandle_t PM_test_handle = NULL;
@@ -25,6 +31,8 @@ int main( void )
 
   NVIC_SetPriority(UART0_IRQ,0x6); // priority for UART
   NVIC_SetPriority(UART1_IRQ,0x6); // priority for UART
+  NVIC_SetPriority(GPIO0_IRQ,0x6); // priority for push buttons
+  NVIC_SetPriority(GPIO1_IRQ,0x6); // priority for slide switches
 
   // Intitialize all UARTS
   UART_16550_init();
@@ -34,19 +42,27 @@ int main( void )
   UART_16550_configure(UART1,57600,UART_PARITY_NONE,8,1);
 
   effect_init();
+  BUTTONS_init();
+  BOARD_IO_init();
+  PMOD_GPIO_init();
 
   /* Create the task without using any dynamic memory allocation. */
   // firework_handle = xTaskCreateStatic(firework_task,"firework",FIREWORK_STACK_SIZE,
 	// 			   NULL,3,firework_stack,&firework_TCB);
   nInvaders_handle = xTaskCreateStatic(ninvaders, "ninvaders", NINVADERS_STACK_SIZE,
-            NULL,3,nInvaders_stack,&nInvaders_TCB);
+            NULL,NINVADERS_PRIORITY,nInvaders_stack,&nInvaders_TCB);
         
   
   // /* Create the task without using any dynamic memory allocation. */
   // hello_handle = xTaskCreateStatic(hello_task,"hello",HELLO_STACK_SIZE,
 	// 			   NULL,3,hello_stack,&hello_TCB);
 			      
+  load_handle = xTaskCreateStatic(load_task,"load",LOAD_STACK_SIZE,
+                                  NULL,LOAD_PRIORITY,load_stack,&load_TCB);
+
   /* Create the task without using any dynamic memory allocation. */
+  // The stats page shares UART1 with the game's mirror: build the game
+  // with NINVADERS_MIRROR set to 0 before creating it.
   // stats_handle = xTaskCreateStatic(stats_task,"stats",STATS_STACK_SIZE,
 	// 			   NULL,2,stats_stack,&stats_TCB);
 
@@ -56,6 +72,15 @@ int main( void )
   // sound_effects_handle = xTaskCreateStatic(effect_mixer_task, "effect_mixer", PM_TEST_STACK_SIZE,
   //          NULL,2,PM_test_stack,&PM_test_TCB);		
 
+  // The mixer bench needs effect_init() above left out.
+  // mixer_bench_handle = xTaskCreateStatic(mixer_bench_task, "mixer_bench", MIXER_BENCH_STACK_SIZE,
+  //          NULL,2,mixer_bench_stack,&mixer_bench_TCB);
+
+  // The sprite test drives the game's view itself: comment out the
+  // ninvaders task above when creating it.
+  // sprite_test_handle = xTaskCreateStatic(sprite_test_task, "sprite_test", SPRITE_TEST_STACK_SIZE,
+  //          NULL,2,sprite_test_stack,&sprite_test_TCB);
+
   /* start the scheduler */
   vTaskStartScheduler();
 
@@ -0,0 +1,179 @@
+#include <mixer_bench_task.h>
+#include <task.h>
+#include <stdio.h>
+#include <UART_16550.h>
+#include <cycle_counter.h>
+#include <sounds.h>
+#include <sound_effects.h>
+#include <adpcm.h>
+#include <resample.h>
+#include <dsp.h>
+
+// Number of times each mix is repeated so that a single interrupt
+// does not skew the average.
+#define BENCH_ITERATIONS 64
+
+// The mixer only reads the first buffer of each effect, so any
+// buffer will do as a representative block of samples.
+static const int8_t *bench_sources[NUM_EFFECTS] = {
+  explosion1[0].data, fastinvader1[0].data, fastinvader2[0].data,
+  fastinvader3[0].data, fastinvader4[0].data, invaderkilled[0].data,
+  shoot[0].data, ufo_highpitch[0].data, ufo_lowpitch[0].data
+};
+
+static uint16_t bench_out[EFFECT_BUFFER_SIZE];
+static int16_t bench_pcm[EFFECT_BUFFER_SIZE];
+static adpcm_block bench_block;
+static effect_buffer bench_decoded;
+
+// Time one DSP kernel over a block of the explosion sample.
+typedef void (*bench_kernel_t)(void *ctx, int32_t *data);
+
+static int32_t bench_mix[EFFECT_BUFFER_SIZE];
+
+static uint32_t bench_dsp(bench_kernel_t kernel, void *ctx)
+{
+  uint32_t start, cycles = 0;
+  for(int i=0; i<BENCH_ITERATIONS; i++){
+    for(int j=0; j<EFFECT_BUFFER_SIZE; j++)
+      bench_mix[j] = explosion1[0].data[j] << 8;
+    start = DWT->CYCCNT;
+    kernel(ctx, bench_mix);
+    cycles += DWT->CYCCNT - start;
+  }
+  return cycles / BENCH_ITERATIONS;
+}
+
+static void bench_biquad(void *ctx, int32_t *data)
+{
+  dsp_biquad_block(ctx, data);
+}
+
+static void bench_fir(void *ctx, int32_t *data)
+{
+  dsp_fir_block(ctx, data);
+}
+
+static void bench_meter(void *ctx, int32_t *data)
+{
+  dsp_meter_block(data, ctx);
+}
+
+// Input for the resampler benchmark: the first block of explosion1
+// over and over, so the input never runs out.
+static const int8_t *bench_fetch(void *ctx)
+{
+  return explosion1[0].data;
+}
+
+void mixer_bench_task(void *pvParameters)
+{
+  static char buffer[80];
+  mixer_stream_t streams[NUM_EFFECTS];
+  uint32_t start, cycles, worst;
+
+  ASSERT(!effect_mixer_running());   // it would share our mixer state
+  cycle_counter_enable();
+
+  for(int i=0; i<NUM_EFFECTS; i++){
+    streams[i].data = bench_sources[i];
+    streams[i].gain = EFFECT_GAIN_UNITY;
+  }
+
+  UART_16550_write_string(UART1, "effects  cycles/block  worst  cycles/sample\r\n", portMAX_DELAY);
+
+  for(int n=1; n<=NUM_EFFECTS; n++){
+    cycles = 0;
+    worst = 0;
+    for(int i=0; i<BENCH_ITERATIONS; i++){
+      start = DWT->CYCCNT;
+      effect_mix_block(bench_out, streams, n);
+      start = DWT->CYCCNT - start;
+      cycles += start;
+      if(start > worst)
+        worst = start;
+    }
+    cycles /= BENCH_ITERATIONS;
+    sprintf(buffer, "%7d  %12lu  %5lu  %13lu\r\n", n, (unsigned long)cycles,
+            (unsigned long)worst, (unsigned long)(cycles / EFFECT_BUFFER_SIZE));
+    UART_16550_write_string(UART1, buffer, portMAX_DELAY);
+  }
+
+  // Compressed effects and the theme are decoded one block per mixer
+  // buffer, so time that as well.
+  adpcm_state state = {0, 0};
+  for(int i=0; i<EFFECT_BUFFER_SIZE; i++)
+    bench_pcm[i] = explosion1[0].data[i] * 256;
+  adpcm_encode_block(&state, bench_pcm, &bench_block);
+
+  cycles = 0;
+  for(int i=0; i<BENCH_ITERATIONS; i++){
+    start = DWT->CYCCNT;
+    adpcm_decode_block(&bench_block, bench_decoded.data);
+    cycles += DWT->CYCCNT - start;
+  }
+  cycles /= BENCH_ITERATIONS;
+  sprintf(buffer, "adpcm decode: %lu cycles/block\r\n", (unsigned long)cycles);
+  UART_16550_write_string(UART1, buffer, portMAX_DELAY);
+
+  // Effects recorded at other rates are resampled by each voice, one
+  // output buffer at a time.
+  static const int bench_rates[] = {11025, 16000, 22050};
+  static resampler_t bench_resampler;
+  for(int r=0; r<sizeof(bench_rates)/sizeof(bench_rates[0]); r++){
+    resampler_init(&bench_resampler, bench_rates[r], MIXER_FREQ, bench_fetch, NULL);
+    cycles = 0;
+    for(int i=0; i<BENCH_ITERATIONS; i++){
+      start = DWT->CYCCNT;
+      resample_block(&bench_resampler, bench_decoded.data);
+      cycles += DWT->CYCCNT - start;
+    }
+    cycles /= BENCH_ITERATIONS;
+    sprintf(buffer, "resample %d Hz: %lu cycles/block\r\n", bench_rates[r], (unsigned long)cycles);
+    UART_16550_write_string(UART1, buffer, portMAX_DELAY);
+  }
+
+  // The DSP stages run once per mixer buffer on the whole mix.
+  static dsp_biquad_t bench_biquad_filter;
+  static dsp_biquad_state_t bench_biquad_state[1];
+  static dsp_fir_t bench_fir_filter;
+  static int32_t bench_fir_history[DSP_FIR_HISTORY(DSP_SMOOTH_TAPS)];
+  static dsp_meter_t bench_meter_result;
+
+  dsp_biquad_init(&bench_biquad_filter, dsp_lowpass, bench_biquad_state, 1);
+  dsp_fir_init(&bench_fir_filter, dsp_smooth, DSP_SMOOTH_TAPS, bench_fir_history);
+  sprintf(buffer, "biquad: %lu cycles/block\r\n",
+          (unsigned long)bench_dsp(bench_biquad, &bench_biquad_filter));
+  UART_16550_write_string(UART1, buffer, portMAX_DELAY);
+  sprintf(buffer, "%d tap FIR: %lu cycles/block\r\n", DSP_SMOOTH_TAPS,
+          (unsigned long)bench_dsp(bench_fir, &bench_fir_filter));
+  UART_16550_write_string(UART1, buffer, portMAX_DELAY);
+  sprintf(buffer, "RMS/peak meter: %lu cycles/block\r\n",
+          (unsigned long)bench_dsp(bench_meter, &bench_meter_result));
+  UART_16550_write_string(UART1, buffer, portMAX_DELAY);
+
+  // and the whole mix of four effects with every stage selected
+  effect_set_dsp(EFFECT_DSP_PREEMPHASIS | EFFECT_DSP_LOWPASS |
+                 EFFECT_DSP_SMOOTH | EFFECT_DSP_METER);
+  cycles = 0;
+  for(int i=0; i<BENCH_ITERATIONS; i++){
+    start = DWT->CYCCNT;
+    effect_mix_block(bench_out, streams, 4);
+    cycles += DWT->CYCCNT - start;
+  }
+  effect_set_dsp(0);
+  sprintf(buffer, "mix 4 effects, all DSP stages: %lu cycles/block\r\n",
+          (unsigned long)(cycles / BENCH_ITERATIONS));
+  UART_16550_write_string(UART1, buffer, portMAX_DELAY);
+
+  while(1)
+    vTaskDelay(portMAX_DELAY);
+}
+
+/* Structure that will hold the TCB of the task being created. */
+StaticTask_t mixer_bench_TCB;
+
+/* Buffer that the task being created will use as its stack. Note this
+is an array of StackType_t variables. The size of StackType_t is
+dependent on the RTOS port. */
+StackType_t mixer_bench_stack[ MIXER_BENCH_STACK_SIZE ];
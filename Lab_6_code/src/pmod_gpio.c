@@ -0,0 +1,198 @@
+// This file implements the API for the PMOD JA GPIO driver and its
+// waveform engine.
+
+#include <pmod_gpio.h>
+#include <device_addrs.h>
+#include <task.h>
+
+static volatile uint32_t outputs_shadow; // levels of the output pins
+static volatile uint32_t inputs;         // last input state seen
+static PMOD_GPIO_callback_t callback;
+
+// The waveform that is playing. Only the timer ISR touches it while
+// it plays.
+static struct{
+  int timer;
+  TaskHandle_t owner;
+  const PMOD_step_t *steps;
+  int count;
+  int next;
+  uint8_t *samples;
+  volatile int playing;
+}wave = {-1};
+
+/*****************************************************************************/
+// Drive the pins in mask to value. Called with interrupts masked.
+static inline void pins_write(uint32_t mask, uint32_t value)
+{
+  outputs_shadow = (outputs_shadow & ~mask) | (value & mask);
+  DEVICE_REG(GPIO_bits) = outputs_shadow;
+}
+
+/*****************************************************************************/
+// Initialize the driver. All pins start as inputs.
+void PMOD_GPIO_init()
+{
+  outputs_shadow = 0;
+  DEVICE_REG(GPIO_bits) = 0;
+  DEVICE_REG(GPIO_tris) = PMOD_PINS;
+  inputs = DEVICE_REG(GPIO_bits) & PMOD_PINS;
+}
+
+/*****************************************************************************/
+// Make the pins in outputs outputs, and all others inputs.
+void PMOD_GPIO_set_outputs(uint32_t outputs)
+{
+  // a 0 in the tri-state register makes the pin an output
+  DEVICE_REG(GPIO_tris) = ~outputs & PMOD_PINS;
+}
+
+/*****************************************************************************/
+// Set the output pins selected by mask to the matching bits of value.
+void PMOD_GPIO_write(uint32_t mask, uint32_t value)
+{
+  vPortEnterCritical();
+  pins_write(mask, value);
+  vPortExitCritical();
+}
+
+/*****************************************************************************/
+// Read all 8 pins.
+uint32_t PMOD_GPIO_read()
+{
+  return DEVICE_REG(GPIO_bits) & PMOD_PINS;
+}
+
+/*****************************************************************************/
+// Set (or clear, with NULL) the input change callback.
+void PMOD_GPIO_set_callback(PMOD_GPIO_callback_t cb)
+{
+  vPortEnterCritical();
+  callback = cb;
+  inputs = DEVICE_REG(GPIO_bits) & PMOD_PINS;
+  (void)DEVICE_REG(GPIO_isr);
+  // The pins are on channel 1 of the GPIO, which is bit 0 of ier.
+  DEVICE_REG(GPIO_ier) = cb != NULL ? 0x01 : 0;
+  DEVICE_REG(GPIO_gier) = cb != NULL ? 0x80000000 : 0;
+  vPortExitCritical();
+}
+
+/*****************************************************************************/
+// Called by the GPIO 1 ISR, which the PMOD GPIO shares.
+void PMOD_GPIO_handler(BaseType_t *HigherPriorityTaskWoken)
+{
+  uint32_t now, changed;
+  if(DEVICE_REG(GPIO_isr) == 0)
+    return;                  // it was the switches
+  now = DEVICE_REG(GPIO_bits) & PMOD_PINS;
+  changed = (now ^ inputs) & DEVICE_REG(GPIO_tris);
+  inputs = now;
+  if(changed != 0 && callback != NULL)
+    callback(changed, HigherPriorityTaskWoken);
+}
+
+/*****************************************************************************/
+// Runs in the timer ISR at the end of each step's delay.
+static void wave_step()
+{
+  const PMOD_step_t *step;
+  BaseType_t hptw = pdFALSE;
+
+  if(wave.next == wave.count)
+    {
+      wave.playing = 0;
+      vTaskNotifyGiveFromISR(wave.owner, &hptw);
+      portYIELD_FROM_ISR(hptw);
+      return;
+    }
+  step = &wave.steps[wave.next++];
+  // Start the next delay first, so the time spent here is part of it
+  // and the steps keep to the timer's rate.
+  AXI_TIMER_set_oneshot_from_ISR(wave.timer, step->delay);
+  pins_write(step->mask, step->value);
+  if(step->sample)
+    *wave.samples++ = DEVICE_REG(GPIO_bits) & PMOD_PINS;
+}
+
+/*****************************************************************************/
+// Allocate an AXI timer for the waveform engine.
+BaseType_t PMOD_wave_init()
+{
+  int irq;
+  wave.timer = AXI_TIMER_allocate();
+  if(wave.timer < 0)
+    return pdFAIL;
+  wave.owner = xTaskGetCurrentTaskHandle();
+  AXI_TIMER_set_handler(wave.timer, wave_step);
+  // Every step, the first one too, is started with
+  // AXI_TIMER_set_oneshot_from_ISR, which leaves the NVIC alone.
+  irq = (wave.timer >> 1) == 0 ? TIMER0_IRQ : TIMER1_IRQ;
+  NVIC_SetPriority(irq, PMOD_WAVE_IRQ_PRIORITY);
+  NVIC_EnableIRQ(irq);
+  return pdPASS;
+}
+
+/*****************************************************************************/
+// Start playing count steps.
+BaseType_t PMOD_wave_play(const PMOD_step_t *steps, int count,
+			  uint8_t *samples)
+{
+  ASSERT(wave.timer >= 0);
+  ASSERT(wave.owner == xTaskGetCurrentTaskHandle());
+  if(wave.playing || count <= 0)
+    return pdFAIL;
+  ulTaskNotifyTake(pdTRUE, 0);   // forget an old completion
+  wave.steps = steps;
+  wave.count = count;
+  wave.next = 0;
+  wave.samples = samples;
+  wave.playing = 1;
+  // The first step is driven from here, with interrupts masked so that
+  // its delay starts when the pins change.
+  vPortEnterCritical();
+  wave_step();
+  vPortExitCritical();
+  return pdPASS;
+}
+
+/*****************************************************************************/
+// Wait for the waveform to finish.
+BaseType_t PMOD_wave_wait(TickType_t xTicksToWait)
+{
+  if(!wave.playing)
+    return pdPASS;
+  ulTaskNotifyTake(pdTRUE, xTicksToWait);
+  return wave.playing ? pdFAIL : pdPASS;
+}
+
+/*****************************************************************************/
+// Fill steps with one SPI mode 0 byte, most significant bit first.
+int PMOD_wave_spi_byte(PMOD_step_t *steps, uint8_t byte,
+		       uint8_t sck, uint8_t mosi, uint32_t half_period)
+{
+  int n = 0;
+  for(int bit=7; bit>=0; bit--)
+    {
+      // sck low, and the next data bit
+      steps[n].mask = sck | mosi;
+      steps[n].value = (byte >> bit) & 1 ? mosi : 0;
+      steps[n].sample = 0;
+      steps[n++].delay = half_period;
+      // sck high, and sample miso
+      steps[n].mask = sck;
+      steps[n].value = sck;
+      steps[n].sample = 1;
+      steps[n++].delay = half_period;
+    }
+  return n;
+}
+
+/*****************************************************************************/
+// Turn the 8 samples of one SPI byte into the byte read from miso.
+uint8_t PMOD_wave_spi_result(const uint8_t *samples, uint8_t miso)
+{
+  uint8_t byte = 0;
+  for(int i=0; i<8; i++)
+    byte = (byte << 1) | ((samples[i] & miso) != 0);
+  return byte;
+}
@@ -0,0 +1,74 @@
+#include <sprite_test_task.h>
+#include <task.h>
+#include <stdio.h>
+#include <malloc.h>
+#include <UART_16550.h>
+#include <view.h>
+
+#define TEST_DEATHS 1000
+// show the title screen every so many deaths, as a game over would
+#define TITLE_EVERY 50
+
+// One death: the explosion frames the game shows, then the player
+// sprite again.
+static void play_death(int x, int y)
+{
+  for(int f=0; f<EXPLOSION_FRAMES; f++){
+    playerExplosionDisplay(x, y);
+    refreshScreen();
+  }
+  playerClear(x, y);
+  playerDisplay(x, y);
+  refreshScreen();
+}
+
+void sprite_test_task(void *pvParameters)
+{
+  static char buffer[80];
+  struct mallinfo before, after;
+  size_t free_before, free_after;
+
+  // The view is the game's: it is set up here, and the ninvaders task
+  // must not be running as well (see main.c).
+  graphicEngineInit();
+
+  // The first frames may still allocate (curses' own buffers), so warm
+  // up before taking the baseline.
+  play_death(0, PLAYERPOSY);
+  titleScreenDisplay();
+  titleScreenClear();
+
+  before = mallinfo();
+  free_before = xPortGetFreeHeapSize();
+
+  for(int i=0; i<TEST_DEATHS; i++){
+    play_death(i % (SCREENWIDTH - PLAYERWIDTH), PLAYERPOSY);
+    if(i % TITLE_EVERY == 0){
+      titleScreenDisplay();
+      titleScreenClear();
+    }
+  }
+
+  after = mallinfo();
+  free_after = xPortGetFreeHeapSize();
+
+  sprintf(buffer, "sprites: %d deaths, heap in use %d -> %d bytes, free %u -> %u\r\n",
+          TEST_DEATHS, before.uordblks, after.uordblks,
+          (unsigned)free_before, (unsigned)free_after);
+  UART_16550_write_string(UART1, buffer, portMAX_DELAY);
+  if(after.uordblks == before.uordblks && free_after == free_before)
+    UART_16550_write_string(UART1, "sprites: PASS\r\n", portMAX_DELAY);
+  else
+    UART_16550_write_string(UART1, "sprites: FAIL, the view allocated while running\r\n", portMAX_DELAY);
+
+  while(1)
+    vTaskDelay(portMAX_DELAY);
+}
+
+/* Structure that will hold the TCB of the task being created. */
+StaticTask_t sprite_test_TCB;
+
+/* Buffer that the task being created will use as its stack. Note this
+is an array of StackType_t variables. The size of StackType_t is
+dependent on the RTOS port. */
+StackType_t sprite_test_stack[ SPRITE_TEST_STACK_SIZE ];
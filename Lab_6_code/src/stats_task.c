@@ -2,10 +2,14 @@
 #include <stats_task.h>
 #include <task.h>
 #include <stdio.h>
+#include <string.h>
 #include <UART_16550.h>
 #include <AXI_timer.h>
 #include <ANSI_terminal.h>
 #include <uart_driver_table.h>
+#include <sound_effects.h>
+#include <governor.h>
+#include <board_io.h>
 
 static int stats_counter=0;
 
@@ -23,11 +27,49 @@ static void stats_handler()
   stats_counter++;
 }
 
-void stats_task(void *pvParameters)
+// The CPU load is shown on the LEDs this often, and the statistics
+// are printed this often, or right away when a switch changes.
+#define LOAD_PERIOD_MS 250
+#define STATS_PRINT_MS 5000
+#define STATS_MAX_TASKS 16
+
+// The last load that load_task measured, for the stats page.
+static volatile int current_load;
+
+// Percentage of the run time that tasks other than idle used since
+// the last call.
+static int cpu_load()
+{
+  static TaskStatus_t status[STATS_MAX_TASKS];
+  static uint32_t last_total, last_idle;
+  uint32_t total, idle = 0, busy;
+  int n = uxTaskGetSystemState(status, STATS_MAX_TASKS, &total);
+  for(int i=0; i<n; i++)
+    if(strcmp(status[i].pcTaskName, configIDLE_TASK_NAME) == 0)
+      idle = status[i].ulRunTimeCounter;
+  busy = (total - last_total) - (idle - last_idle);
+  total -= last_total;
+  last_total += total;
+  last_idle = idle;
+  if(total == 0)
+    return 0;
+  return (uint64_t)busy * 100 / total;
+}
+
+// Light one of the 16 LEDs for each 1/16 of the CPU in use, and show
+// the overall level on RGB LED 0.
+static void show_load(int load)
+{
+  int lit = (load * 16 + 50) / 100;
+  LEDS_set(0xFFFF, (1 << lit) - 1);
+  RGB_LEDS_set(0, load < 50 ? RGB_GREEN : load < 80 ? RGB_YELLOW : RGB_RED);
+}
+
+// Measure the CPU load and show it on the LEDs. This task also owns
+// the timer behind the run time counters, so it runs whether or not
+// stats_task does.
+void load_task(void *pvParameters)
 {
-  static char stats_buffer[1024];
-  static char mem_buffer[64];
-  size_t heapsize;
   int timer;
   timer = AXI_TIMER_allocate();
   AXI_TIMER_set_handler(timer,stats_handler);
@@ -35,17 +77,64 @@ void stats_task(void *pvParameters)
 
   while(1)
     {
+      vTaskDelay(pdMS_TO_TICKS(LOAD_PERIOD_MS));
+      current_load = cpu_load();
+      show_load(current_load);
+    }
+}
+
+void stats_task(void *pvParameters)
+{
+  static char stats_buffer[1024];
+  static char mem_buffer[64];
+  static char audio_buffer[224];
+  static char game_buffer[96];
+  static char load_buffer[64];
+  audio_stats_t audio;
+  GovernorStats game;
+  size_t heapsize;
+  uint32_t switches;
+  SWITCHES_notify(xTaskGetCurrentTaskHandle());
+
+  while(1)
+    {
+      // Print now and then, or at once when a switch moves.
+      xTaskNotifyWait(0, 0, &switches, pdMS_TO_TICKS(STATS_PRINT_MS));
+      snprintf(load_buffer,sizeof(load_buffer),
+              "CPU: %d%% busy, switches %04lx\n",current_load,
+              (unsigned long)SWITCHES_state());
       vTaskGetRunTimeStats(stats_buffer);
       heapsize = xPortGetFreeHeapSize();
-      sprintf(mem_buffer,"Heap Used: %u\n",(0xFFFFFFFF)-heapsize);
+      snprintf(mem_buffer,sizeof(mem_buffer),"Heap Used: %lu\n",
+              (unsigned long)((0xFFFFFFFF)-heapsize));
+      effect_get_stats(&audio);
+      snprintf(audio_buffer,sizeof(audio_buffer),
+              "Audio: %lu underruns, %lu late mixes, %d buffers, "
+              "queue depth %d-%d, backlog %d, latency %lu ms (max %lu ms), "
+              "level %ld (peak %ld), stack %lu words free\n",
+              (unsigned long)audio.underruns,(unsigned long)audio.late_mixes,
+              audio.active_buffers,audio.mixer_to_isr_min,audio.mixer_to_isr_max,
+              audio.isr_to_mixer_max,(unsigned long)audio.last_latency_ms,
+              (unsigned long)audio.max_latency_ms,(long)audio.mix_rms,
+              (long)audio.mix_peak,(unsigned long)audio.stack_free);
+      governorGetStats(&game);
+      snprintf(game_buffer,sizeof(game_buffer),
+              "Game: %d fps, %d bytes/frame, %d bytes/s, "
+              "%d deferred updates\n",game.framesPerSecond,game.bytesPerFrame,
+              game.bytesPerSecond,game.deferred);
       ANSI_uart.tx_lock(UART1,portMAX_DELAY);
       ANSI_clear(UART1);
+      ANSI_moveTo(UART1,1,0);
+      ANSI_uart.write_string(UART1,load_buffer,portMAX_DELAY);
+      ANSI_moveTo(UART1,2,0);
+      ANSI_uart.write_string(UART1,game_buffer,portMAX_DELAY);
       ANSI_moveTo(UART1,3,0);\
       ANSI_uart.write_string(UART1,mem_buffer,portMAX_DELAY);
-      ANSI_moveTo(UART1,5,0);
+      ANSI_moveTo(UART1,4,0);
+      ANSI_uart.write_string(UART1,audio_buffer,portMAX_DELAY);
+      ANSI_moveTo(UART1,6,0);
       ANSI_uart.write_string(UART1,stats_buffer,portMAX_DELAY);
       ANSI_uart.tx_unlock(UART1);
-      vTaskDelay(pdMS_TO_TICKS( 5000 ));
     }
 }
 
@@ -57,3 +146,10 @@ is an array of StackType_t variables. The size of StackType_t is
 dependent on the RTOS port. */
 StackType_t stats_stack[ STATS_STACK_SIZE ];
 
+/* Structure that will hold the TCB of the task being created. */
+StaticTask_t load_TCB;
+
+/* Buffer that the task being created will use as its stack. Note this
+is an array of StackType_t variables. The size of StackType_t is
+dependent on the RTOS port. */
+StackType_t load_stack[ LOAD_STACK_SIZE ];
@@ -0,0 +1,195 @@
+// Host-side tool that converts a sound file into IMA-ADPCM C tables
+// for the sound effects mixer (see sound_effects/adpcm.h).
+//
+// Build it with the host compiler, not the cross compiler:
+//
+//   cc -O2 -I../sound_effects -o adpcm_convert adpcm_convert.c ../sound_effects/adpcm.c
+//
+// Usage:
+//
+//   adpcm_convert [-r8] input name
+//
+// The input is a mono or stereo PCM WAV file (8 or 16 bit), or with
+// -r8, raw signed 8-bit samples like the tables in sounds.c. The
+// tool writes name.c and name.h into the current directory. The
+// sample rate is not changed; it is written to name.h as
+// name_RATE (8000 for raw input) so the mixer can resample the effect
+// if it differs from the mixer's rate.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <adpcm.h>
+
+static void usage(const char *prog)
+{
+  fprintf(stderr, "Usage: %s [-r8] input name\n", prog);
+  exit(1);
+}
+
+static uint32_t get_le(const uint8_t *p, int bytes)
+{
+  uint32_t v = 0;
+  for(int i=bytes-1; i>=0; i--)
+    v = (v << 8) | p[i];
+  return v;
+}
+
+// Read the whole file into memory.
+static uint8_t *read_file(const char *path, long *size)
+{
+  FILE *f = fopen(path, "rb");
+  uint8_t *data;
+
+  if(f == NULL){
+    perror(path);
+    exit(1);
+  }
+  fseek(f, 0, SEEK_END);
+  *size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data = malloc(*size);
+  if(data == NULL || fread(data, 1, *size, f) != (size_t)*size){
+    fprintf(stderr, "%s: read failed\n", path);
+    exit(1);
+  }
+  fclose(f);
+  return data;
+}
+
+// Convert raw signed 8-bit samples to 16 bits.
+static int16_t *load_raw8(const uint8_t *data, long size, long *num_samples)
+{
+  int16_t *samples = malloc(size * sizeof(int16_t));
+
+  for(long i=0; i<size; i++)
+    samples[i] = (int8_t)data[i] * 256;
+  *num_samples = size;
+  return samples;
+}
+
+// Pull the PCM samples out of a WAV file, mixing stereo down to mono.
+static int16_t *load_wav(const uint8_t *data, long size, long *num_samples, long *rate)
+{
+  const uint8_t *fmt = NULL, *pcm = NULL;
+  uint32_t pcm_size = 0;
+  int channels, bits;
+  long frames;
+  int16_t *samples;
+
+  if(size < 12 || memcmp(data, "RIFF", 4) || memcmp(data + 8, "WAVE", 4)){
+    fprintf(stderr, "not a WAV file (use -r8 for raw samples)\n");
+    exit(1);
+  }
+
+  for(long pos = 12; pos + 8 <= size; ){
+    uint32_t len = get_le(data + pos + 4, 4);
+    if(!memcmp(data + pos, "fmt ", 4))
+      fmt = data + pos + 8;
+    else if(!memcmp(data + pos, "data", 4)){
+      pcm = data + pos + 8;
+      pcm_size = len;
+      if(pos + 8 + pcm_size > size)
+        pcm_size = size - pos - 8;
+    }
+    pos += 8 + len + (len & 1);
+  }
+
+  if(fmt == NULL || pcm == NULL || get_le(fmt, 2) != 1){
+    fprintf(stderr, "only uncompressed PCM WAV files are supported\n");
+    exit(1);
+  }
+  channels = get_le(fmt + 2, 2);
+  *rate = get_le(fmt + 4, 4);
+  bits = get_le(fmt + 14, 2);
+  if((bits != 8 && bits != 16) || channels < 1){
+    fprintf(stderr, "only 8 and 16 bit WAV files are supported\n");
+    exit(1);
+  }
+
+  frames = pcm_size / (channels * bits / 8);
+  samples = malloc(frames * sizeof(int16_t));
+  for(long i=0; i<frames; i++){
+    int32_t sum = 0;
+    for(int c=0; c<channels; c++){
+      if(bits == 8)
+        sum += ((int)*pcm++ - 128) * 256;
+      else{
+        sum += (int16_t)get_le(pcm, 2);
+        pcm += 2;
+      }
+    }
+    samples[i] = sum / channels;
+  }
+  *num_samples = frames;
+  return samples;
+}
+
+int main(int argc, char **argv)
+{
+  int raw = 0;
+  const char *input, *name;
+  char path[256];
+  uint8_t *data;
+  long size, num_samples, num_blocks, rate = 8000;
+  int16_t *samples;
+  int16_t block_in[EFFECT_BUFFER_SIZE];
+  adpcm_block block;
+  adpcm_state state = {0, 0};
+  FILE *c, *h;
+
+  if(argc == 4 && !strcmp(argv[1], "-r8"))
+    raw = 1;
+  else if(argc != 3)
+    usage(argv[0]);
+  input = argv[argc - 2];
+  name = argv[argc - 1];
+
+  data = read_file(input, &size);
+  samples = raw ? load_raw8(data, size, &num_samples) : load_wav(data, size, &num_samples, &rate);
+  num_blocks = (num_samples + EFFECT_BUFFER_SIZE - 1) / EFFECT_BUFFER_SIZE;
+
+  snprintf(path, sizeof(path), "%s.h", name);
+  h = fopen(path, "w");
+  snprintf(path, sizeof(path), "%s.c", name);
+  c = fopen(path, "w");
+  if(h == NULL || c == NULL){
+    perror(path);
+    return 1;
+  }
+
+  fprintf(h, "#ifndef %s_ADPCM_H\n#define %s_ADPCM_H\n\n", name, name);
+  fprintf(h, "#include <adpcm.h>\n\n");
+  fprintf(h, "// Generated by adpcm_convert from %s\n", input);
+  fprintf(h, "#define NUM_%s_BLOCKS \t%ld\n", name, num_blocks);
+  fprintf(h, "#define %s_RATE \t%ld\n", name, rate);
+  fprintf(h, "extern const adpcm_block %s[NUM_%s_BLOCKS];\n\n#endif\n", name, name);
+
+  fprintf(c, "#include <%s.h>\n\n", name);
+  fprintf(c, "const adpcm_block %s[NUM_%s_BLOCKS] = {\n", name, name);
+  for(long b=0; b<num_blocks; b++){
+    // pad the last block with silence
+    for(int i=0; i<EFFECT_BUFFER_SIZE; i++){
+      long n = b * EFFECT_BUFFER_SIZE + i;
+      block_in[i] = n < num_samples ? samples[n] : 0;
+    }
+    adpcm_encode_block(&state, block_in, &block);
+
+    fprintf(c, "  {%d, %d, 0, {", block.predictor, block.step_index);
+    for(int i=0; i<ADPCM_BLOCK_BYTES; i++){
+      fprintf(c, i % 16 == 0 ? "\n    " : " ");
+      fprintf(c, "0x%02X%s", block.data[i], i < ADPCM_BLOCK_BYTES - 1 ? "," : "");
+    }
+    fprintf(c, "\t}\n\t}%s\n", b < num_blocks - 1 ? "," : "");
+  }
+  fprintf(c, "};\n");
+
+  fclose(c);
+  fclose(h);
+  fprintf(stderr, "%s: %ld samples, %ld blocks, %ld bytes (was %ld as 8-bit)\n",
+          name, num_samples, num_blocks, num_blocks * (long)sizeof(adpcm_block),
+          num_blocks * (long)EFFECT_BUFFER_SIZE);
+  free(samples);
+  free(data);
+  return 0;
+}
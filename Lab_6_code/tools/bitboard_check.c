@@ -0,0 +1,206 @@
+// Host-side check for the game's alien and bunker bitboards (see
+// ninvaders/bitboard.h).
+//
+// Build it with the host compiler, not the cross compiler:
+//
+//   cc -O2 -I../ninvaders -o bitboard_check bitboard_check.c
+//
+// The old int array representation and the full scan that render()
+// used to do are kept here as a reference. Random sequences of shots
+// are applied to both, and after every shot the hit results, the
+// block extents, lowest_ship, the number of aliens left and the bunker
+// contents must be the same. The tool exits with an error on the
+// first difference. A rough timing of the extent calculation is
+// printed as well.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <bitboard.h>
+
+#define BUNKERWIDTH  80
+#define BUNKERHEIGHT 4
+#define BUNKER_WORDS BITBOARD_WORDS(BUNKERWIDTH)
+
+#define NUM_GAMES 10000
+#define TIMING_LOOPS 1000000
+
+typedef struct {
+  int left, right, bottom, shipnum;
+  int lowest_ship[ALIENS_MAX_NUMBER_X];
+} extents_t;
+
+static const int level[ALIENS_MAX_NUMBER_Y] = {1,2,2,3,3};
+
+// The reference: the old representation and scan
+static int alienBlock[ALIENS_MAX_NUMBER_Y][ALIENS_MAX_NUMBER_X];
+static int bunkerRef[BUNKERHEIGHT][BUNKERWIDTH + 1];
+
+static void scan_reference(extents_t *e)
+{
+  int k,row;
+  int c=0;
+  e->left=1;
+  e->right=-1;
+  e->bottom=-1;
+  e->shipnum=0;
+  for (k=0;k<ALIENS_MAX_NUMBER_X;k++)
+    e->lowest_ship[k]=-1;
+  for (row=0;row<ALIENS_MAX_NUMBER_Y*2;row++)
+    {
+      if ((row%2)==0)
+        {
+          for (k=0;k<ALIENS_MAX_NUMBER_X;k++)
+            if (alienBlock[c][k] != 0)
+              {
+                e->lowest_ship[k]=row;
+                e->shipnum++;
+                if (e->left==1 || -k>e->left) e->left=-k;
+                if (e->right==-1 || k>e->right) e->right=k;
+                if (e->bottom==-1 || c>e->bottom) e->bottom=c;
+              }
+        }
+      else
+        c++;
+    }
+  e->bottom=e->bottom*2;
+  e->left=e->left*3;
+  e->right=e->right*3;
+}
+
+// The new representation, computed as render() does now
+static AlienBoard board;
+static uint32_t bunker[BUNKERHEIGHT][BUNKER_WORDS];
+
+static void scan_bitboard(extents_t *e)
+{
+  int k,row;
+  e->shipnum=board.count;
+  for (k=0;k<ALIENS_MAX_NUMBER_X;k++)
+    {
+      row=alienBoardLowest(&board,k);
+      e->lowest_ship[k]=(row == -1) ? -1 : row*2;
+    }
+  if (e->shipnum > 0)
+    {
+      e->left=-alienBoardLeft(&board)*3;
+      e->right=alienBoardRight(&board)*3;
+      e->bottom=alienBoardBottom(&board)*2;
+    }
+  else
+    {
+      e->left=3;
+      e->right=-3;
+      e->bottom=-2;
+    }
+}
+
+static int compare(const extents_t *a, const extents_t *b)
+{
+  int k;
+  if (a->left != b->left || a->right != b->right ||
+      a->bottom != b->bottom || a->shipnum != b->shipnum)
+    return 1;
+  for (k=0;k<ALIENS_MAX_NUMBER_X;k++)
+    if (a->lowest_ship[k] != b->lowest_ship[k])
+      return 1;
+  return 0;
+}
+
+static void reset(void)
+{
+  int x,y;
+  for (y=0;y<ALIENS_MAX_NUMBER_Y;y++)
+    for (x=0;x<ALIENS_MAX_NUMBER_X;x++)
+      alienBlock[y][x]=level[y];
+  alienBoardFill(&board,level);
+
+  for (y=0;y<BUNKERHEIGHT;y++)
+    {
+      for (x=0;x<BUNKER_WORDS;x++)
+        bunker[y][x]=0;
+      for (x=0;x<BUNKERWIDTH;x++)
+        {
+          // a random pattern; the shape does not matter here
+          bunkerRef[y][x]=rand()&1;
+          if (bunkerRef[y][x])
+            bitboardSet(bunker[y],x);
+        }
+    }
+}
+
+int main(void)
+{
+  int game,shot,x,y,hitRef,hitNew;
+  long shots=0;
+  extents_t ref,bb;
+  clock_t start;
+  double t_ref,t_bb;
+  volatile int sink=0;
+
+  srand(1);
+  for (game=0;game<NUM_GAMES;game++)
+    {
+      reset();
+      for (shot=0;shot<200;shot++,shots++)
+        {
+          // aliens
+          x=rand()%ALIENS_MAX_NUMBER_X;
+          y=rand()%ALIENS_MAX_NUMBER_Y;
+          hitRef=alienBlock[y][x];
+          alienBlock[y][x]=0;
+          hitNew=alienBoardKill(&board,x,y);
+          scan_reference(&ref);
+          scan_bitboard(&bb);
+          if (hitRef != hitNew || compare(&ref,&bb))
+            {
+              printf("aliens differ in game %d after shot %d at (%d,%d)\n",
+                     game,shot,x,y);
+              return 1;
+            }
+
+          // bunkers
+          x=rand()%BUNKERWIDTH;
+          y=rand()%BUNKERHEIGHT;
+          hitRef=bunkerRef[y][x];
+          bunkerRef[y][x]=0;
+          hitNew=bitboardTest(bunker[y],x);
+          bitboardClear(bunker[y],x);
+          if (hitRef != hitNew)
+            {
+              printf("bunkers differ in game %d after shot %d at (%d,%d)\n",
+                     game,shot,x,y);
+              return 1;
+            }
+        }
+    }
+  printf("%ld shots over %d games: identical\n",shots,NUM_GAMES);
+
+  // time the extent calculation on a half empty block
+  reset();
+  for (x=0;x<ALIENS_MAX_NUMBER_X*ALIENS_MAX_NUMBER_Y/2;x++)
+    {
+      int col=rand()%ALIENS_MAX_NUMBER_X,row=rand()%ALIENS_MAX_NUMBER_Y;
+      alienBlock[row][col]=0;
+      alienBoardKill(&board,col,row);
+    }
+  start=clock();
+  for (x=0;x<TIMING_LOOPS;x++)
+    {
+      scan_reference(&ref);
+      sink+=ref.left;
+    }
+  t_ref=(double)(clock()-start)/CLOCKS_PER_SEC;
+  start=clock();
+  for (x=0;x<TIMING_LOOPS;x++)
+    {
+      scan_bitboard(&bb);
+      sink+=bb.left;
+    }
+  t_bb=(double)(clock()-start)/CLOCKS_PER_SEC;
+  printf("extents: scan %.1f ns, bitboard %.1f ns\n",
+         t_ref*1e9/TIMING_LOOPS,t_bb*1e9/TIMING_LOOPS);
+  printf("storage: %zu + %zu bytes, was %zu + %zu bytes\n",
+         sizeof(board),sizeof(bunker),sizeof(alienBlock),sizeof(bunkerRef));
+  return 0;
+}
@@ -0,0 +1,189 @@
+// Host-side benchmark for the nInvaders simulation core (see
+// ninvaders/game.h), using the null renderer in game_null.c.
+//
+// Build it with the host compiler, not the cross compiler:
+//
+//   cc -O2 -I../ninvaders -o game_bench game_bench.c game_null.c ../ninvaders/game.c ../ninvaders/record.c ../ninvaders/aliens.c ../ninvaders/player.c ../ninvaders/ufo.c
+//
+// Only the curses header is needed (for the key codes), not the
+// library.
+//
+//   ./game_bench [-w file] [frames] [seed]
+//   ./game_bench -r file
+//
+// A simple bot plays the game: it starts a new game from the title
+// screen, then moves and shoots at random. The time per frame is
+// printed, together with a checksum of the game state after every
+// frame. The checksum depends only on the seed and the number of
+// frames, so an optimization of the game rules must leave it
+// unchanged; if it does not, the game no longer plays the same.
+//
+// With -w the bot's game is also saved as a recording (see
+// ninvaders/record.h). With -r a recording is replayed instead, such
+// as one written by the game on the target with the 'D' key, so a
+// session from the field can be profiled on the host. Replaying a
+// recording made with -w gives the checksum of the original run.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <string.h>
+#include <game.h>
+#include <record.h>
+#include <aliens.h>
+#include <player.h>
+#include <ufo.h>
+
+// The bot has its own generator, so that its keys do not disturb the
+// game's use of random().
+static uint32_t bot_state;
+
+static int bot_key(void)
+{
+  static const int keys[] = {'h', 'l', ' ', 'k'};
+  bot_state = bot_state * 1664525u + 1013904223u;
+  if (game.status == GAME_HIGHSCORE)
+    return ' ';               // start a new game
+  if ((bot_state >> 28) < 6)  // press a key in 6 out of 16 frames
+    return keys[(bot_state >> 24) & 3];
+  return GAME_NO_KEY;
+}
+
+// FNV-1a over the parts of the state that matter
+static uint32_t hash(uint32_t h, int32_t v)
+{
+  int i;
+  for (i = 0; i < 4; i++)
+    {
+      h ^= (v >> (8 * i)) & 0xFF;
+      h *= 16777619u;
+    }
+  return h;
+}
+
+static uint32_t checksum(uint32_t h)
+{
+  h = hash(h, game.status);
+  h = hash(h, game.lives);
+  h = hash(h, game.score);
+  h = hash(h, game.level);
+  h = hash(h, aliens.posX);
+  h = hash(h, aliens.posY);
+  h = hash(h, shipnum);
+  h = hash(h, ufo.posX);
+  h = hash(h, alienshotx[0]);
+  h = hash(h, alienshoty[0]);
+  return h;
+}
+
+// Read a recording in the text form
+static int load(const char *name, Recording *rec)
+{
+  char line[64];
+  unsigned long seed, frames;
+  int skill, count, result = 0;
+  FILE *f = fopen(name, "r");
+
+  if (f == NULL || fgets(line, sizeof(line), f) == NULL ||
+      sscanf(line, "nInvaders-record %lu %d %lu %d", &seed, &skill, &frames, &count) != 4)
+    {
+      printf("%s: not a recording\n", name);
+      return 0;
+    }
+  rec->capacity = count;
+  rec->events = malloc(count * sizeof(RecordEvent) + 1);
+  recordParse(rec, line);
+  while (result == 0 && fgets(line, sizeof(line), f) != NULL)
+    result = recordParse(rec, line);
+  fclose(f);
+  if (result != 1)
+    printf("%s: bad or truncated recording\n", name);
+  return result == 1;
+}
+
+// Write a recording in the text form
+static void save(const char *name, const Recording *rec)
+{
+  char line[64];
+  int n;
+  FILE *f = fopen(name, "w");
+
+  for (n = 0; recordFormat(rec, n, line, sizeof(line)); n++)
+    fputs(line, f);
+  fclose(f);
+}
+
+int main(int argc, char **argv)
+{
+  const char *record_file = NULL, *replay_file = NULL;
+  long frames, i, games = 0, max_level = 0;
+  unsigned seed;
+  uint32_t sum = 2166136261u;
+  struct timespec start, end;
+  double ns;
+  Recording rec;
+  Replay replay;
+
+  if (argc > 2 && strcmp(argv[1], "-w") == 0)
+    {
+      record_file = argv[2];
+      argc -= 2;
+      argv += 2;
+    }
+  else if (argc > 2 && strcmp(argv[1], "-r") == 0)
+    replay_file = argv[2];
+  frames = argc > 1 && !replay_file ? atol(argv[1]) : 10000000;
+  seed = argc > 2 && !replay_file ? atoi(argv[2]) : 1;
+
+  if (replay_file)
+    {
+      if (!load(replay_file, &rec))
+        return 1;
+      replayStart(&replay, &rec);
+      frames = rec.frames;
+    }
+  else if (record_file)
+    {
+      // the bot presses a key in less than half of the frames
+      RecordEvent *buffer = malloc(frames / 2 * sizeof(RecordEvent) + 1);
+      recordStart(&rec, buffer, frames / 2, 1, seed);
+    }
+  else
+    gameInit(1, seed);
+  bot_state = seed;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (i = 0; i < frames; i++)
+    {
+      int title = game.status == GAME_HIGHSCORE;
+      if (replay_file)
+        replayStep(&replay);
+      else
+        {
+          int key = bot_key();
+          if (record_file)
+            {
+              if (key != GAME_NO_KEY)
+                recordInput(&rec, key);
+              recordStep(&rec);
+            }
+          else
+            gameStep(key);
+        }
+      if (title && game.status != GAME_HIGHSCORE)
+        games++;
+      if (game.level > max_level)
+        max_level = game.level;
+      sum = checksum(sum);
+    }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  if (record_file)
+    save(record_file, &rec);
+
+  ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+  printf("%ld frames, %ld games, highest level %ld\n", frames, games, max_level);
+  printf("%.1f ns per frame (%.0f frames/s)\n", ns / frames, frames * 1e9 / ns);
+  printf("checksum %08lx\n", (unsigned long)sum);
+  return 0;
+}
@@ -0,0 +1,35 @@
+// Null renderer for running the nInvaders simulation core on the host
+// (see game_bench.c). Every drawing and sound call of the game is
+// accepted and ignored, so only the cost of the game rules is left.
+
+#include <view.h>
+#include <sound.h>
+
+void graphicEngineInit() {}
+void aliensClear(int x, int y, int wid, int hgt) {}
+void aliensDisplay(int x, int y, int wid, int hgt) {}
+void aliensMissileClear(int x, int y) {}
+void aliensMissileDisplay(int x, int y) {}
+void aliensRefresh(int level, AlienBoard *board) {}
+void battleFieldClear() {}
+void bunkersClear() {}
+void bunkersClearElement(int x, int y) {}
+void bunkersDisplay(uint32_t *pBunker) {}
+void gameOverDisplay() {}
+void playerClear(int x, int y) {}
+void playerDisplay(int x, int y) {}
+void playerExplosionDisplay(int x, int y) {}
+void playerMissileClear(int x, int y) {}
+void playerMissileDisplay(int x, int y) {}
+void titleScreenClear() {}
+void titleScreenDisplay() {}
+void ufoClear(int x, int y) {}
+void ufoDisplay(int x, int y) {}
+void ufoRefresh() {}
+void statusDisplay(int level, int score, int lives) {}
+void refreshScreen() {}
+
+void soundPlay(Sound sound) {}
+void soundUfoOn(int freq) {}
+void soundUfoFreq(int freq) {}
+void soundUfoOff() {}
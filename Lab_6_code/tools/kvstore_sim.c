@@ -0,0 +1,327 @@
+// Host-side simulation of the flash the game's key-value store and
+// high score table are kept in (see ninvaders/kvstore.h and
+// ninvaders/highscore.h).
+//
+// Build it with the host compiler, not the cross compiler:
+//
+//   cc -O2 -I../ninvaders -o kvstore_sim kvstore_sim.c ../ninvaders/kvstore.c ../ninvaders/highscore.c
+//
+// The simulated medium has the same geometry as the board's region (4
+// sectors of 1 KB) and enforces the rules of NOR flash: programming may
+// only clear bits, and the tool exits with an error if the store ever
+// tries to set one without an erase. Erases are counted per sector.
+//
+// The tests are:
+//  - values written are read back, before and after reopening;
+//  - a long run of writes wears all sectors evenly;
+//  - power is cut at random points in programs and erases (a word
+//    being programmed gets only some of its bits, a sector being erased
+//    is left half erased), the store is reopened, and every key must
+//    hold either the last value whose write completed or the value
+//    being written, never anything else. Now and then the power goes
+//    again while the store recovers;
+//  - the high score table matches a reference top ten, across reopens.
+// A rough timing of kvOpen() and kvPut() is printed as well.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include <time.h>
+#include <kvstore.h>
+#include <highscore.h>
+
+#define SECTOR_SIZE 1024
+#define SECTORS 4
+#define KEYS 4
+
+#define WEAR_WRITES 100000
+#define CUTS 20000
+#define TIMING_LOOPS 10000
+
+static uint32_t flash[SECTORS * SECTOR_SIZE / 4];
+static uint32_t eraseCount[SECTORS];
+
+// power is cut when this reaches 0; negative while power stays on
+static long powerLeft = -1;
+static jmp_buf powerCut;
+
+static void powerTick()
+{
+  if (powerLeft >= 0 && powerLeft-- == 0)
+    longjmp(powerCut,1);
+}
+
+static void simErase(const KvMedium *medium, int sector)
+{
+  uint32_t *words = flash + sector * SECTOR_SIZE / 4;
+  int i;
+
+  eraseCount[sector]++;
+  if (powerLeft == 0)
+    {
+      // cut during the erase: only some of the words got there
+      for (i=0;i<SECTOR_SIZE/4;i++)
+        if (rand()&1)
+          words[i]=0xffffffff;
+    }
+  powerTick();
+  for (i=0;i<SECTOR_SIZE/4;i++)
+    words[i]=0xffffffff;
+}
+
+static void simProgram(const KvMedium *medium, uint32_t offset,
+                       const uint32_t *words, int count)
+{
+  uint32_t *to = flash + offset / 4;
+  int i;
+
+  if (offset % 4 != 0 || offset + count * 4 > sizeof(flash))
+    {
+      printf("program out of range at %u\n",offset);
+      exit(1);
+    }
+  for (i=0;i<count;i++)
+    {
+      if (~to[i] & words[i])
+        {
+          printf("program sets bits at %u: %08x over %08x\n",
+                 offset + i * 4,words[i],to[i]);
+          exit(1);
+        }
+      if (powerLeft == 0)
+        to[i] &= words[i] | (uint32_t)rand();	// cut: some bits only
+      powerTick();
+      to[i] &= words[i];
+    }
+}
+
+static KvMedium medium = {
+  (uint8_t *)flash, SECTOR_SIZE, SECTORS, NULL, simErase, simProgram
+};
+
+static void blank()
+{
+  memset(flash,0xff,sizeof(flash));
+  memset(eraseCount,0,sizeof(eraseCount));
+}
+
+static void fail(const char *what, long n)
+{
+  printf("%s (step %ld)\n",what,n);
+  exit(1);
+}
+
+// values are a key, a serial number and filler, of varying length
+static int makeValue(uint8_t *value, int key, uint32_t serial)
+{
+  int length = 8 + (serial * 7 + key * 13) % 120;
+  int i;
+
+  memcpy(value,&serial,4);
+  memcpy(value+4,&key,4);
+  for (i=8;i<length;i++)
+    value[i]=(uint8_t)(serial + i);
+  return length;
+}
+
+static int sameValue(const KvStore *store, int key, uint32_t serial)
+{
+  uint8_t want[KV_MAX_LENGTH], got[KV_MAX_LENGTH];
+  int length = makeValue(want,key,serial);
+
+  return kvGet(store,key,got,sizeof(got)) == length && memcmp(want,got,length) == 0;
+}
+
+static void testBasic()
+{
+  static KvStore store;
+  uint8_t value[KV_MAX_LENGTH];
+  int key,length;
+
+  blank();
+  if (kvOpen(&store,&medium) != 0)
+    fail("cannot open a blank medium",0);
+  if (kvGet(&store,1,value,sizeof(value)) != -1)
+    fail("a blank store has a key",0);
+  for (key=1;key<=KEYS;key++)
+    {
+      length=makeValue(value,key,key);
+      if (kvPut(&store,key,value,length) != 0)
+        fail("put failed",key);
+    }
+  if (kvPut(&store,KV_NO_KEY,value,4) != -1 ||
+      kvPut(&store,1,value,KV_MAX_LENGTH+1) != -1)
+    fail("bad put accepted",0);
+  kvOpen(&store,&medium);
+  for (key=1;key<=KEYS;key++)
+    if (!sameValue(&store,key,key))
+      fail("value lost on reopen",key);
+  printf("basic: ok\n");
+}
+
+static void testWear()
+{
+  static KvStore store;
+  uint8_t value[KV_MAX_LENGTH];
+  uint32_t serial[KEYS+1] = {0};
+  uint32_t least=~0u,most=0;
+  long n;
+  int key,sector;
+
+  blank();
+  kvOpen(&store,&medium);
+  for (n=0;n<WEAR_WRITES;n++)
+    {
+      key=1+rand()%KEYS;
+      serial[key]=n;
+      if (kvPut(&store,key,value,makeValue(value,key,n)) != 0)
+        fail("put failed",n);
+      if (n % 997 == 0)
+        kvOpen(&store,&medium);	// a reset now and then
+    }
+  kvOpen(&store,&medium);
+  for (key=1;key<=KEYS;key++)
+    if (!sameValue(&store,key,serial[key]))
+      fail("wrong value after the wear run",key);
+  for (sector=0;sector<SECTORS;sector++)
+    {
+      if (eraseCount[sector] < least) least=eraseCount[sector];
+      if (eraseCount[sector] > most) most=eraseCount[sector];
+    }
+  if (most - least > 1)
+    fail("sectors wear unevenly",most-least);
+  printf("wear: %d writes, each sector erased %u to %u times, %.1f writes per erase\n",
+         WEAR_WRITES,least,most,(double)WEAR_WRITES/(least+most)*2/SECTORS);
+}
+
+static void testPowerCut()
+{
+  static KvStore store;
+  uint8_t value[KV_MAX_LENGTH];
+  static uint32_t serial[KEYS+1];	// kept across the longjmp
+  long cut;
+  volatile long skipped=0,lost=0;
+  volatile int key,written=0;
+  volatile uint32_t next=KEYS+1;
+  KvStats stats;
+
+  blank();
+  kvOpen(&store,&medium);
+  for (key=1;key<=KEYS;key++)
+    {
+      serial[key]=key;
+      kvPut(&store,key,value,makeValue(value,key,key));
+    }
+  for (cut=0;cut<CUTS;cut++)
+    {
+      key=1+rand()%KEYS;
+      powerLeft=rand()%400;
+      if (setjmp(powerCut) == 0)
+        {
+          // power stays on for a while, then goes mid write
+          while (1)
+            {
+              if (kvPut(&store,key,value,makeValue(value,key,next)) != 0)
+                fail("put failed",cut);
+              serial[key]=next++;
+              written++;
+              key=1+rand()%KEYS;
+            }
+        }
+      powerLeft=-1;
+      if (rand()%4 == 0)
+        {
+          powerLeft=rand()%50;
+          if (setjmp(powerCut) == 0)
+            kvOpen(&store,&medium);
+          powerLeft=-1;
+        }
+      if (kvOpen(&store,&medium) != 0)
+        fail("cannot reopen after a power cut",cut);
+      for (int k=1;k<=KEYS;k++)
+        {
+          if (sameValue(&store,k,serial[k]))
+            continue;
+          if (k == key && sameValue(&store,k,next))
+            {
+              serial[k]=next;	// the cut write had got through
+              continue;
+            }
+          fail("a key holds neither its old nor its new value",cut);
+        }
+      next++;
+      kvGetStats(&store,&stats);
+      skipped+=stats.skipped;
+      lost+=stats.lost;
+    }
+  if (lost != 0)
+    fail("records lost while copying forward",lost);
+  printf("power cuts: %d cuts over %d writes, %ld damaged records skipped, all keys intact\n",
+         CUTS,written,skipped);
+}
+
+static int compareScores(const void *a, const void *b)
+{
+  uint32_t x=*(const uint32_t *)a,y=*(const uint32_t *)b;
+  return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static void testHighscores()
+{
+  static uint32_t all[1000];
+  const HighScoreTable *table;
+  int n,i,rank;
+
+  blank();
+  highscoreInit(&medium);
+  for (n=0;n<1000;n++)
+    {
+      all[n]=1+rand()%30000;
+      rank=highscoreAdd(all[n],1+n%10,1);
+      if (n % 50 == 0)
+        highscoreInit(&medium);	// a reset now and then
+      qsort(all,n+1,sizeof(all[0]),compareScores);
+      table=highscoreTable();
+      if (table->count != (uint32_t)(n+1 < HIGHSCORE_ENTRIES ? n+1 : HIGHSCORE_ENTRIES))
+        fail("wrong number of high scores",n);
+      for (i=0;i<(int)table->count;i++)
+        if (table->entry[i].score != all[i])
+          fail("high score table differs from the reference",n);
+      if (rank >= HIGHSCORE_ENTRIES)
+        fail("bad rank",n);
+    }
+  printf("high scores: ok, best %u (%s)\n",table->entry[0].score,
+         highscoreRating(table->entry[0].score));
+}
+
+static void timing()
+{
+  static KvStore store;
+  uint8_t value[KV_MAX_LENGTH];
+  int n;
+  clock_t start;
+  double tOpen,tPut;
+
+  start=clock();
+  for (n=0;n<TIMING_LOOPS;n++)
+    kvOpen(&store,&medium);
+  tOpen=(double)(clock()-start)/CLOCKS_PER_SEC;
+  start=clock();
+  for (n=0;n<TIMING_LOOPS;n++)
+    kvPut(&store,HIGHSCORE_KEY,value,sizeof(HighScoreTable));
+  tPut=(double)(clock()-start)/CLOCKS_PER_SEC;
+  printf("timing: kvOpen %.2f us, kvPut of the table %.2f us\n",
+         tOpen*1e6/TIMING_LOOPS,tPut*1e6/TIMING_LOOPS);
+}
+
+int main(void)
+{
+  srand(1);
+  testBasic();
+  testWear();
+  testPowerCut();
+  testHighscores();
+  timing();
+  return 0;
+}
@@ -0,0 +1,80 @@
+// Host-side SNR measurement for the mixer's noise shaping quantizer
+// (see sound_effects/noise_shaper.h).
+//
+// Build it with the host compiler, not the cross compiler:
+//
+//   cc -O2 -I../sound_effects -o noise_shaper_snr noise_shaper_snr.c -lm
+//
+// Test tones are generated at the mixer rate with NS_FRAC_BITS bits
+// below the output resolution, as the mixer produces them, and
+// quantized with each order. The quantization error is measured with
+// a DFT over the whole band and over the part of the band below
+// BAND_LIMIT, which is where the shaped noise is reduced.
+
+#include <stdio.h>
+#include <math.h>
+#include <noise_shaper.h>
+
+#define SAMPLE_RATE 8000
+#define BAND_LIMIT  1000
+#define N           4096
+
+static double tone[N];
+static double error[N];
+
+// Noise power in the bins from 1 up to (but not including) max_bin.
+static double band_power(const double *x, int max_bin)
+{
+  double power = 0;
+  for(int k=1; k<max_bin; k++){
+    double re = 0, im = 0;
+    for(int n=0; n<N; n++){
+      re += x[n] * cos(2 * M_PI * k * n / N);
+      im -= x[n] * sin(2 * M_PI * k * n / N);
+    }
+    power += 2 * (re * re + im * im) / ((double)N * N);
+  }
+  return power;
+}
+
+int main()
+{
+  // Tones sit exactly on DFT bins so no window is needed.
+  static const int tone_bins[] = {131, 397};
+  // Amplitudes in output steps: a quiet tone, and one near the level
+  // of a single full scale effect.
+  static const double amplitudes[] = {3.3, 100.0};
+
+  printf("tone Hz  amplitude  order  full band SNR  SNR below %d Hz\n", BAND_LIMIT);
+
+  for(unsigned t=0; t<sizeof(tone_bins)/sizeof(tone_bins[0]); t++){
+    for(unsigned a=0; a<sizeof(amplitudes)/sizeof(amplitudes[0]); a++){
+      double signal = amplitudes[a] * amplitudes[a] / 2;
+      for(int n=0; n<N; n++)
+        tone[n] = amplitudes[a] * sin(2 * M_PI * tone_bins[t] * n / N);
+
+      for(int order=0; order<=2; order++){
+        noise_shaper_t ns;
+        noise_shaper_init(&ns, order);
+        // run through the tone once first so the error feedback has
+        // settled and the measured block wraps round cleanly
+        for(int pass=0; pass<2; pass++)
+          for(int n=0; n<N; n++){
+            int32_t x = (int32_t)lrint(tone[n] * (1 << NS_FRAC_BITS));
+            error[n] = noise_shaper_quantize(&ns, x) - tone[n];
+          }
+
+        double full = 0;
+        for(int n=0; n<N; n++)
+          full += error[n] * error[n];
+        full /= N;
+        double band = band_power(error, N * BAND_LIMIT / SAMPLE_RATE);
+
+        printf("%7d  %9.1f  %5d  %10.1f dB  %12.1f dB\n",
+               tone_bins[t] * SAMPLE_RATE / N, amplitudes[a], order,
+               10 * log10(signal / full), 10 * log10(signal / band));
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,99 @@
+// Host-side accuracy check for the mixer's sample rate converter
+// (see sound_effects/resample.h).
+//
+// Build it with the host compiler, not the cross compiler:
+//
+//   cc -O2 -I../sound_effects -o resample_check resample_check.c ../sound_effects/resample.c -lm
+//
+// For each asset rate and test tone, a sine wave is quantized to 8
+// bits like the tables in sounds.c and run through the fixed-point
+// resampler. The output is compared with the same linear
+// interpolation done in double precision, which shows the error of
+// the fixed-point arithmetic alone, and with the exact sine at the
+// output times, which also includes the 8-bit and interpolation
+// errors. The tool exits with an error if the fixed-point result is
+// ever more than 1 LSB from the double-precision one.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <resample.h>
+
+#define OUT_RATE    8000
+#define AMPLITUDE   100.0
+#define NUM_BLOCKS  64
+#define NUM_SAMPLES (NUM_BLOCKS * EFFECT_BUFFER_SIZE)
+
+static effect_buffer input[NUM_BLOCKS];
+static int next_block;
+
+static const int8_t *fetch(void *ctx)
+{
+  (void)ctx;
+  if(next_block >= NUM_BLOCKS)
+    return NULL;
+  return input[next_block++].data;
+}
+
+static double snr_db(double signal, double noise)
+{
+  return noise > 0 ? 10 * log10(signal / noise) : INFINITY;
+}
+
+int main()
+{
+  static const int in_rates[] = {8000, 11025, 16000, 22050};
+  static const double tones[] = {250, 1000, 3000};
+  static int8_t out[EFFECT_BUFFER_SIZE];
+  int failed = 0;
+
+  printf("in rate   tone  fixed vs double  max err  vs exact sine\n");
+
+  for(unsigned r=0; r<sizeof(in_rates)/sizeof(in_rates[0]); r++){
+    int in_rate = in_rates[r];
+    for(unsigned t=0; t<sizeof(tones)/sizeof(tones[0]); t++){
+      double f = tones[t];
+      double signal = 0, noise_fixed = 0, noise_exact = 0;
+      int max_err = 0;
+      resampler_t rs;
+      // the resampler steps in 16.16 fixed point, so the double
+      // reference uses the same rounded ratio
+      double step = (double)(((uint32_t)in_rate << 16) / OUT_RATE) / 65536.0;
+      long n = 0;
+
+      for(int i=0; i<NUM_SAMPLES; i++)
+        input[i / EFFECT_BUFFER_SIZE].data[i % EFFECT_BUFFER_SIZE] =
+          (int8_t)lrint(AMPLITUDE * sin(2 * M_PI * f * i / in_rate));
+      next_block = 0;
+      resampler_init(&rs, in_rate, OUT_RATE, fetch, NULL);
+
+      while(resample_block(&rs, out)){
+        for(int i=0; i<EFFECT_BUFFER_SIZE; i++, n++){
+          double pos = n * step;
+          long k = (long)pos;
+          double ref, exact;
+          if(k + 1 >= NUM_SAMPLES)
+            break;
+          ref = input[k / EFFECT_BUFFER_SIZE].data[k % EFFECT_BUFFER_SIZE] +
+                (pos - k) * (input[(k+1) / EFFECT_BUFFER_SIZE].data[(k+1) % EFFECT_BUFFER_SIZE] -
+                             input[k / EFFECT_BUFFER_SIZE].data[k % EFFECT_BUFFER_SIZE]);
+          exact = AMPLITUDE * sin(2 * M_PI * f * pos / in_rate);
+          signal += exact * exact;
+          noise_fixed += (out[i] - ref) * (out[i] - ref);
+          noise_exact += (out[i] - exact) * (out[i] - exact);
+          if(abs(out[i] - (int)lrint(ref)) > max_err)
+            max_err = abs(out[i] - (int)lrint(ref));
+        }
+      }
+
+      printf("%7d  %5.0f  %12.1f dB  %7d  %10.1f dB\n", in_rate, f,
+             snr_db(signal, noise_fixed), max_err, snr_db(signal, noise_exact));
+      if(max_err > 1)
+        failed = 1;
+    }
+  }
+
+  if(failed)
+    printf("FAILED: fixed-point output is more than 1 LSB from the reference\n");
+  return failed;
+}
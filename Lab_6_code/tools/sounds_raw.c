@@ -0,0 +1,55 @@
+// Host-side tool that writes the sound effects in sounds.c out as raw
+// signed 8-bit samples, the input that adpcm_convert takes with -r8.
+//
+// Build it with the host compiler, not the cross compiler:
+//
+//   cc -O2 -I../sound_effects -o sounds_raw sounds_raw.c ../sound_effects/sounds.c
+//
+// Run it in an empty directory; it writes name.raw for every effect.
+// The compressed effects in sound_effects were made from these with
+//
+//   adpcm_convert -r8 explosion1.raw explosion1_adpcm
+//
+// and likewise for invaderkilled, shoot and ufo_lowpitch. The mixer
+// plays the compressed tables, and the linker drops the unused 8-bit
+// ones from the image.
+
+#include <stdio.h>
+#include <sounds.h>
+
+typedef struct{
+  const char *name;
+  const effect_buffer *buffers;
+  int num_buffers;
+}sound_t;
+
+static const sound_t sounds[] = {
+  {"explosion1", explosion1, NUM_explosion1_BUFFERS},
+  {"fastinvader1", fastinvader1, NUM_fastinvader1_BUFFERS},
+  {"fastinvader2", fastinvader2, NUM_fastinvader2_BUFFERS},
+  {"fastinvader3", fastinvader3, NUM_fastinvader3_BUFFERS},
+  {"fastinvader4", fastinvader4, NUM_fastinvader4_BUFFERS},
+  {"invaderkilled", invaderkilled, NUM_invaderkilled_BUFFERS},
+  {"shoot", shoot, NUM_shoot_BUFFERS},
+  {"ufo_highpitch", ufo_highpitch, NUM_ufo_highpitch_BUFFERS},
+  {"ufo_lowpitch", ufo_lowpitch, NUM_ufo_lowpitch_BUFFERS}
+};
+
+int main(void)
+{
+  char path[64];
+  FILE *f;
+
+  for(int i=0; i<sizeof(sounds)/sizeof(sounds[0]); i++){
+    snprintf(path, sizeof(path), "%s.raw", sounds[i].name);
+    f = fopen(path, "wb");
+    if(f == NULL){
+      perror(path);
+      return 1;
+    }
+    fwrite(sounds[i].buffers, sizeof(effect_buffer), sounds[i].num_buffers, f);
+    fclose(f);
+    printf("%s: %d samples\n", path, sounds[i].num_buffers * EFFECT_BUFFER_SIZE);
+  }
+  return 0;
+}
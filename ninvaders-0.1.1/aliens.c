@@ -24,32 +24,26 @@
  
 #include "aliens.h"
 #include "player.h"
-#include "nInvaders.h"
-#include <sound_effects.h>
+#include "game.h"
+#include "sound.h"
 Aliens aliens;
 int shipnum;	
 int lowest_ship[ALIENS_MAX_NUMBER_X];
 int alienshotx[ALIENS_MAX_MISSILES];
 int alienshoty[ALIENS_MAX_MISSILES];
 int alienshotnum;
-int alienBlock[ALIENS_MAX_NUMBER_Y][ALIENS_MAX_NUMBER_X];
-int bunker[BUNKERHEIGHT][BUNKERWIDTH + 1];	
+AlienBoard alienBoard;
+uint32_t bunker[BUNKERHEIGHT][BUNKER_WORDS];	
 
 /**
  * initialize aliens attributes
  */
 void aliensReset()
 {
-	int i,j;
+	int i;
 	
-	// three different types of aliens [5], [10]
-	int level[ALIENS_MAX_NUMBER_Y][ALIENS_MAX_NUMBER_X]={
-		{1,1,1,1,1,1,1,1,1,1},
-		{2,2,2,2,2,2,2,2,2,2},
-		{2,2,2,2,2,2,2,2,2,2},
-		{3,3,3,3,3,3,3,3,3,3},
-		{3,3,3,3,3,3,3,3,3,3}
-	};
+	// three different types of aliens, one type per row [5]
+	int level[ALIENS_MAX_NUMBER_Y]={1,2,2,3,3};
 
 	aliensClear(aliens.posX, aliens.posY, aliens.right, aliens.bottom);	// clear old position of aliens
 	
@@ -61,12 +55,8 @@ void aliensReset()
 	aliens.left = 0;
 	aliens.speed = 1;
 	
-	// copy level-array to enemy-array 
-	for (i=0;i<ALIENS_MAX_NUMBER_X;i++) {
-		for (j=0;j<ALIENS_MAX_NUMBER_Y;j++) {
-			alienBlock[j][i]=level[j][i];
-		}
-	}
+	// fill enemy-bitboard from level-array 
+	alienBoardFill(&alienBoard, level);
 	
 	// reset missiles
 	for (i = 0; i < ALIENS_MAX_MISSILES; i++) {
@@ -100,13 +90,14 @@ void bunkersReset()
 	//       12345678901234567890123456789012345678901234567890123456789012345678901234567890
 	// 80 characters wide
 
-	// copy graphical "bunkerd" to binary "bunker"
-	for (a = 0; a < BUNKERWIDTH; a++) {
-		for (b = 0; b < BUNKERHEIGHT; b++) {
+	// copy graphical "bunkerd" to bitboard "bunker"
+	for (b = 0; b < BUNKERHEIGHT; b++) {
+		for (a = 0; a < BUNKER_WORDS; a++) {
+			bunker[b][a] = 0;
+		}
+		for (a = 0; a < BUNKERWIDTH; a++) {
 			if (bunkerd[b][a] == '#')
-				bunker[b][a] = 1;
-			else
-				bunker[b][a] = 0;
+				bitboardSet(bunker[b], a);
 		}
 	}
 	
@@ -142,7 +133,7 @@ int aliensMove()
 		// aliens reached bunkers //funzt nicht ganz: todo
 		if (aliens.posY == BUNKERY - aliens.bottom) {
 			// clear bunkers
-			for(cx=0;cx<BUNKERWIDTH;cx++) {
+			for(cx=0;cx<BUNKER_WORDS;cx++) {
 				for(cy=0;cy<BUNKERHEIGHT;cy++) { 
 					bunker[cy][cx]=0;	
 				}
@@ -154,13 +145,13 @@ int aliensMove()
 	}
 
 	if(aliens.posY % 4 == 0)
-		xEventGroupSetBits(effect_events, FASTINVADER1_EVENT);
+		soundPlay(SOUND_MARCH1);
 	else if (aliens.posY % 4 == 1)
-		xEventGroupSetBits(effect_events, FASTINVADER2_EVENT);
+		soundPlay(SOUND_MARCH2);
 	else if (aliens.posY % 4 == 2)
-		xEventGroupSetBits(effect_events, FASTINVADER3_EVENT);
+		soundPlay(SOUND_MARCH3);
 	else
-		xEventGroupSetBits(effect_events, FASTINVADER4_EVENT);
+		soundPlay(SOUND_MARCH4);
 
 	aliensDisplay(aliens.posX, aliens.posY, aliens.right, aliens.bottom); // display aliens at new position
 	
@@ -174,38 +165,27 @@ int aliensMove()
 void render()
 {
 	int k,row;
-	int c=0;
 
-	// calculate left, right, bottom, lowest_ship	
-	aliens.left=1;
-	aliens.right=-1;
-	aliens.bottom=-1;
-	shipnum=0;
-	for (k=0;k<10;k++) {
-		lowest_ship[k]=-1;
+	// calculate left, right, bottom, lowest_ship from the bitboard
+	shipnum=alienBoard.count;
+	for (k=0;k<ALIENS_MAX_NUMBER_X;k++) {
+		row=alienBoardLowest(&alienBoard, k);
+		lowest_ship[k]=(row == -1) ? -1 : row*2;	// every 2nd row is an empty row
 	}
-	
-	for (row=0;row<ALIENS_MAX_NUMBER_Y*2;row++) {
-		if ((row%2)==0){
-			for (k=0;k<ALIENS_MAX_NUMBER_X;k++) {
-				if (alienBlock[c][k] != 0) {
-					lowest_ship[k]=row;
-					shipnum++;
-					if (aliens.left==1 || -k>aliens.left) {aliens.left=-k;}
-					if (aliens.right==-1 || k>aliens.right) {aliens.right=k;}
-					if (aliens.bottom==-1 || c>aliens.bottom) {aliens.bottom=c;}
-				} 
-			}
-		} else {
-			c++;
-		}
+
+	if (shipnum > 0) {
+		aliens.left=-alienBoardLeft(&alienBoard)*3;	// alien sprite is 3 chars wide
+		aliens.right=alienBoardRight(&alienBoard)*3;	// alien sprite is 3 chars wide
+		aliens.bottom=alienBoardBottom(&alienBoard)*2;	// every 2nd row is an empty row
+	} else {
+		// no aliens left: same values as an empty scan gave
+		aliens.left=3;
+		aliens.right=-3;
+		aliens.bottom=-2;
 	}
-	aliens.bottom=aliens.bottom*2;	// every 2nd row is an empty row
-	aliens.left=aliens.left*3; // alien sprite is 3 chars wide
-	aliens.right=aliens.right*3; // alien sprite is 3 chars wide
 	
 	// display remaining aliens with animation
-	aliensRefresh(level, &alienBlock[0][0]);
+	aliensRefresh(game.level, &alienBoard);
 
 }
 
@@ -224,7 +204,7 @@ int aliensMissileMove()
 	
 	// calculate threshold when next missile should be fired
 	// it is done here to save calculation time in for-instruction 
-	shootThreshold = (skill_level * 8) * (shipnum + 2);
+	shootThreshold = (game.skillLevel * 8) * (shipnum + 2);
 	alienshot_counter = alienshot_counter + 10 ;
 	
 	// loop all possible missiles
@@ -238,7 +218,7 @@ int aliensMissileMove()
 			// if missile hit the bunkers	
 			if (bunkersHitCheck(alienshotx[i], alienshoty[i]) == 1) {
 				alienshotx[i] = 0;		// value of zero reloads missile
-				xEventGroupSetBits(effect_events, EXPLOSION1_EVENT);
+				soundPlay(SOUND_EXPLOSION);
 			}
 			
 			alienshoty[i]++;			// move missile downwards
@@ -247,7 +227,7 @@ int aliensMissileMove()
 			if (playerHitCheck(alienshotx[i], alienshoty[i]) == 1) {
 				alienshotx[i] = 0;		// value of zero reloads missile
 				fPlayerWasHit = 1;
-				xEventGroupSetBits(effect_events, EXPLOSION1_EVENT);
+				soundPlay(SOUND_EXPLOSION);
 			}
 			
 			
@@ -256,13 +236,13 @@ int aliensMissileMove()
 			// start new missile if counter says so
 			if (alienshot_counter > shootThreshold && shipnum > 0) {// only shot if there's an alien left
 				alienshot_counter = 0;				// reset counter				
-				tmp = random() % ALIENS_MAX_NUMBER_X;  		// randomly select one of the ...
+				tmp = gameRandom() % ALIENS_MAX_NUMBER_X;  		// randomly select one of the ...
 				while (lowest_ship[tmp] == -1) {		// ...aliens at the bottom of ...
-					tmp = random() % ALIENS_MAX_NUMBER_X;	// ...a column to launch missile
+					tmp = gameRandom() % ALIENS_MAX_NUMBER_X;	// ...a column to launch missile
 				}
 				alienshoty[i]=aliens.posY+lowest_ship[tmp];		// set y position of missile
 				alienshotx[i]=aliens.posX+tmp*3;			// set x position of missile
-				xEventGroupSetBits(effect_events, SHOOT_EVENT);
+				soundPlay(SOUND_SHOOT);
 			}
 		} // if 
 		
@@ -298,10 +278,9 @@ int aliensHitCheck(int shotx, int shoty)
 		shipx = (shotx - aliens.posX) / 3;
 		shipy = (shoty - aliens.posY) / 2;
 		// if there is still a ship at this position
-		alienType = alienBlock[shipy][shipx];
+		alienType = alienBoardKill(&alienBoard, shipx, shipy);	// delete alien ship
 		if (alienType != 0) {
-			alienBlock[shipy][shipx] = 0;	// delete alien ship
-			xEventGroupSetBits(effect_events, INVADERKILLED_EVENT);
+			soundPlay(SOUND_INVADER_KILLED);
 		}
 	}
 	return alienType; 	// returns 0 if no alien was hit, else returns type-code of alien
@@ -321,8 +300,8 @@ int bunkersHitCheck(int shotx, int shoty)
 		adjy = shoty - BUNKERY; 
 		adjx = shotx - BUNKERX;
 		// if there is still an element
-		if(bunker[adjy][adjx] == 1){
-			bunker[adjy][adjx] = 0;	// delete element
+		if(bitboardTest(bunker[adjy], adjx)){
+			bitboardClear(bunker[adjy], adjx);	// delete element
 			fBunkerWasHit = 1; 		// bunker was hit!
 		}
 	}
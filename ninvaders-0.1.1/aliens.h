@@ -42,8 +42,6 @@ extern Aliens aliens;
 		
 extern int shipnum;	
 
-#define ALIENS_MAX_NUMBER_X 10
-#define ALIENS_MAX_NUMBER_Y 5	
 #define ALIENS_MAX_MISSILES 10	
 
 // todo: move to structure
@@ -51,9 +49,9 @@ extern int lowest_ship[ALIENS_MAX_NUMBER_X];
 extern int alienshotx[ALIENS_MAX_MISSILES];
 extern int alienshoty[ALIENS_MAX_MISSILES];
 extern int alienshotnum;
-extern int alienBlock[ALIENS_MAX_NUMBER_Y][ALIENS_MAX_NUMBER_X];
+extern AlienBoard alienBoard;
 
-extern int bunker[BUNKERHEIGHT][BUNKERWIDTH + 1];	
+extern uint32_t bunker[BUNKERHEIGHT][BUNKER_WORDS];	
 
 
 void aliensReset();
@@ -68,7 +66,7 @@ int bunkersHitCheck(int shotx, int shoty);
 // methods that handle graphic display, from view.c
 extern void aliensDisplay(int x, int y, int wid, int hgt);
 extern void aliensClear(int x, int y, int wid, int hgt);
-extern void aliensRefresh(int level, int *pAliens);
+extern void aliensRefresh(int level, AlienBoard *board);
 extern void aliensMissileDisplay(int x, int y);
 extern void aliensMissileClear(int x, int y);
 extern void bunkersClearElement(int x, int y);
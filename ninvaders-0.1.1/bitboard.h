@@ -0,0 +1,134 @@
+#ifndef BITBOARD
+#define BITBOARD
+
+#include <stdint.h>
+
+/**
+ * Packed bitboards for the alien block and the bunkers.
+ *
+ * The alien block is kept as one bit mask per column and one per row,
+ * plus a mask of the columns and rows that still have aliens in them.
+ * A kill clears two bits and, if a column or row became empty, one bit
+ * in the summary masks, so the block's extents and each column's
+ * lowest alien are found with a single CLZ/CTZ instead of a scan.
+ *
+ * The bunkers are kept as rows of 32 bit words, one bit per character.
+ */
+
+#define ALIENS_MAX_NUMBER_X 10
+#define ALIENS_MAX_NUMBER_Y 5
+
+typedef struct AlienBoard AlienBoard;
+
+struct AlienBoard {
+	uint8_t columns[ALIENS_MAX_NUMBER_X];	// bit y: alien in row y of this column
+	uint16_t rows[ALIENS_MAX_NUMBER_Y];	// bit x: alien in column x of this row
+	uint16_t columnMask;			// bit x: column x is not empty
+	uint8_t rowMask;			// bit y: row y is not empty
+	uint8_t type[ALIENS_MAX_NUMBER_Y];	// alien type of each row
+	int count;				// aliens left
+};
+
+
+/**
+ * fill the block with one type of alien per row
+ */
+static inline void alienBoardFill(AlienBoard *board, const int *rowType)
+{
+	int x, y;
+
+	for (x = 0; x < ALIENS_MAX_NUMBER_X; x++) {
+		board->columns[x] = (1 << ALIENS_MAX_NUMBER_Y) - 1;
+	}
+	for (y = 0; y < ALIENS_MAX_NUMBER_Y; y++) {
+		board->rows[y] = (1 << ALIENS_MAX_NUMBER_X) - 1;
+		board->type[y] = rowType[y];
+	}
+	board->columnMask = (1 << ALIENS_MAX_NUMBER_X) - 1;
+	board->rowMask = (1 << ALIENS_MAX_NUMBER_Y) - 1;
+	board->count = ALIENS_MAX_NUMBER_X * ALIENS_MAX_NUMBER_Y;
+}
+
+
+/**
+ * type of the alien at column x, row y, or 0 if there is none
+ */
+static inline int alienBoardType(const AlienBoard *board, int x, int y)
+{
+	return (board->rows[y] >> x) & 1 ? board->type[y] : 0;
+}
+
+
+/**
+ * remove the alien at column x, row y
+ * returns its type, or 0 if there was none
+ */
+static inline int alienBoardKill(AlienBoard *board, int x, int y)
+{
+	int alienType = alienBoardType(board, x, y);
+
+	if (alienType != 0) {
+		board->columns[x] &= ~(1 << y);
+		board->rows[y] &= ~(1 << x);
+		if (board->columns[x] == 0) {
+			board->columnMask &= ~(1 << x);
+		}
+		if (board->rows[y] == 0) {
+			board->rowMask &= ~(1 << y);
+		}
+		board->count--;
+	}
+	return alienType;
+}
+
+
+/**
+ * leftmost, rightmost and lowest non-empty column/row
+ * only valid while count > 0
+ */
+static inline int alienBoardLeft(const AlienBoard *board)
+{
+	return __builtin_ctz(board->columnMask);
+}
+
+static inline int alienBoardRight(const AlienBoard *board)
+{
+	return 31 - __builtin_clz(board->columnMask);
+}
+
+static inline int alienBoardBottom(const AlienBoard *board)
+{
+	return 31 - __builtin_clz(board->rowMask);
+}
+
+
+/**
+ * lowest row with an alien in column x, or -1 if the column is empty
+ */
+static inline int alienBoardLowest(const AlienBoard *board, int x)
+{
+	return board->columns[x] ? 31 - __builtin_clz(board->columns[x]) : -1;
+}
+
+
+/**
+ * words needed for one bitboard row of the given width
+ */
+#define BITBOARD_WORDS(width) (((width) + 31) / 32)
+
+static inline int bitboardTest(const uint32_t *row, int x)
+{
+	return (row[x >> 5] >> (x & 31)) & 1;
+}
+
+static inline void bitboardSet(uint32_t *row, int x)
+{
+	row[x >> 5] |= 1u << (x & 31);
+}
+
+static inline void bitboardClear(uint32_t *row, int x)
+{
+	row[x >> 5] &= ~(1u << (x & 31));
+}
+
+#endif
@@ -0,0 +1,304 @@
+/**
+ * nInvaders - a space invaders clone for ncurses
+ * Copyright (C) 2002-2003 Dettus
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ * homepage: http://ninvaders.sourceforge.net
+ * mailto: ninvaders-devel@lists.sourceforge.net
+ *
+ */
+
+
+#include "game.h"
+#include "player.h"
+#include "aliens.h"
+#include "ufo.h"
+#include "sound.h"
+#include "profile.h"
+
+Game game;
+
+
+/**
+ * seed the random number generator
+ */
+static void seedRandom(uint32_t seed)
+{
+	game.random = seed * 2654435761u;	// spread the bits of small seeds
+	if (game.random == 0) {
+		game.random = 1;		// xorshift must not start at zero
+	}
+}
+
+
+/**
+ * random number between 0 and 2^31-1, like random()
+ */
+int gameRandom()
+{
+	uint32_t x = game.random;	// xorshift32
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	game.random = x;
+	return x >> 1;
+}
+
+
+/**
+ * initialize level: reset attributes of most units
+ */
+static void initLevel()
+{
+	playerReset();
+	aliensReset();
+	ufoReset();
+	bunkersReset();
+	render();
+}
+
+
+/**
+ * set up a new game, waiting at the title screen
+ */
+void gameInit(int skillLevel, uint32_t seed)
+{
+	game.status = GAME_HIGHSCORE;
+	game.lives = 3;
+	game.score = 0;
+	game.level = 0;
+	game.skillLevel = skillLevel;
+	game.weite = 0;
+	game.titleFrame = 0;
+	game.lastMove = ' ';
+	game.aliensMoveCounter = 0;
+	game.aliensShotCounter = 0;
+	game.playerShotCounter = 0;
+	game.ufoMoveCounter = 0;
+	game.titleAnimationCounter = 0;
+	game.gameOverCounter = 0;
+	game.statusAfterExplosion = GAME_LOOP;
+	game.frame = 0;
+	game.seed = seed;
+	seedRandom(seed);
+}
+
+
+/**
+ * handle a key pressed by the player
+ * GAME_NO_KEY tells the game that no key is held down
+ */
+void gameInput(int ch)
+{
+	switch (game.status) {
+
+	case GAME_PAUSED:
+
+		if (ch == 'p') {
+			game.status = GAME_LOOP;
+		}
+		break;
+		       
+	case GAME_HIGHSCORE:
+
+		if (ch == ' ') {
+			// every game gets its own numbers: the time spent on
+			// the title screen is part of the seed
+			seedRandom(game.seed + game.frame);
+			titleScreenClear();
+			game.level = 0;      // reset level
+			game.score = 0;      // reset score
+			game.lives = 3;      // restore lives
+			game.status = GAME_NEXTLEVEL;
+		} 
+		//else if (ch == 'q') {	// quit game
+		//	game.status = GAME_EXIT;
+		// }
+		break;
+
+	case GAME_OVER:
+		// soundPlay(SOUND_PAUSE);
+		break; // don't do anything
+
+	case GAME_PLAYER_EXPLODING:
+		break; // wait for the explosion to finish
+
+	default:
+
+		if (ch == 'l' || ch == KEY_RIGHT) {	// move player rightk
+			if (game.lastMove == 'l') {
+				playerTurboOn();	// enable Turbo
+			} else {
+				playerTurboOff();	// disable Turbo
+			}
+			playerMoveRight();		// move player
+			game.lastMove = 'l';		// remember last move for turbo mode
+		} else if (ch == 'h' || ch == KEY_LEFT) {	// move player left 
+			if (game.lastMove == 'h') {
+				playerTurboOn();	// enable Turbo
+			} else {
+				playerTurboOff();	// disable Turbo
+			}
+			playerMoveLeft();		// move player
+			game.lastMove = 'h';		// remember last move for turbo mode
+		} else if (ch == 'k' || ch == ' ') {	// shoot missile
+			playerLaunchMissile();
+		} else if (ch == 'p') {			// pause game until 'p' pressed again
+			soundPlay(SOUND_PAUSE);
+			// set status to game paused
+			game.status = GAME_PAUSED;
+		} else if (ch == 'W') {			// cheat: goto next level
+			game.status = GAME_NEXTLEVEL;
+		} else if (ch == 'L') {			// cheat: one more live
+			game.lives++;
+		} else if (ch == 'q') {	// quit game
+			game.status = GAME_EXIT;
+		} else {		// disable turbo mode if key is not kept pressed
+			game.lastMove = ' ';
+		}
+
+	} // switch
+}
+
+
+/**
+ * physics
+ * advance the game by one frame, after handling key (or GAME_NO_KEY
+ * if no key was pressed in this frame)
+ */
+void gameStep(int key)
+{
+	if (key != GAME_NO_KEY) {
+		gameInput(key);
+	}
+
+	switch (game.status) {
+		 
+	case GAME_NEXTLEVEL:    // go to next level
+		
+		game.level++;	// increase level
+
+		initLevel();	// initialize level
+		
+		game.aliensMoveCounter = 0; 
+		game.aliensShotCounter = 0;
+		game.playerShotCounter = 0;
+		game.ufoMoveCounter = 0;
+		
+		game.weite = (shipnum+(game.skillLevel*10)-(game.level*5)+5)/10;
+		
+		if (game.weite < 0) {
+			game.weite = 0;
+		}
+		
+		// change status and start game!
+		game.status = GAME_LOOP;
+
+	case GAME_LOOP:   	 // do game handling
+		
+		// move aliens			
+		if (game.aliensMoveCounter == 0) {
+			PROFILE_SCOPE(PROFILE_ALIENS_MOVE);
+			if (aliensMove() == 1) {
+				// aliens reached player
+				game.lives = 0;
+				game.status = GAME_OVER;
+			}
+		}
+		
+		// move player missile			
+		if (game.playerShotCounter == 0) {
+			PROFILE_SCOPE(PROFILE_PLAYER_MISSILE);
+			if (playerMoveMissile() == 1) {
+				// no aliens left
+				game.status = GAME_NEXTLEVEL;
+			}
+		}
+		
+		// move aliens' missiles
+		if (game.aliensShotCounter == 0) {
+			PROFILE_SCOPE(PROFILE_ALIENS_MISSILE);
+			if (aliensMissileMove() == 1) {
+				// player was hit
+				game.lives--;			// player looses one life
+				playerExplode();		// start the explosion graphics
+				if (game.lives == 0) {		// if no lives left ...
+					game.status = GAME_OVER;	// ... exit game
+				}
+				// hold the game until the explosion is over
+				game.statusAfterExplosion = game.status;
+				game.status = GAME_PLAYER_EXPLODING;
+			}
+		}
+		
+		// move ufo
+		if (game.ufoMoveCounter == 0 && ufoShowUfo() == 1) {
+			PROFILE_SCOPE(PROFILE_UFO);
+			ufoMoveLeft();			// move it one position to the left
+		}
+		
+		
+		if (game.aliensShotCounter++ >= 5) {game.aliensShotCounter=0;}     // speed of alien shot
+		if (game.playerShotCounter++ >= 1) {game.playerShotCounter=0;}     // speed of player shot
+		if (game.aliensMoveCounter++ >= game.weite) {game.aliensMoveCounter=0;} // speed of aliend
+		if (game.ufoMoveCounter++ >= 3) {game.ufoMoveCounter=0;}           // speed of ufo
+		break;
+		
+	case GAME_PAUSED:    // game is paused
+		break;
+
+	case GAME_PLAYER_EXPLODING:	// player was hit
+		if (playerExplosionStep() == 0) {
+			game.status = game.statusAfterExplosion;
+		}
+		break;
+		
+	case GAME_OVER:      // game over
+		if (game.gameOverCounter == 100) {
+			battleFieldClear();
+			game.status = GAME_HIGHSCORE;
+			game.gameOverCounter = 0;
+		} else {
+			game.gameOverCounter++;	// the banner is drawn by the renderer
+		}
+		break;
+		
+	case GAME_HIGHSCORE: // display highscore
+		if (game.titleAnimationCounter == 0) {
+			game.titleFrame++;	// time for the next title frame
+		}
+
+		if (game.titleAnimationCounter++ >= 6) {game.titleAnimationCounter = 0;} // speed of animation
+		break;
+		
+	}
+
+	game.frame++;
+}
+
+
+void doScoring(int alienType)
+{
+	int points[4] = {500, 200, 150, 100};   	// 0: ufo, 1:red, 2:green, 3:blue
+	
+	game.score += points[alienType];	// every alien type does different scoring points
+	
+	// every 6000 pts player gets a new live
+	if (game.score % 6000 == 0){
+		game.lives++;
+	}
+}
@@ -0,0 +1,93 @@
+/**
+ * nInvaders - a space invaders clone for ncurses
+ * Copyright (C) 2002-2003 Dettus
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ * homepage: http://ninvaders.sourceforge.net
+ * mailto: ninvaders-devel@lists.sourceforge.net
+ *
+ */
+
+
+#ifndef GAME
+#define GAME
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "view.h"
+
+/**
+ * The simulation core: the rules of the game, without any timing,
+ * input device or terminal. The state of the game lives in one struct
+ * (the sprite modules keep theirs in aliens, player and ufo), output
+ * goes through the renderer in view.h and the sounds in sound.h, and
+ * time only moves when gameStep() is called. The game draws its random
+ * numbers from its own generator, so a game is fully determined by the
+ * seed and the keys given in each frame (see record.h). nInvaders.c
+ * drives it on the target; the host benchmark drives it with a null
+ * renderer.
+ */
+
+#define GAME_LOOP 1
+#define GAME_NEXTLEVEL 2
+#define GAME_PAUSED 3
+#define GAME_OVER 4
+#define GAME_EXIT 5
+#define GAME_HIGHSCORE 6
+#define GAME_PLAYER_EXPLODING 7
+
+#define GAME_NO_KEY ERR		// no key pressed in this step
+
+#define UFO_ALIEN_TYPE   0
+#define RED_ALIEN_TYPE   1
+#define GREEN_ALIEN_TYPE 2
+#define BLUE_ALIEN_TYPE  3 
+
+typedef struct Game Game;
+
+struct Game {
+	int status;		// GAME_LOOP, GAME_PAUSED, ...
+	int lives;
+	long score;
+	int level;
+	int skillLevel;
+	int weite;		// steps between two moves of the aliens
+	int titleFrame;		// counts the frames of the title animation
+	int lastMove;		// last move key, for turbo mode
+	uint32_t frame;		// steps since gameInit()
+	uint32_t seed;
+	uint32_t random;	// state of the random number generator
+
+	// step counters
+	int aliensMoveCounter;
+	int aliensShotCounter;
+	int playerShotCounter;
+	int ufoMoveCounter;
+	int titleAnimationCounter;
+	int gameOverCounter;
+	int statusAfterExplosion;
+};
+
+extern Game game;
+
+void gameInit(int skillLevel, uint32_t seed);
+void gameInput(int key);
+void gameStep(int key);
+int gameRandom();
+
+void doScoring(int alienType);
+
+#endif
@@ -0,0 +1,99 @@
+#include "governor.h"
+#include "nInvaders.h"
+
+#define GAME_BAUD 57600
+#define BYTES_PER_SECOND (GAME_BAUD / 10)	// start + 8 data + stop bits
+
+#define CREDIT_MAX_FRAMES 2	// unused credit that may be saved up, in frames
+#define TX_BACKLOG_LIMIT 256	// never queue more than this in the UART
+
+static int fps;
+static int budget;		// bytes the link carries per tick
+static int credit;		// bytes the game may still send
+static uint32_t lastCount;	// UART transmit count at the last tick
+
+// counts for the current second
+static int ticks;
+static int frames;
+static int bytes;
+static int deferred;
+
+static GovernorStats stats;
+
+/**
+ * set the frame rate the game ticks at
+ */
+void governorInit(int framesPerSecond)
+{
+	fps = framesPerSecond;
+	budget = BYTES_PER_SECOND / fps;
+	credit = budget;
+	lastCount = UART_16550_tx_count(GAME_UART);
+	ticks = frames = bytes = deferred = 0;
+}
+
+
+/**
+ * called at the start of every tick: pay for what was sent during the
+ * last one, and earn the budget for this one
+ */
+void governorTick()
+{
+	uint32_t count = UART_16550_tx_count(GAME_UART);
+	int sent = count - lastCount;
+
+	lastCount = count;
+	credit += budget - sent;
+	if (credit > CREDIT_MAX_FRAMES * budget) {
+		credit = CREDIT_MAX_FRAMES * budget;
+	}
+
+	bytes += sent;
+	if (++ticks >= fps) {
+		stats.framesPerSecond = frames;
+		stats.bytesPerFrame = frames ? bytes / frames : 0;
+		stats.bytesPerSecond = bytes;
+		stats.deferred = deferred;
+		ticks = frames = bytes = deferred = 0;
+	}
+}
+
+
+/**
+ * check if a frame may be sent this tick
+ */
+int governorFrameDue()
+{
+	return credit > 0 && UART_16550_tx_pending(GAME_UART) < TX_BACKLOG_LIMIT;
+}
+
+
+/**
+ * count a frame that was sent
+ */
+void governorFrameSent()
+{
+	frames++;
+}
+
+
+/**
+ * check if a low priority update may be drawn now
+ */
+int governorAllowLowPriority()
+{
+	if (credit >= budget) {
+		return 1;
+	}
+	deferred++;
+	return 0;
+}
+
+
+/**
+ * copy the statistics for the last full second
+ */
+void governorGetStats(GovernorStats *out)
+{
+	*out = stats;
+}
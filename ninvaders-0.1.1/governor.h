@@ -0,0 +1,29 @@
+#ifndef GOVERNOR
+#define GOVERNOR
+
+/**
+ * The frame governor keeps the game's terminal output within what the
+ * UART can carry. Every tick earns the game the number of bytes the
+ * link moves in one frame time, and every byte sent is paid for. Frames
+ * are skipped while the game is in debt, so the frame rate drops by
+ * itself when the screen gets busy, and low priority updates (score,
+ * title animation) wait until there is a whole frame of headroom.
+ */
+
+typedef struct GovernorStats GovernorStats;
+
+struct GovernorStats {
+	int framesPerSecond;	// frames sent to the terminal in the last second
+	int bytesPerFrame;	// average over the last second
+	int bytesPerSecond;
+	int deferred;		// low priority updates put off in the last second
+};
+
+void governorInit(int fps);
+void governorTick();
+int governorFrameDue();
+void governorFrameSent();
+int governorAllowLowPriority();
+void governorGetStats(GovernorStats *stats);
+
+#endif
@@ -0,0 +1,87 @@
+#include <string.h>
+#include "highscore.h"
+
+static KvStore store;
+static int storeOpen;
+static HighScoreTable table;
+
+
+/**
+ * open the store and read the table from it
+ */
+int highscoreInit(const KvMedium *medium)
+{
+	memset(&table, 0, sizeof(table));
+	storeOpen = kvOpen(&store, medium) == 0;
+	if (!storeOpen) {
+		return -1;
+	}
+	if (kvGet(&store, HIGHSCORE_KEY, &table, sizeof(table)) != sizeof(table) ||
+	    table.count > HIGHSCORE_ENTRIES) {
+		memset(&table, 0, sizeof(table));	// none yet, or an older layout
+	}
+	return 0;
+}
+
+
+/**
+ * enter a finished game into the table, and save the table if it made
+ * it
+ */
+int highscoreAdd(long score, int level, int skillLevel)
+{
+	int rank;
+
+	if (score <= 0) {
+		return -1;
+	}
+	// a tie goes below the games that got there first
+	rank = table.count;
+	while (rank > 0 && table.entry[rank - 1].score < (uint32_t)score) {
+		rank--;
+	}
+	if (rank == HIGHSCORE_ENTRIES) {
+		return -1;
+	}
+	if (table.count < HIGHSCORE_ENTRIES) {
+		table.count++;
+	}
+	memmove(&table.entry[rank + 1], &table.entry[rank],
+		(table.count - 1 - rank) * sizeof(HighScore));
+	table.entry[rank].score = score;
+	table.entry[rank].level = level;
+	table.entry[rank].skillLevel = skillLevel;
+
+	if (storeOpen) {
+		kvPut(&store, HIGHSCORE_KEY, &table, sizeof(table));
+	}
+	return rank;
+}
+
+
+const HighScoreTable *highscoreTable()
+{
+	return &table;
+}
+
+
+/**
+ * the rating the original game gave a final score on exit
+ */
+const char *highscoreRating(long score)
+{
+	if (score < 5000) {
+		return "Alien Fodder";
+	} else if (score < 7500) {
+		return "Easy Target";
+	} else if (score < 10000) {
+		return "Barely Mediocre";
+	} else if (score < 12500) {
+		return "Shows Promise";
+	} else if (score < 15000) {
+		return "Alien Blaster";
+	} else if (score < 20000) {
+		return "Earth Defender";
+	}
+	return "Supreme Protector";
+}
@@ -0,0 +1,41 @@
+#ifndef HIGHSCORE
+#define HIGHSCORE
+
+#include <stdint.h>
+#include "kvstore.h"
+
+/**
+ * The ten best games, kept in the key-value store so that they survive
+ * a reset. The whole table is one record: it is written only when a
+ * game makes it into the table, and read from the store's index at
+ * start up.
+ */
+
+#define HIGHSCORE_ENTRIES 10
+#define HIGHSCORE_KEY 1		// key of the table in the store
+
+typedef struct HighScore HighScore;
+
+struct HighScore {
+	uint32_t score;
+	uint16_t level;		// level reached
+	uint16_t skillLevel;
+};
+
+typedef struct HighScoreTable HighScoreTable;
+
+struct HighScoreTable {
+	uint32_t count;		// entries in use, best first
+	HighScore entry[HIGHSCORE_ENTRIES];
+};
+
+// highscoreInit() opens the store on the medium and loads the table; it
+// returns -1 if the store cannot be opened, and the table then lives in
+// RAM only. highscoreAdd() returns the rank (0 is the best) the game got
+// in the table, or -1 if it did not make it.
+int highscoreInit(const KvMedium *medium);
+int highscoreAdd(long score, int level, int skillLevel);
+const HighScoreTable *highscoreTable();
+const char *highscoreRating(long score);
+
+#endif
@@ -0,0 +1,392 @@
+#include <string.h>
+#include "kvstore.h"
+
+#define KV_MAGIC 0x4b565331	// "KVS1"
+#define KV_ERASED 0xffffffff
+#define KV_HEADER_BYTES 8	// magic, sequence
+#define KV_COMMITTED 0
+
+static uint32_t recordBuffer[2 + (KV_MAX_LENGTH + 3) / 4];
+
+
+/**
+ * bytes taken by a record with a value of the given length
+ */
+static uint32_t recordSize(uint32_t length)
+{
+	return 12 + ((length + 3) & ~3u);
+}
+
+static uint32_t readWord(const KvMedium *medium, uint32_t offset)
+{
+	return ((const uint32_t *)medium->base)[offset / 4];
+}
+
+static uint32_t sectorStart(const KvMedium *medium, int sector)
+{
+	return (uint32_t)sector * medium->sectorSize;
+}
+
+/**
+ * FNV-1a over the record's first word and its value
+ */
+static uint32_t checksum(uint32_t word, const uint8_t *value, uint32_t length)
+{
+	uint32_t hash = 2166136261u;
+	uint32_t i;
+
+	for (i = 0; i < 4; i++) {
+		hash = (hash ^ ((word >> (8 * i)) & 0xff)) * 16777619u;
+	}
+	for (i = 0; i < length; i++) {
+		hash = (hash ^ value[i]) * 16777619u;
+	}
+	return hash;
+}
+
+/**
+ * check that a sector is erased from offset to its end
+ */
+static int sectorBlank(const KvMedium *medium, int sector, uint32_t offset)
+{
+	uint32_t start = sectorStart(medium, sector);
+
+	for (; offset < medium->sectorSize; offset += 4) {
+		if (readWord(medium, start + offset) != KV_ERASED) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static void eraseSector(KvStore *store, int sector)
+{
+	store->medium->erase(store->medium, sector);
+	store->stats.erases++;
+}
+
+/**
+ * make an erased sector the head
+ */
+static void startSector(KvStore *store, int sector, uint32_t sequence)
+{
+	// the sequence number first: once the magic is there, it is valid
+	uint32_t header[2] = { KV_ERASED, sequence };
+	uint32_t start = sectorStart(store->medium, sector);
+
+	store->medium->program(store->medium, start + 4, &header[1], 1);
+	header[0] = KV_MAGIC;
+	store->medium->program(store->medium, start, &header[0], 1);
+	store->head = sector;
+	store->sequence = sequence;
+	store->writeOffset = KV_HEADER_BYTES;
+}
+
+
+static int findKey(const KvStore *store, uint16_t key)
+{
+	int k;
+
+	for (k = 0; k < store->keys; k++) {
+		if (store->key[k] == key) {
+			return k;
+		}
+	}
+	return -1;
+}
+
+/**
+ * point the index at the latest record of a key
+ */
+static void indexRecord(KvStore *store, uint16_t key, uint32_t offset)
+{
+	int k = findKey(store, key);
+
+	if (k < 0) {
+		if (store->keys == KV_MAX_KEYS) {
+			return;		// only if the medium was written by a bigger index
+		}
+		k = store->keys++;
+		store->key[k] = key;
+	}
+	store->offset[k] = offset;
+}
+
+static void forgetKey(KvStore *store, int k)
+{
+	store->keys--;
+	store->key[k] = store->key[store->keys];
+	store->offset[k] = store->offset[store->keys];
+}
+
+/**
+ * the sum of the sizes of the latest records of all keys
+ */
+static uint32_t liveBytes(const KvStore *store)
+{
+	uint32_t bytes = 0;
+	int k;
+
+	for (k = 0; k < store->keys; k++) {
+		bytes += recordSize(readWord(store->medium, store->offset[k]) & 0xffff);
+	}
+	return bytes;
+}
+
+
+/**
+ * write a record at the head's write offset, which must have room for it
+ */
+static void appendRecord(KvStore *store, uint16_t key, const void *value, uint32_t length)
+{
+	const KvMedium *medium = store->medium;
+	uint32_t offset = sectorStart(medium, store->head) + store->writeOffset;
+	uint32_t words = (length + 3) / 4;
+	uint32_t commit = KV_COMMITTED;
+
+	recordBuffer[0] = (uint32_t)key << 16 | length;
+	recordBuffer[1] = checksum(recordBuffer[0], value, length);
+	if (words > 0) {
+		recordBuffer[1 + words] = 0;	// padding, if any
+	}
+	memcpy(&recordBuffer[2], value, length);
+
+	medium->program(medium, offset, recordBuffer, 2 + words);
+	medium->program(medium, offset + 8 + words * 4, &commit, 1);
+
+	store->writeOffset += recordSize(length);
+	store->stats.appends++;
+	indexRecord(store, key, offset);
+}
+
+/**
+ * copy the latest records in a sector forward to the head, then erase
+ * it
+ */
+static void retireSector(KvStore *store, int sector)
+{
+	const KvMedium *medium = store->medium;
+	uint32_t start = sectorStart(medium, sector);
+	uint32_t word, length;
+	int k;
+
+	if (sectorBlank(medium, sector, 0)) {
+		return;
+	}
+	for (k = 0; k < store->keys; k++) {
+		if (store->offset[k] < start || store->offset[k] >= start + medium->sectorSize) {
+			continue;
+		}
+		word = readWord(medium, store->offset[k]);
+		length = word & 0xffff;
+		if (store->writeOffset + recordSize(length) > medium->sectorSize) {
+			// cannot happen while kvPut() keeps the live records
+			// within a sector
+			store->stats.lost++;
+			forgetKey(store, k--);
+			continue;
+		}
+		appendRecord(store, word >> 16, medium->base + store->offset[k] + 8, length);
+		store->stats.copies++;
+	}
+	eraseSector(store, sector);
+}
+
+/**
+ * move the head to the erased sector after it, keeping the one after
+ * that erased
+ */
+static void advance(KvStore *store)
+{
+	const KvMedium *medium = store->medium;
+	int next = (store->head + 1) % medium->sectors;
+
+	if (!sectorBlank(medium, next, 0)) {
+		eraseSector(store, next);	// only after a lost record
+	}
+	startSector(store, next, store->sequence + 1);
+	retireSector(store, (next + 1) % medium->sectors);
+}
+
+
+/**
+ * add the records in a sector to the index, and return the offset after
+ * the last one; the sector's size if a damaged record closed it
+ */
+static uint32_t scanSector(KvStore *store, int sector)
+{
+	const KvMedium *medium = store->medium;
+	uint32_t start = sectorStart(medium, sector);
+	uint32_t offset = KV_HEADER_BYTES;
+	uint32_t word, length, size;
+
+	while (offset + recordSize(0) <= medium->sectorSize) {
+		word = readWord(medium, start + offset);
+		if (word == KV_ERASED) {
+			break;		// the end of the log in this sector
+		}
+		length = word & 0xffff;
+		size = recordSize(length);
+		if (length > KV_MAX_LENGTH || offset + size > medium->sectorSize) {
+			store->stats.skipped++;
+			return medium->sectorSize;	// the rest cannot be trusted
+		}
+		if (readWord(medium, start + offset + size - 4) == KV_COMMITTED &&
+		    readWord(medium, start + offset + 4) ==
+		    checksum(word, medium->base + start + offset + 8, length)) {
+			indexRecord(store, word >> 16, start + offset);
+		} else {
+			store->stats.skipped++;
+		}
+		offset += size;
+	}
+	return offset;
+}
+
+/**
+ * open the store on a medium, formatting it if it holds no store
+ */
+int kvOpen(KvStore *store, const KvMedium *medium)
+{
+	uint32_t sequence[KV_MAX_SECTORS];
+	int valid[KV_MAX_SECTORS];
+	uint32_t end = 0;
+	int sector, age, next, head = -1;
+
+	if (medium->sectors < 2 || medium->sectors > KV_MAX_SECTORS ||
+	    medium->sectorSize % 4 != 0 ||
+	    medium->sectorSize < KV_HEADER_BYTES + recordSize(KV_MAX_LENGTH)) {
+		return -1;
+	}
+	memset(store, 0, sizeof(*store));
+	store->medium = medium;
+
+	// the head is the valid sector with the highest sequence number
+	for (sector = 0; sector < medium->sectors; sector++) {
+		valid[sector] = readWord(medium, sectorStart(medium, sector)) == KV_MAGIC;
+		sequence[sector] = readWord(medium, sectorStart(medium, sector) + 4);
+		if (valid[sector] &&
+		    (head < 0 || (int32_t)(sequence[sector] - sequence[head]) > 0)) {
+			head = sector;
+		}
+	}
+	if (head < 0) {
+		for (sector = 0; sector < medium->sectors; sector++) {
+			if (!sectorBlank(medium, sector, 0)) {
+				eraseSector(store, sector);
+			}
+		}
+		startSector(store, 0, 1);
+		return 0;
+	}
+
+	// the sectors behind it in ring order hold older records, as long
+	// as their sequence numbers count down without a gap
+	store->head = head;
+	store->sequence = sequence[head];
+	for (age = medium->sectors - 1; age >= 0; age--) {
+		sector = (head - age + medium->sectors) % medium->sectors;
+		if (valid[sector] && sequence[sector] == store->sequence - age) {
+			end = scanSector(store, sector);
+		}
+	}
+
+	// a write cut short may have left bits programmed after the last
+	// record; close the head then, rather than program over them
+	store->writeOffset = end;
+	if (!sectorBlank(medium, head, end)) {
+		store->writeOffset = medium->sectorSize;
+	}
+
+	// a move to a new head that was cut short: if it was cut while
+	// the oldest sector's records were copied, and a copy got damaged,
+	// the new head holds nothing that the oldest sector does not, so
+	// it is erased and the move starts again with the next put;
+	// otherwise the move is finished here
+	next = (head + 1) % medium->sectors;
+	if (store->writeOffset == medium->sectorSize && valid[next] &&
+	    sequence[next] == store->sequence - (medium->sectors - 1)) {
+		medium->erase(medium, head);
+		return kvOpen(store, medium);
+	}
+	retireSector(store, next);
+	return 0;
+}
+
+
+/**
+ * read the latest value of a key
+ */
+int kvGet(const KvStore *store, uint16_t key, void *value, int size)
+{
+	int k = findKey(store, key);
+	int length;
+
+	if (k < 0) {
+		return -1;
+	}
+	length = readWord(store->medium, store->offset[k]) & 0xffff;
+	memcpy(value, store->medium->base + store->offset[k] + 8, length < size ? length : size);
+	return length;
+}
+
+/**
+ * append a new value for a key
+ */
+int kvPut(KvStore *store, uint16_t key, const void *value, int length)
+{
+	uint32_t capacity = store->medium->sectorSize - KV_HEADER_BYTES;
+	uint32_t size = recordSize(length);
+
+	if (key == KV_NO_KEY || length < 0 || length > KV_MAX_LENGTH) {
+		return -1;
+	}
+	if (findKey(store, key) < 0 && store->keys == KV_MAX_KEYS) {
+		return -1;
+	}
+	// the old value of the key counts too: it is copied forward with
+	// the others, so that a reset before the new one is written keeps it
+	if (liveBytes(store) + size > capacity) {
+		return -1;
+	}
+	if (store->writeOffset + size > store->medium->sectorSize) {
+		advance(store);
+	}
+	appendRecord(store, key, value, length);
+	return 0;
+}
+
+void kvGetStats(const KvStore *store, KvStats *stats)
+{
+	*stats = store->stats;
+}
+
+
+static void ramErase(const KvMedium *medium, int sector)
+{
+	memset(medium->base + sectorStart(medium, sector), 0xff, medium->sectorSize);
+}
+
+static void ramProgram(const KvMedium *medium, uint32_t offset,
+		       const uint32_t *words, int count)
+{
+	uint32_t *to = (uint32_t *)(medium->base + offset);
+	int i;
+
+	for (i = 0; i < count; i++) {
+		to[i] &= words[i];	// like flash, clear bits only
+	}
+}
+
+/**
+ * describe a region of RAM as a medium of sectorSize sectors
+ */
+void kvRamMedium(KvMedium *medium, uint8_t *base, uint32_t size, uint32_t sectorSize)
+{
+	medium->base = base;
+	medium->sectorSize = sectorSize;
+	medium->sectors = size / sectorSize;
+	medium->context = NULL;
+	medium->erase = ramErase;
+	medium->program = ramProgram;
+}
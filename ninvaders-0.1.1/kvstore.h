@@ -0,0 +1,91 @@
+#ifndef KVSTORE
+#define KVSTORE
+
+#include <stdint.h>
+
+/**
+ * A small log-structured key-value store for memory that behaves like
+ * NOR flash: erasing sets a whole sector to 0xff, programming can only
+ * clear bits, and a write may be cut short by a reset or power loss.
+ *
+ * Each sector starts with a header holding a sequence number. Records
+ * are appended to the newest sector (the head) at its write offset, so
+ * an append costs the same however full the store is. When the head is
+ * full the log moves on to the next sector in ring order, so every
+ * sector is erased as often as the others. The sector after the head is
+ * always kept erased: when the log moves into it, the records in the
+ * sector after that (the oldest) that are still the latest for their
+ * key are copied forward, then the oldest sector is erased.
+ *
+ * A record is
+ *
+ *	key << 16 | length in bytes
+ *	checksum of the word above and the value
+ *	the value, padded to whole words
+ *	commit word, programmed to 0 last
+ *
+ * A record whose commit word is still erased, or whose checksum does
+ * not match, was cut short (or half erased) and is skipped. At start up
+ * kvOpen() orders the sectors by their headers, then walks the records
+ * from the oldest to the newest and keeps where the latest record of
+ * each key is in a small index, so a lookup does not scan at all.
+ *
+ * The store is not locked: it belongs to the task that opened it.
+ */
+
+#define KV_MAX_KEYS 8
+#define KV_MAX_LENGTH 256	// bytes in one value
+#define KV_MAX_SECTORS 16
+#define KV_NO_KEY 0xffff
+
+typedef struct KvMedium KvMedium;
+
+struct KvMedium {
+	uint8_t *base;		// the medium, readable in place, word aligned
+	uint32_t sectorSize;	// bytes, a multiple of 4
+	int sectors;		// 2 to KV_MAX_SECTORS
+	void *context;		// for the functions below
+	void (*erase)(const KvMedium *medium, int sector);
+	void (*program)(const KvMedium *medium, uint32_t offset,
+			const uint32_t *words, int count);
+};
+
+typedef struct KvStats KvStats;
+
+struct KvStats {
+	uint32_t appends;	// records written, copies included
+	uint32_t copies;	// records copied forward out of the oldest sector
+	uint32_t erases;
+	uint32_t skipped;	// damaged records found by kvOpen()
+	uint32_t lost;		// records that could not be copied forward
+};
+
+typedef struct KvStore KvStore;
+
+struct KvStore {
+	const KvMedium *medium;
+	int head;			// sector being written
+	uint32_t sequence;		// sequence number of the head
+	uint32_t writeOffset;		// next free byte in the head
+	int keys;			// keys in the index
+	uint16_t key[KV_MAX_KEYS];
+	uint32_t offset[KV_MAX_KEYS];	// of the latest record of each key
+	KvStats stats;
+};
+
+// a medium in RAM that is treated like flash: erase sets bytes to 0xff
+// and program ANDs words in
+void kvRamMedium(KvMedium *medium, uint8_t *base, uint32_t size, uint32_t sectorSize);
+
+// kvOpen() returns 0, or -1 if the medium's geometry is not usable. A
+// medium without a valid sector is formatted. kvGet() returns the
+// length of the value (of which at most size bytes are copied), or -1
+// if the key is not in the store. kvPut() returns 0, or -1 if the key
+// or length is out of range, the index is full or the latest values of
+// all keys would no longer fit into one sector.
+int kvOpen(KvStore *store, const KvMedium *medium);
+int kvGet(const KvStore *store, uint16_t key, void *value, int size);
+int kvPut(KvStore *store, uint16_t key, const void *value, int length);
+void kvGetStats(const KvStore *store, KvStats *stats);
+
+#endif
@@ -0,0 +1,234 @@
+#include "mirror.h"
+#include <stdio.h>
+#include <string.h>
+#include <task.h>
+#include <UART_16550.h>
+
+#define TX_BACKLOG_LIMIT 256	// skip the update while more than this is queued
+
+// Unchanged cells between two changed runs on a line are sent along
+// with them when they cost fewer bytes than moving the cursor past.
+#define DIRTY_GAP 6
+
+#define CURSOR_BYTES 8		// "\033[yy;xxH"
+#define COLOR_BYTES 5		// "\033[3nm"
+
+// colour of each curses colour pair, looked up once
+#define MIRROR_PAIRS 8
+static short pairColor[MIRROR_PAIRS];
+
+
+/**
+ * the cell of a curses line as the mirror stores it
+ */
+static uint16_t mirrorCell(chtype ch)
+{
+	int pair = PAIR_NUMBER(ch);
+
+	if (pair >= MIRROR_PAIRS) {
+		pair = 0;
+	}
+	return pair << 8 | (ch & 0xff);
+}
+
+
+/**
+ * clear the terminal on uart and mark the whole battlefield dirty
+ */
+void mirrorInit(Mirror *mirror, int uart)
+{
+	short fg, bg;
+	int x;
+
+	for (x = 0; x < MIRROR_PAIRS; x++) {
+		pairColor[x] = pair_content(x, &fg, &bg) == OK ? fg : COLOR_WHITE;
+	}
+
+	mirror->uart = uart;
+	mirror->second = xTaskGetTickCount();
+	mirror->frames = mirror->bytes = mirror->deferred = 0;
+	memset(&mirror->stats, 0, sizeof(mirror->stats));
+
+	mirrorInvalidate(mirror);
+}
+
+
+/**
+ * forget what the terminal shows, after something else wrote to the
+ * UART: clear it, and mark the whole battlefield dirty so the next
+ * updates draw it again
+ */
+void mirrorInvalidate(Mirror *mirror)
+{
+	int y, x;
+
+	for (y = 0; y < SCREENHEIGHT; y++) {
+		for (x = 0; x < SCREENWIDTH; x++) {
+			mirror->shown[y][x] = ' ';
+		}
+		mirror->dirtyFirst[y] = SCREENWIDTH;
+		mirror->dirtyLast[y] = -1;
+	}
+	mirror->line = 0;
+	mirror->color = -1;
+	mirrorMarkDirty(mirror, 0, 0, SCREENHEIGHT - 1, SCREENWIDTH - 1);
+
+	UART_16550_tx_lock(mirror->uart, portMAX_DELAY);
+	UART_16550_write_string(mirror->uart, "\033[0m\033[2J\033[?25l", portMAX_DELAY);	// clear, hide cursor
+	UART_16550_tx_unlock(mirror->uart);
+}
+
+
+/**
+ * mark the rectangle (x1, y1) - (x2, y2) as dirty
+ */
+void mirrorMarkDirty(Mirror *mirror, int y1, int x1, int y2, int x2)
+{
+	int y;
+
+	if (x1 < 0) x1 = 0;
+	if (x2 > SCREENWIDTH - 1) x2 = SCREENWIDTH - 1;
+	if (y1 < 0) y1 = 0;
+	if (y2 > SCREENHEIGHT - 1) y2 = SCREENHEIGHT - 1;
+
+	for (y = y1; y <= y2; y++) {
+		if (x1 < mirror->dirtyFirst[y]) mirror->dirtyFirst[y] = x1;
+		if (x2 > mirror->dirtyLast[y]) mirror->dirtyLast[y] = x2;
+	}
+}
+
+
+/**
+ * count an update (or a skipped one) towards the statistics
+ */
+static void mirrorCount(Mirror *mirror, int bytes)
+{
+	TickType_t now = xTaskGetTickCount();
+
+	if (bytes > 0) {
+		mirror->frames++;
+		mirror->bytes += bytes;
+	} else if (bytes < 0) {
+		mirror->deferred++;
+	}
+	if (now - mirror->second >= pdMS_TO_TICKS(1000)) {
+		mirror->stats.framesPerSecond = mirror->frames;
+		mirror->stats.bytesPerSecond = mirror->bytes;
+		mirror->stats.deferred = mirror->deferred;
+		mirror->frames = mirror->bytes = mirror->deferred = 0;
+		mirror->second = now;
+	}
+}
+
+
+/**
+ * send the changed cells of win to the mirror's terminal, as many as
+ * fit in one update
+ */
+void mirrorUpdate(Mirror *mirror, WINDOW *win)
+{
+	static char buffer[MIRROR_FRAME_BYTES + 1];
+	int n = 0;
+	int i, y, x, first, last, gap;
+
+	// the UART is behind (or another task is writing to it): try
+	// again next frame, the cells stay dirty
+	if (UART_16550_tx_pending(mirror->uart) > TX_BACKLOG_LIMIT ||
+	    UART_16550_tx_lock(mirror->uart, 0) != pdPASS) {
+		mirrorCount(mirror, -1);
+		return;
+	}
+
+	// start where the last full update stopped, so that a busy top
+	// of the screen cannot starve the lines below it
+	for (i = 0; i < SCREENHEIGHT; i++) {
+		chtype *cells;
+
+		y = (mirror->line + i) % SCREENHEIGHT;
+		cells = win->_y[y];
+
+		while (mirror->dirtyFirst[y] <= mirror->dirtyLast[y]) {
+			// find the next changed cell in the dirty span
+			for (first = mirror->dirtyFirst[y]; first <= mirror->dirtyLast[y]; first++) {
+				if (mirrorCell(cells[first]) != mirror->shown[y][first]) break;
+			}
+			if (first > mirror->dirtyLast[y]) {
+				mirror->dirtyFirst[y] = SCREENWIDTH;
+				mirror->dirtyLast[y] = -1;
+				break;
+			}
+
+			// extend the run while the gaps in it are short
+			last = first;
+			gap = 0;
+			for (x = first + 1; x <= mirror->dirtyLast[y] && gap <= DIRTY_GAP; x++) {
+				if (mirrorCell(cells[x]) != mirror->shown[y][x]) {
+					last = x;
+					gap = 0;
+				} else {
+					gap++;
+				}
+			}
+
+			if (n + CURSOR_BYTES + COLOR_BYTES + 1 > MIRROR_FRAME_BYTES) {
+				mirror->line = y;
+				goto full;
+			}
+			n += sprintf(buffer + n, "\033[%d;%dH", y + 1, first + 1);
+			for (x = first; x <= last; x++) {
+				uint16_t cell = mirrorCell(cells[x]);
+				int color = pairColor[cell >> 8];
+
+				if (n + COLOR_BYTES + 1 > MIRROR_FRAME_BYTES) {
+					mirror->dirtyFirst[y] = x;	// the rest goes next time
+					mirror->line = y;
+					goto full;
+				}
+				if (color != mirror->color) {
+					n += sprintf(buffer + n, "\033[3%dm", color);
+					mirror->color = color;
+				}
+				buffer[n++] = cell & 0xff;
+				mirror->shown[y][x] = cell;
+			}
+			mirror->dirtyFirst[y] = last + 1;
+		}
+	}
+full:
+	if (n > 0) {
+		buffer[n] = '\0';
+		// fits: at most TX_BACKLOG_LIMIT + MIRROR_FRAME_BYTES are
+		// queued, which is the size of the UART transmit buffer
+		UART_16550_write_string(mirror->uart, buffer, 0);
+	}
+	UART_16550_tx_unlock(mirror->uart);
+	mirrorCount(mirror, n);
+}
+
+
+/**
+ * show a line of text at row y of the mirror's terminal, below the
+ * battlefield; dropped if the UART is busy
+ */
+void mirrorStatus(Mirror *mirror, int y, const char *text)
+{
+	static char buffer[96];
+
+	if (UART_16550_tx_pending(mirror->uart) > TX_BACKLOG_LIMIT ||
+	    UART_16550_tx_lock(mirror->uart, 0) != pdPASS) {
+		return;
+	}
+	snprintf(buffer, sizeof(buffer), "\033[%d;1H\033[37m%s\033[K", y + 1, text);
+	mirror->color = COLOR_WHITE;
+	UART_16550_write_string(mirror->uart, buffer, 0);
+	UART_16550_tx_unlock(mirror->uart);
+}
+
+
+/**
+ * copy the statistics for the last full second
+ */
+void mirrorGetStats(const Mirror *mirror, MirrorStats *stats)
+{
+	*stats = mirror->stats;
+}
@@ -0,0 +1,60 @@
+#ifndef MIRROR
+#define MIRROR
+
+#include <stdint.h>
+#include <curses.h>
+#include <FreeRTOS.h>
+#include "view.h"
+
+/**
+ * A mirror shows the battlefield on a second terminal, on another UART.
+ * PDCurses drives a single screen, so a mirror does not go through it:
+ * it keeps its own copy of what its terminal shows and its own dirty
+ * spans, and writes the changed runs of cells as ANSI sequences
+ * straight into its UART's transmit buffer.
+ *
+ * Anything else written to the UART spoils that copy: call
+ * mirrorInvalidate() afterwards, and the terminal is cleared and drawn
+ * again.
+ *
+ * Each mirror paces itself on its own UART's backlog. When the link is
+ * behind, the update is skipped and the cells stay dirty, so a slow
+ * spectator terminal only lowers its own frame rate, never the game's.
+ */
+
+#define MIRROR_FRAME_BYTES 256	// most bytes queued by one update
+
+typedef struct MirrorStats MirrorStats;
+
+struct MirrorStats {
+	int framesPerSecond;	// updates sent in the last second
+	int bytesPerSecond;
+	int deferred;		// updates skipped in the last second
+};
+
+typedef struct Mirror Mirror;
+
+struct Mirror {
+	int uart;
+	uint16_t shown[SCREENHEIGHT][SCREENWIDTH];	// colour pair << 8 | char
+	int dirtyFirst[SCREENHEIGHT];			// dirty span of each line,
+	int dirtyLast[SCREENHEIGHT];			// first > last if clean
+	int line;					// line the next update starts at
+	int color;					// terminal colour, -1 if unknown
+
+	// counts for the current second
+	TickType_t second;
+	int frames;
+	int bytes;
+	int deferred;
+	MirrorStats stats;
+};
+
+void mirrorInit(Mirror *mirror, int uart);
+void mirrorInvalidate(Mirror *mirror);
+void mirrorMarkDirty(Mirror *mirror, int y1, int x1, int y2, int x2);
+void mirrorUpdate(Mirror *mirror, WINDOW *win);
+void mirrorStatus(Mirror *mirror, int y, const char *text);
+void mirrorGetStats(const Mirror *mirror, MirrorStats *stats);
+
+#endif
@@ -22,21 +22,19 @@
  */
 
 #include <FreeRTOS.h>
-#include <timers.h>
+#include <task.h>
+#include <queue.h>
 
 #include <stdio.h>
 #include <string.h>
 #include <sys/time.h>
 #include "nInvaders.h"
-#include "player.h"
-#include "aliens.h"
-#include "ufo.h"
+#include "governor.h"
+#include "record.h"
+#include "mirror.h"
+#include "profile.h"
+#include "highscore.h"
 
-#include <sound_effects.h>
-
-extern int weite;
-extern int level;
-extern int skill_level;
 
 /* Structure that will hold the TCB of the task being created. */
 StaticTask_t nInvaders_TCB;
@@ -49,33 +47,11 @@ StackType_t nInvaders_stack[ NINVADERS_STACK_SIZE ];
 
 #define FPS 25
 
-int lives;
-long score;
-int status; // status handled in timer
 
-#define GAME_LOOP 1
-#define GAME_NEXTLEVEL 2
-#define GAME_PAUSED 3
-#define GAME_OVER 4
-#define GAME_EXIT 5
-#define GAME_HIGHSCORE 6
 
 
 
 
-/**
- * initialize level: reset attributes of most units
- */
-static void initLevel()
-{
-	playerReset();
-	aliensReset();
-	ufoReset();
-	bunkersReset();
-	render();
-	drawscore();
-}
-
 
 /**
  * evaluate command line parameters 
@@ -87,7 +63,7 @@ static void evaluateCommandLine(int argc, char **argv)
 	// -l : set skill level
 	if (argc == 3 && strcmp(argv[1], "-l") == 0) {
 		if (argv[2][0] >= '0' && argv[2][0] <= '9') {
-			skill_level = argv[2][0] - 48;
+			game.skillLevel = argv[2][0] - 48;
 		} else {
 			argc = 2;
 		}
@@ -118,22 +94,22 @@ static void finish(int sig)
 	fprintf(stderr,"=========================================================================\n");
 	fprintf(stderr,"\n");
 	
-	fprintf(stderr,"Final score: %7.7ld, Final level: %2.2d\nFinal rating... ",score,level);
-	if (lives>0)
+	fprintf(stderr,"Final score: %7.7ld, Final level: %2.2d\nFinal rating... ",game.score,game.level);
+	if (game.lives>0)
 		fprintf(stderr,"Quitter\n\n");
-	else if(score<5000)
+	else if(game.score<5000)
 		fprintf(stderr,"Alien Fodder\n\n");
-	else if(score<7500)
+	else if(game.score<7500)
 		fprintf(stderr,"Easy Target\n\n");
-	else if(score<10000)
+	else if(game.score<10000)
 		fprintf(stderr,"Barely Mediocre\n\n");
-	else if(score<12500)
+	else if(game.score<12500)
 		fprintf(stderr,"Shows Promise\n\n");
-	else if(score<15000)
+	else if(game.score<15000)
 		fprintf(stderr,"Alien Blaster\n\n");
-	else if(score<20000)
+	else if(game.score<20000)
 		fprintf(stderr,"Earth Defender\n\n");
-	else if(score>19999)
+	else if(game.score>19999)
 		fprintf(stderr,"Supreme Protector\n\n");
 	
 	showVersion();
@@ -142,193 +118,463 @@ static void finish(int sig)
 
 */
 
-void drawscore()
+/**
+ * The status line is a low priority update: it is redrawn when the
+ * frame governor has bytes to spare, but at least once a second.
+ */
+#define SCORE_MAX_DEFER FPS
+
+static long shownScore = -1;
+static int shownLives = -1;
+static int shownLevel = -1;
+static int scoreDeferred = 0;
+
+static void updateScore()
 {
-	statusDisplay(level, score, lives);
+	if (game.score == shownScore && game.lives == shownLives && game.level == shownLevel) {
+		return;		// nothing changed
+	}
+	if (governorAllowLowPriority() || ++scoreDeferred >= SCORE_MAX_DEFER) {
+		statusDisplay(game.level, game.score, game.lives);
+		shownScore = game.score;
+		shownLives = game.lives;
+		shownLevel = game.level;
+		scoreDeferred = 0;
+	}
 }
 
 
+static RecordEvent recordBuffer[NINVADERS_RECORD_EVENTS];
+static Recording recording;
+#ifdef NINVADERS_REPLAY
+static Replay replay;
+#endif
+
+#if NINVADERS_MIRROR
+static Mirror spectator;
+#endif
+
 /**
- * reads input from keyboard and do action
+ * Dumps to the record UART ('D', 'H' and 'T') are written a few lines
+ * per frame by dumpStep(), so a long one, like the thousand lines of a
+ * full recording, does not stop the game. Each dump is a function that
+ * formats its line n and returns 0 past the last one; line 0 takes a
+ * copy of what is dumped, so a dump is consistent while the game goes
+ * on. The spectator mirror may share the UART: it is paused while a
+ * dump is written, and redrawn from scratch afterwards.
  */
-void readInput()
-{
-	int ch;
-	static int lastmove;
+#define DUMP_BACKLOG 256	// queue lines while fewer bytes than this are pending
+
+typedef int (*DumpLine)(int n, char *line, int size);
+
+static DumpLine dumpLine;	// the dump being written, NULL if none
+static int dumpNext;		// its next line
 
-	ch = getch();		// get key pressed
+/**
+ * start writing a dump, unless one is already being written
+ */
+static void dumpStart(DumpLine line)
+{
+	if (dumpLine == NULL) {
+		dumpLine = line;
+		dumpNext = 0;
+	}
+}
 
-	switch (status) {
+#if NINVADERS_MIRROR
+/**
+ * check if the mirror must keep off the UART for a dump
+ */
+static int dumpBlocksMirror()
+{
+	return dumpLine != NULL && GAME_MIRROR_UART == GAME_RECORD_UART;
+}
+#endif
 
-	case GAME_PAUSED:
+/**
+ * write as many lines of the current dump as the UART has room for
+ */
+static void dumpStep()
+{
+	static char line[80];
 
-		if (ch == 'p') {
-			status = GAME_LOOP;
+	if (dumpLine == NULL || UART_16550_tx_lock(GAME_RECORD_UART, 0) != pdPASS) {
+		return;
+	}
+	while (UART_16550_tx_pending(GAME_RECORD_UART) < DUMP_BACKLOG) {
+		if (!dumpLine(dumpNext, line, sizeof(line))) {
+			dumpLine = NULL;	// done
+			break;
 		}
-		break;
-		       
-	case GAME_HIGHSCORE:
+		UART_16550_write_string(GAME_RECORD_UART, line, portMAX_DELAY);
+		dumpNext++;
+	}
+	UART_16550_tx_unlock(GAME_RECORD_UART);
+#if NINVADERS_MIRROR
+	if (dumpLine == NULL && GAME_MIRROR_UART == GAME_RECORD_UART) {
+		mirrorInvalidate(&spectator);	// the dump wrote over its screen
+	}
+#endif
+}
 
-		if (ch == ' ') {
-			titleScreenClear();
-			level = 0;      // reset level
-			score = 0;      // reset score
-			lives = 3;      // restore lives
-			status = GAME_NEXTLEVEL;
-		} 
-		//else if (ch == 'q') {	// quit game
-		//	status = GAME_EXIT;
-		// }
-		break;
+/**
+ * line n of the recording of this session
+ */
+static int recordingLine(int n, char *line, int size)
+{
+	static Recording dumped;
 
-	case GAME_OVER:
-		// xEventGroupSetBits(effect_events, UFO_LOWPITCH_EVENT);
-		break; // don't do anything
+	if (n == 0) {
+		dumped = recording;	// the events so far; later ones are appended
+	}
+	return recordFormat(&dumped, n, line, size);
+}
 
-	default:
+#if NINVADERS_PROFILE
+/**
+ * line n of the frame time histograms of the last profiler window
+ */
+static int profileLine(int n, char *line, int size)
+{
+	static ProfileStats stats[PROFILE_PHASES];
+	int phase, bucket;
 
-		if (ch == 'l' || ch == KEY_RIGHT) {	// move player rightk
-			if (lastmove == 'l') {
-				playerTurboOn();	// enable Turbo
-			} else {
-				playerTurboOff();	// disable Turbo
-			}
-			playerMoveRight();		// move player
-			lastmove = 'l';			// remember last move for turbo mode
-		} else if (ch == 'h' || ch == KEY_LEFT) {	// move player left 
-			if (lastmove == 'h') {
-				playerTurboOn();	// enable Turbo
-			} else {
-				playerTurboOff();	// disable Turbo
+	if (n == 0) {
+		for (phase = 0; phase < PROFILE_PHASES; phase++) {
+			profileGetStats(phase, &stats[phase]);
+		}
+		snprintf(line, size, "\r\nframe phases over %d frames (us: average, worst)\r\n",
+			 PROFILE_WINDOW);
+		return 1;
+	}
+
+	// a line for each phase, followed by its buckets that are not empty
+	for (phase = 0; phase < PROFILE_PHASES; phase++) {
+		if (--n == 0) {
+			snprintf(line, size, "%-12s %5lu runs %6lu %6lu\r\n",
+				 profilePhaseName(phase), (unsigned long)stats[phase].count,
+				 (unsigned long)profileMicroseconds(stats[phase].count ?
+					stats[phase].total / stats[phase].count : 0),
+				 (unsigned long)profileMicroseconds(stats[phase].worst));
+			return 1;
+		}
+		for (bucket = 0; bucket < PROFILE_BUCKETS; bucket++) {
+			if (stats[phase].histogram[bucket] != 0 && --n == 0) {
+				snprintf(line, size, "  < %6lu cycles: %u\r\n",
+					 1ul << bucket, stats[phase].histogram[bucket]);
+				return 1;
 			}
-			playerMoveLeft();		// move player
-			lastmove = 'h';			// remember last move for turbo mode
-		} else if (ch == 'k' || ch == ' ') {	// shoot missile
-			playerLaunchMissile();
-		} else if (ch == 'p') {			// pause game until 'p' pressed again
-			xEventGroupSetBits(effect_events, UFO_LOWPITCH_EVENT);
-			// set status to game paused
-			status = GAME_PAUSED;
-		} else if (ch == 'W') {			// cheat: goto next level
-			status = GAME_NEXTLEVEL;
-		} else if (ch == 'L') {			// cheat: one more live
-			lives++;
-			drawscore();
-		} else if (ch == 'q') {	// quit game
-			status = GAME_EXIT;
-		} else {		// disable turbo mode if key is not kept pressed
-			lastmove = ' ';
 		}
+	}
+	return 0;
+}
+#endif
 
-	} // switch
-	
+/**
+ * The high score table is kept in the linker script's key-value store
+ * region, which the startup code leaves alone, so it survives a reset.
+ */
+extern uint8_t __KVStoreBase[], __KVStoreTop[];
+
+static KvMedium scoreMedium;
+static int lastStatus = GAME_HIGHSCORE;
+
+static void highscoreSetUp()
+{
+	kvRamMedium(&scoreMedium, __KVStoreBase, __KVStoreTop - __KVStoreBase,
+		    GAME_KVSTORE_SECTOR);
+	highscoreInit(&scoreMedium);
+	titleScreenScores(highscoreTable());
 }
-	
-	
+
 /**
- * timer
- * this method is executed every 1 / FPS seconds  
+ * enter the game into the high score table once it is over
  */
-void handleTimer()
+static void checkGameOver()
 {
-	static int aliens_move_counter = 0; 
-	static int aliens_shot_counter = 0;
-	static int player_shot_counter = 0;
-	static int ufo_move_counter = 0;
-	static int title_animation_counter = 0;
-	static int game_over_counter = 0;
+	if (game.status == GAME_OVER && lastStatus != GAME_OVER) {
+#ifndef NINVADERS_REPLAY
+		if (highscoreAdd(game.score, game.level, game.skillLevel) >= 0) {
+			titleScreenScores(highscoreTable());
+		}
+#endif
+	}
+	lastStatus = game.status;
+}
 
-	
-	switch (status) {
-		 
-	case GAME_NEXTLEVEL:    // go to next level
-		
-		level++;	// increase level
-
-		initLevel();	// initialize level
-		
-		aliens_move_counter = 0; 
-		aliens_shot_counter = 0;
-		player_shot_counter = 0;
-		ufo_move_counter = 0;
-		
-		weite = (shipnum+(skill_level*10)-(level*5)+5)/10;
-		
-		if (weite < 0) {
-			weite = 0;
+/**
+ * line n of the high score table, with the rating of each game
+ */
+static int highscoreLine(int n, char *line, int size)
+{
+	static HighScoreTable table;
+
+	if (n == 0) {
+		table = *highscoreTable();
+		snprintf(line, size, "\r\nhigh scores\r\n");
+		return 1;
+	}
+	if (n > (int)table.count) {
+		return 0;
+	}
+	snprintf(line, size, "%2d. %7.7lu  level %2.2u  %s\r\n", n,
+		 (unsigned long)table.entry[n - 1].score, table.entry[n - 1].level,
+		 highscoreRating(table.entry[n - 1].score));
+	return 1;
+}
+
+#ifdef NINVADERS_REPLAY
+/**
+ * read a recording from the record UART, and start replaying it
+ */
+static void loadRecording()
+{
+	static char line[48];
+
+	recording.events = recordBuffer;
+	recording.capacity = NINVADERS_RECORD_EVENTS;
+
+	UART_16550_write_string(GAME_RECORD_UART, "nInvaders: paste a recording\n", portMAX_DELAY);
+	UART_16550_rx_lock(GAME_RECORD_UART, portMAX_DELAY);
+	do {
+		UART_16550_read_string(GAME_RECORD_UART, line, sizeof(line), portMAX_DELAY);
+	} while (recordParse(&recording, line) != 1);	// bad lines are skipped
+	UART_16550_rx_unlock(GAME_RECORD_UART);
+
+	replayStart(&replay, &recording);
+}
+#endif
+
+/**
+ * reads input from keyboard and do action
+ */
+static void readInput()
+{
+	int ch;
+
+	do {
+		ch = getch();		// get key pressed
+		if (ch == 'D') {
+			dumpStart(recordingLine);
+			continue;
 		}
-		
-		// change status and start game!
-		status = GAME_LOOP;
-
-	case GAME_LOOP:   	 // do game handling
-		
-		// move aliens			
-		if (aliens_move_counter == 0 && aliensMove() == 1) {
-			// aliens reached player
-			lives = 0;
-			status = GAME_OVER;
+		if (ch == 'H') {
+			dumpStart(highscoreLine);
+			continue;
 		}
-		
-		// move player missile			
-		if (player_shot_counter == 0 && playerMoveMissile() == 1) {
-			// no aliens left
-			status = GAME_NEXTLEVEL;
+#if NINVADERS_PROFILE
+		if (ch == 'T') {
+			dumpStart(profileLine);
+			continue;
 		}
-		
-		// move aliens' missiles
-		if (aliens_shot_counter == 0 && aliensMissileMove() == 1) {
-			// player was hit
-			lives--;			// player looses one life
-			drawscore();	                // draw score
-			playerExplode();		// display some explosion graphics
-			if (lives == 0) {		// if no lives left ...
-				status = GAME_OVER;		// ... exit game
-			}
+#endif
+#ifndef NINVADERS_REPLAY
+		recordInput(&recording, ch);	// GAME_NO_KEY at the end turns turbo off
+#endif
+	} while (ch != ERR);
+}
+
+
+/**
+ * The board's push buttons play the game too: left and right move,
+ * center and up shoot (and start a game), down pauses. They are read
+ * from the button driver's queue, without the UART and the escape
+ * sequence decoding in between. A move button that is held down
+ * repeats every frame after a short delay, like a key does.
+ */
+#define BUTTON_REPEAT_DELAY 5	// frames
+
+static int buttonHeldFrames;
+
+/**
+ * the move key of the buttons that are down, or GAME_NO_KEY
+ */
+static int buttonMoveKey(uint32_t state)
+{
+	switch (state & (BUTTON_LEFT | BUTTON_RIGHT)) {
+	case BUTTON_LEFT:
+		return KEY_LEFT;
+	case BUTTON_RIGHT:
+		return KEY_RIGHT;
+	default:
+		return GAME_NO_KEY;	// none, or both
+	}
+}
+
+/**
+ * handle the button presses and releases received
+ */
+static void readButtons()
+{
+	BUTTONS_event_t event;
+
+	while (BUTTONS_get_event(&event, 0) == pdPASS) {
+#ifndef NINVADERS_REPLAY
+		if (event.pressed & (BUTTON_CENTER | BUTTON_UP)) {
+			recordInput(&recording, ' ');
 		}
-		
-		// move ufo
-		if (ufo_move_counter == 0 && ufoShowUfo() == 1) {
-			ufoMoveLeft();			// move it one position to the left
+		if (event.pressed & BUTTON_DOWN) {
+			recordInput(&recording, 'p');
+		}
+		if (event.pressed & (BUTTON_LEFT | BUTTON_RIGHT)) {
+			buttonHeldFrames = 0;
+			recordInput(&recording, buttonMoveKey(event.state));	// move at once
+		}
+		if ((event.released & (BUTTON_LEFT | BUTTON_RIGHT)) &&
+		    buttonMoveKey(event.state) == GAME_NO_KEY) {
+			recordInput(&recording, GAME_NO_KEY);	// turbo off
+		}
+#endif
+	}
+}
+
+/**
+ * repeat the move of a held button, once per frame
+ */
+static void repeatButtons()
+{
+	int key = buttonMoveKey(BUTTONS_state());
+
+	if (key == GAME_NO_KEY) {
+		buttonHeldFrames = 0;
+	} else if (++buttonHeldFrames > BUTTON_REPEAT_DELAY) {
+		recordInput(&recording, key);	// held: turbo after the first repeat
+	}
+}
+
+
+/**
+ * advance the game by one frame
+ */
+static void frameStep()
+{
+#ifdef NINVADERS_REPLAY
+	replayStep(&replay);	// the game stops when the recording ends
+#else
+	repeatButtons();
+	recordStep(&recording);
+#endif
+	checkGameOver();
+#if NINVADERS_PROFILE
+	profileFrame();
+#endif
+}
+	
+	
+
+
+#if NINVADERS_MIRROR
+#if NINVADERS_PROFILE
+/**
+ * the profiler overlay: average/worst microseconds of each frame phase
+ * in the last window, on the line below the frame rates
+ */
+static void profileStatus()
+{
+	static char line[96];
+	ProfileStats stats;
+	int phase, n = 0;
+
+	for (phase = 0; phase < PROFILE_PHASES; phase++) {
+		profileGetStats(phase, &stats);
+		n += snprintf(line + n, sizeof(line) - n, "%s %lu/%lu ", profilePhaseName(phase),
+			      (unsigned long)profileMicroseconds(stats.count ? stats.total / stats.count : 0),
+			      (unsigned long)profileMicroseconds(stats.worst));
+		if (n >= (int)sizeof(line)) {
+			break;
+		}
+	}
+	mirrorStatus(&spectator, SCREENHEIGHT + 1, line);
+}
+#endif
+
+/**
+ * once a second, show both frame rates below the spectator's
+ * battlefield: the spectator should keep up without slowing the game
+ */
+static void spectatorStatus()
+{
+	static TickType_t lastStatus;
+	static char line[80];
+	GovernorStats player;
+	MirrorStats mirrored;
+
+	if (xTaskGetTickCount() - lastStatus < pdMS_TO_TICKS(1000)) {
+		return;
+	}
+	lastStatus = xTaskGetTickCount();
+	governorGetStats(&player);
+	mirrorGetStats(&spectator, &mirrored);
+	snprintf(line, sizeof(line), "player %d fps, spectator %d fps (%d skipped, %d bytes/s)",
+		 player.framesPerSecond, mirrored.framesPerSecond,
+		 mirrored.deferred, mirrored.bytesPerSecond);
+	mirrorStatus(&spectator, SCREENHEIGHT, line);
+#if NINVADERS_PROFILE
+	profileStatus();
+#endif
+}
+#endif
+
+/**
+ * rendering
+ * this method sends the battlefield to the terminal after the
+ * physics have caught up
+ */
+static void gameRender()
+{
+	static int titleFrameShown = 0;
+	static int gameOverShown = 0;
+
+	switch (game.status) {
+
+	case GAME_LOOP:
+	case GAME_PLAYER_EXPLODING:
+		updateScore();
+
+		// skip the frame if the UART is behind; the changes are sent
+		// with the next one
+		if (governorFrameDue()) {
+			PROFILE_SCOPE(PROFILE_RENDER);
+			refreshScreen();
+			governorFrameSent();
 		}
-		
-		
-		if (aliens_shot_counter++ >= 5) {aliens_shot_counter=0;}     // speed of alien shot
-		if (player_shot_counter++ >= 1) {player_shot_counter=0;}     // speed of player shot
-		if (aliens_move_counter++ >= weite) {aliens_move_counter=0;} // speed of aliend
-		if (ufo_move_counter++ >= 3) {ufo_move_counter=0;}           // speed of ufo
-
-		
-		refreshScreen();
-		break;
-		
-	case GAME_PAUSED:    // game is paused
 		break;
-		
-	case GAME_OVER:      // game over
-		if (game_over_counter == 100) {
-			battleFieldClear();
-			status = GAME_HIGHSCORE;
-			game_over_counter = 0;
-		} else {
+
+	case GAME_OVER:
+		// the banner does not change: send it once, when the UART
+		// has room for a frame
+		if (!gameOverShown && governorFrameDue()) {
+			PROFILE_SCOPE(PROFILE_RENDER);
 			gameOverDisplay();
-			game_over_counter++;
+			governorFrameSent();
+			gameOverShown = 1;
 		}
 		break;
-		
-	/* case GAME_EXIT:      // exit game */
-	/* 	finish(0); */
-	/* 	break; */
-		
-	case GAME_HIGHSCORE: // display highscore
-		if (title_animation_counter == 0) {
+
+	case GAME_HIGHSCORE:
+		// the title animation is low priority: skip frames while
+		// the UART is busy
+		if (game.titleFrame != titleFrameShown && governorAllowLowPriority()) {
+			PROFILE_SCOPE(PROFILE_RENDER);
 			titleScreenDisplay();
+			governorFrameSent();
+			titleFrameShown = game.titleFrame;
 		}
-
-		if (title_animation_counter++ >= 6) {title_animation_counter = 0;} // speed of animation
 		break;
-		
 	}
+	if (game.status != GAME_OVER) {
+		gameOverShown = 0;
+	}
+
+#if NINVADERS_MIRROR
+	if (!dumpBlocksMirror()) {
+		{
+			PROFILE_SCOPE(PROFILE_MIRROR);
+			refreshMirror();	// paced by its own UART, not the governor
+		}
+		spectatorStatus();
+	}
+#endif
 }
 
 
@@ -351,63 +597,130 @@ void handleTimer()
 }
 */
 
- static TimerHandle_t nInvader_timer;
+/**
+ * The game task is its own frame scheduler. Between frames it sleeps
+ * on this queue, which the UART receiver posts to, so a key is handled
+ * as soon as it arrives instead of at the next poll. The software
+ * timer is not used: the game logic must not run in the timer daemon,
+ * which has the highest priority and would preempt the audio mixer.
+ */
+#define GAME_EVENT_QUEUE_LENGTH 8
+
+static QueueHandle_t gameEvents;
+static StaticQueue_t gameEventsControlBlock;
+static uint8_t gameEventsStorage[GAME_EVENT_QUEUE_LENGTH * sizeof(GameEvent)];
+
+/**
+ * UART receive callback, runs in the ISR
+ */
+static void postInput(void *arg, BaseType_t *higherPriorityTaskWoken)
+{
+	GameEvent event = GAME_EVENT_INPUT;
 
- /**
-  * set up timer
-  */
- 
- StaticTimer_t timerControlBlock;
+	// a dropped event is harmless: the next one drains all input
+	xQueueSendFromISR(gameEvents, &event, higherPriorityTaskWoken);
+}
 
- void setUpTimer()
+/**
+ * push button callback, runs in the ISR or the timer task
+ */
+static void postButtons(void *arg, BaseType_t *higherPriorityTaskWoken)
 {
-    nInvader_timer = xTimerCreateStatic("nInvader",
-						pdMS_TO_TICKS(1000 / FPS),
-						pdTRUE,
-						( void * ) 0,
-						handleTimer,
-						&timerControlBlock);
-
-	xTimerStart(nInvader_timer,0);	
+	GameEvent event = GAME_EVENT_BUTTONS;
+
+	// a dropped event is harmless: the next one drains all buttons
+	xQueueSendFromISR(gameEvents, &event, higherPriorityTaskWoken);
+}
+
+#define FRAME_TICKS pdMS_TO_TICKS(1000 / FPS)
+#define MAX_CATCH_UP 5		// physics steps run back to back at most
+
+/**
+ * check if the frame starting at tick frame is due
+ */
+static int frameDue(TickType_t frame)
+{
+	// works across tick counter wrap-around
+	return (TickType_t)(xTaskGetTickCount() - frame) < portMAX_DELAY / 2;
+}
+
+/**
+ * set up event queue
+ */
+void setUpEvents()
+{
+	gameEvents = xQueueCreateStatic(GAME_EVENT_QUEUE_LENGTH,
+					sizeof(GameEvent),
+					gameEventsStorage,
+					&gameEventsControlBlock);
+
+	UART_16550_set_rx_callback(GAME_UART, postInput, NULL);
+	BUTTONS_set_callback(postButtons, NULL);
 }
 
 void ninvaders(void *params)
 {
- 	weite = 0;
-	score = 0;
-	lives = 3;
-	level = 0;
-	skill_level = 1;
+	TickType_t nextFrame;
 
 	// evaluateCommandLine(argc, argv);	// evaluate command line parameters
 	graphicEngineInit();			// initialize graphic engine
+	highscoreSetUp();			// load the table kept across resets
+#if NINVADERS_PROFILE
+	profileInit();				// start the cycle counter
+#endif
+	governorInit(FPS);			// limit output to what the UART can carry
 	
-	// set up timer/ game handling
-	setUpTimer();
-	status = GAME_HIGHSCORE;	
+	// set up input/ game handling
+	setUpEvents();
+#ifdef NINVADERS_REPLAY
+	loadRecording();
+#else
+	recordStart(&recording, recordBuffer, NINVADERS_RECORD_EVENTS,
+		    1, xTaskGetTickCount());	// skill level 1
+#endif
+#if NINVADERS_MIRROR
+	mirrorInit(&spectator, GAME_MIRROR_UART);	// after a replay is loaded from it
+	viewSetMirror(&spectator);
+#endif
 	
 	curs_set(0);
 
-	// read keyboard input
+	nextFrame = xTaskGetTickCount() + FRAME_TICKS;
 	do {
-		// do movements and key-checking
-		readInput();
+		GameEvent event;
+		int steps;
+
+		// sleep until the next frame, handling keys as they arrive
+		if (!frameDue(nextFrame)) {
+			TickType_t wait = nextFrame - xTaskGetTickCount();
+
+			if (xQueueReceive(gameEvents, &event, wait) == pdPASS) {
+				if (event == GAME_EVENT_BUTTONS) {
+					readButtons();	// handle all button changes
+				} else {
+					readInput();	// handle all keys received
+				}
+				continue;
+			}
+		}
+
+		// fixed timestep: run one physics step for every frame time
+		// that has passed, then draw the result once
+		for (steps = 0; steps < MAX_CATCH_UP && frameDue(nextFrame); steps++) {
+			governorTick();	// account for what the last frame sent
+			frameStep();
+			nextFrame += FRAME_TICKS;
+		}
+		if (frameDue(nextFrame)) {
+			// too far behind to catch up; drop the lost time
+			nextFrame = xTaskGetTickCount() + FRAME_TICKS;
+		}
+		dumpStep();
+		gameRender();
 	} while (1);
 	
 }
 
 
-void doScoring(int alienType)
-{
-	int points[4] = {500, 200, 150, 100};   	// 0: ufo, 1:red, 2:green, 3:blue
-	
-	score += points[alienType];		// every alien type does different scoring points
-	
-	// every 6000 pts player gets a new live
-	if (score % 6000 == 0){
-		lives++;
-	}
-	
-	drawscore();	// display score
-}
+
 
@@ -29,16 +29,56 @@
 #include <stdlib.h>
 #include "view.h"
 #include "globals.h"
+#include "game.h"
 #include <FreeRTOS.h>
 #include <timers.h>
+#include <UART_16550.h>
+#include <buttons.h>
 
+// the terminal the game is played on
+#define GAME_UART UART0
+
+// the terminal recordings are written to and read from
+#define GAME_RECORD_UART UART1
+
+/* A spectator terminal on this UART mirrors the battlefield (see
+mirror.h). It shares the UART with stats_task, so set NINVADERS_MIRROR
+to 0 to run that instead. */
+#define GAME_MIRROR_UART UART1
+#ifndef NINVADERS_MIRROR
+#define NINVADERS_MIRROR 1
+#endif
+
+/* Every game is recorded (see record.h) into a buffer of this many key
+events; pressing 'D' writes the recording to GAME_RECORD_UART. If
+NINVADERS_REPLAY is defined, the game instead waits for a recording to
+be pasted into GAME_RECORD_UART at startup, and replays it.
+
+The 'D', 'H' and 'T' dumps are written a few lines per frame while the
+game goes on. The spectator mirror pauses meanwhile, and is drawn again
+from scratch when the dump is done. */
+#ifndef NINVADERS_RECORD_EVENTS
+#define NINVADERS_RECORD_EVENTS 1024
+#endif
+
+/* The high score table (see highscore.h) is kept in the key-value store
+in the region the linker script reserves between __KVStoreBase and
+__KVStoreTop, split into sectors of this many bytes. Pressing 'H'
+writes the table to GAME_RECORD_UART. */
+#define GAME_KVSTORE_SECTOR 1024
 
 
 /* Dimensions the buffer that the task being created will use as its
 stack. NOTE: This is the number of words the stack will hold, not the
 number of bytes. For example, if each stack item is 32-bits, and this
 is set to 100, then 400 bytes (100 * 32-bits) will be allocated. */
-#define NINVADERS_STACK_SIZE 256
+#define NINVADERS_STACK_SIZE 1024
+
+/* Priority of the game task. It should be below the audio mixer, so
+that a busy frame cannot cause an underrun. */
+#ifndef NINVADERS_PRIORITY
+#define NINVADERS_PRIORITY 3
+#endif
 
 /* Structure that will hold the TCB of the task being created. */
 extern StaticTask_t nInvaders_TCB;
@@ -48,24 +88,17 @@ is an array of StackType_t variables. The size of StackType_t is
 dependent on the RTOS port. */
 extern StackType_t nInvaders_stack[ NINVADERS_STACK_SIZE ];
 
-#define UFO_ALIEN_TYPE   0
-#define RED_ALIEN_TYPE   1
-#define GREEN_ALIEN_TYPE 2
-#define BLUE_ALIEN_TYPE  3 
-
 void ninvaders(void *pvParameters);	// hey! it has to start somewhere!
 
+// events that wake the game task between frames
+typedef enum {
+	GAME_EVENT_INPUT,	// characters arrived on the game UART
+	GAME_EVENT_BUTTONS	// a board push button changed
+} GameEvent;
+
 extern void render(void);
 	
 void game_over(int a);
-void drawscore();
-		
-void doScoring(int alienType);
-
-// todo: let's try to not having to declare these "public"
-extern int weite;
-extern int level;
-extern int skill_level;
 	
 // included from globals.h
 extern void doSleep();
@@ -25,8 +25,8 @@
 #include "player.h"
 #include "aliens.h"
 #include "ufo.h"
-#include "nInvaders.h"
-#include <sound_effects.h>
+#include "game.h"
+#include "sound.h"
 
 typedef struct Player Player;
 
@@ -37,10 +37,13 @@ struct Player {
 	int missileFired; // 0: missile not running; 1: missile running
 	int missileX;	  // horizontal position of missile
 	int missileY;	  // vertical position of missile
+	int explosion;	  // steps left in the explosion animation, 0: none
 };
        
 Player player;
 
+#define EXPLOSION_FRAME_STEPS 3		// steps each frame is shown (about 100ms)
+
 /**
  * initialize player attributes
  */
@@ -151,7 +154,7 @@ void playerLaunchMissile()
 {
 	// only launch missile if no other is on its way
 	if (player.missileFired == 0) {
-		xEventGroupSetBits(effect_events, SHOOT_EVENT);
+		soundPlay(SOUND_SHOOT);
 		player.missileFired = 1;	// missile is on its way
 		player.missileX = player.posX + PLAYERWIDTH / 2;	// launched from the middle of player...
 		player.missileY = PLAYERPOSY;	// ...at same horizontal position
@@ -207,9 +210,9 @@ int playerMoveMissile()
 			}
 			
 			// speed of aliens
-			weite = (shipnum + (skill_level * 10) - (level * 5) + 5) / 10;
-			if (weite < 0) {
-				weite = 0;
+			game.weite = (shipnum + (game.skillLevel * 10) - (game.level * 5) + 5) / 10;
+			if (game.weite < 0) {
+				game.weite = 0;
 			}
 			
 			playerMissileClear(player.missileX, player.missileY);	// clear old missile position
@@ -234,9 +237,32 @@ int playerMoveMissile()
 }
 
 /** 
- * let player explode
+ * let player explode: start the explosion animation, which is played
+ * by playerExplosionStep()
  */
 void playerExplode(){
+	player.explosion = EXPLOSION_FRAMES * EXPLOSION_FRAME_STEPS;
 	playerExplosionDisplay(player.posX, player.posY);
-	playerDisplay(player.posX, player.posY);
+}
+
+
+/**
+ * advance the explosion animation by one step
+ * returns 1 while the explosion is still running
+ */
+int playerExplosionStep()
+{
+	if (player.explosion == 0) {
+		return 0;
+	}
+
+	player.explosion--;
+	if (player.explosion == 0) {
+		playerDisplay(player.posX, player.posY);	// back to normal
+		return 0;
+	}
+	if (player.explosion % EXPLOSION_FRAME_STEPS == 0) {
+		playerExplosionDisplay(player.posX, player.posY);	// next frame
+	}
+	return 1;
 }
@@ -38,6 +38,7 @@ int playerHitCheck(int hostileShotX, int hostileShotY);
 void playerLaunchMissile();
 int playerMoveMissile();
 void playerExplode();
+int playerExplosionStep();
 	
 // methods that handle graphic display, from view.c
 extern void playerInit();
@@ -49,7 +50,6 @@ extern void playerMissileClear(int x, int y);
 extern void playerExplosionDisplay(int x, int y);
 extern void bunkersClearElement(int x, int y);
 
-extern void doScoring(int alienType);
 	
 #endif
 
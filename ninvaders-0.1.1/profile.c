@@ -0,0 +1,96 @@
+#include "profile.h"
+
+#if NINVADERS_PROFILE
+
+#include <FreeRTOS.h>
+#include <cycle_counter.h>
+
+static const char *phaseNames[PROFILE_PHASES] = {
+	"aliens", "alien shots", "player shot", "ufo", "render", "mirror"
+};
+
+static ProfileStats current[PROFILE_PHASES];	// the window being collected
+static ProfileStats last[PROFILE_PHASES];	// the last full window
+static int frames;
+
+
+/**
+ * turn on the DWT cycle counter in the Cortex-M3 debug block
+ */
+void profileInit()
+{
+	cycle_counter_enable();
+}
+
+
+/**
+ * the running cycle count (it is never reset and wraps every 86 s, but only
+ * differences are used)
+ */
+uint32_t profileClock()
+{
+	return DWT->CYCCNT;
+}
+
+
+/**
+ * record a phase when the scope timing it is left
+ */
+void profileScopeEnd(ProfileScope *scope)
+{
+	uint32_t cycles = DWT->CYCCNT - scope->start;
+	ProfileStats *stats = &current[scope->phase];
+	int bucket = cycles ? 32 - __builtin_clz(cycles) : 0;
+
+	if (bucket >= PROFILE_BUCKETS) {
+		bucket = PROFILE_BUCKETS - 1;
+	}
+	stats->histogram[bucket]++;
+	stats->count++;
+	stats->total += cycles;
+	if (cycles > stats->worst) {
+		stats->worst = cycles;
+	}
+}
+
+
+/**
+ * count a frame; every PROFILE_WINDOW frames the window is closed and
+ * a new one started
+ */
+void profileFrame()
+{
+	int phase;
+
+	if (++frames < PROFILE_WINDOW) {
+		return;
+	}
+	for (phase = 0; phase < PROFILE_PHASES; phase++) {
+		last[phase] = current[phase];
+		current[phase] = (ProfileStats) { 0 };
+	}
+	frames = 0;
+}
+
+
+/**
+ * copy the statistics of a phase for the last full window
+ */
+void profileGetStats(ProfilePhase phase, ProfileStats *stats)
+{
+	*stats = last[phase];
+}
+
+
+const char *profilePhaseName(ProfilePhase phase)
+{
+	return phaseNames[phase];
+}
+
+
+uint32_t profileMicroseconds(uint32_t cycles)
+{
+	return cycles / (configCPU_CLOCK_HZ / 1000000);
+}
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef PROFILE
+#define PROFILE
+
+#include <stdint.h>
+
+/**
+ * Frame time profiler. Each phase of a frame is timed with the
+ * Cortex-M3 cycle counter by putting PROFILE_SCOPE(phase) at the top of
+ * the block that runs it; the time is recorded when the block is left.
+ * Every phase keeps a histogram (one bucket per power of two cycles),
+ * its total and its worst time over a window of PROFILE_WINDOW frames,
+ * and the last full window can be read or printed while the next one
+ * is collected.
+ *
+ * The profiler is built for the target only. On other builds (the host
+ * benchmarks) PROFILE_SCOPE is empty.
+ */
+
+#ifndef NINVADERS_PROFILE
+#ifdef __arm__
+#define NINVADERS_PROFILE 1
+#else
+#define NINVADERS_PROFILE 0
+#endif
+#endif
+
+typedef enum {
+	PROFILE_ALIENS_MOVE,
+	PROFILE_ALIENS_MISSILE,
+	PROFILE_PLAYER_MISSILE,
+	PROFILE_UFO,
+	PROFILE_RENDER,
+	PROFILE_MIRROR,
+	PROFILE_PHASES
+} ProfilePhase;
+
+#define PROFILE_BUCKETS 16	// bucket b: 2^(b-1) to 2^b - 1 cycles, the last is open
+#define PROFILE_WINDOW 125	// frames per window (5 s)
+
+typedef struct ProfileStats ProfileStats;
+
+struct ProfileStats {
+	uint32_t count;		// times the phase ran in the window
+	uint32_t total;		// cycles
+	uint32_t worst;		// cycles
+	uint16_t histogram[PROFILE_BUCKETS];
+};
+
+#if NINVADERS_PROFILE
+
+typedef struct ProfileScope ProfileScope;
+
+struct ProfileScope {
+	ProfilePhase phase;
+	uint32_t start;
+};
+
+void profileInit();
+void profileScopeEnd(ProfileScope *scope);
+uint32_t profileClock();
+void profileFrame();
+void profileGetStats(ProfilePhase phase, ProfileStats *stats);
+const char *profilePhaseName(ProfilePhase phase);
+uint32_t profileMicroseconds(uint32_t cycles);
+
+#define PROFILE_SCOPE(phase) \
+	ProfileScope profileScope __attribute__((cleanup(profileScopeEnd))) = { phase, profileClock() }
+
+#else
+
+#define PROFILE_SCOPE(phase)
+
+#endif
+
+#endif
@@ -0,0 +1,141 @@
+#include <stdio.h>
+#include <string.h>
+#include "record.h"
+#include "game.h"
+
+/**
+ * start a new game and record it
+ */
+void recordStart(Recording *rec, RecordEvent *buffer, int capacity,
+		 int skillLevel, uint32_t seed)
+{
+	rec->seed = seed;
+	rec->skillLevel = skillLevel;
+	rec->frames = 0;
+	rec->count = 0;
+	rec->capacity = capacity;
+	rec->overflow = 0;
+	rec->events = buffer;
+	gameInit(skillLevel, seed);
+}
+
+
+/**
+ * hand a key to the game and record it
+ */
+void recordInput(Recording *rec, int key)
+{
+	// "no key" only matters while turbo mode may be on; leaving the
+	// others out keeps the recording short
+	int changesGame = key != GAME_NO_KEY || game.lastMove != ' ';
+
+	if (changesGame) {
+		if (rec->count < rec->capacity) {
+			rec->events[rec->count].frame = game.frame;
+			rec->events[rec->count].key = key;
+			rec->count++;
+		} else {
+			rec->overflow = 1;
+		}
+	}
+	gameInput(key);
+}
+
+
+/**
+ * step the game and record the length of the session
+ */
+void recordStep(Recording *rec)
+{
+	gameStep(GAME_NO_KEY);
+	if (!rec->overflow) {
+		rec->frames = game.frame;
+	}
+}
+
+
+/**
+ * start the recorded game
+ */
+void replayStart(Replay *replay, const Recording *rec)
+{
+	replay->recording = rec;
+	replay->next = 0;
+	gameInit(rec->skillLevel, rec->seed);
+}
+
+
+/**
+ * hand the keys recorded for this frame to the game, then step it
+ * returns 0 when the recording is over
+ */
+int replayStep(Replay *replay)
+{
+	const Recording *rec = replay->recording;
+
+	if (game.frame >= rec->frames) {
+		return 0;
+	}
+	while (replay->next < rec->count && rec->events[replay->next].frame == game.frame) {
+		gameInput(rec->events[replay->next].key);
+		replay->next++;
+	}
+	gameStep(GAME_NO_KEY);
+	return 1;
+}
+
+
+/**
+ * write line n of the text form of a recording
+ */
+int recordFormat(const Recording *rec, int n, char *buffer, int size)
+{
+	if (n == 0) {
+		snprintf(buffer, size, "nInvaders-record %lu %d %lu %d\n",
+			 (unsigned long)rec->seed, rec->skillLevel,
+			 (unsigned long)rec->frames, rec->count);
+	} else if (n <= rec->count) {
+		snprintf(buffer, size, "%lu %d\n",
+			 (unsigned long)rec->events[n - 1].frame, rec->events[n - 1].key);
+	} else if (n == rec->count + 1) {
+		snprintf(buffer, size, "end\n");
+	} else {
+		return 0;
+	}
+	return 1;
+}
+
+
+/**
+ * read one line of the text form of a recording
+ */
+int recordParse(Recording *rec, const char *line)
+{
+	unsigned long seed, frames, frame;
+	int skillLevel, count, key;
+
+	if (sscanf(line, "nInvaders-record %lu %d %lu %d", &seed, &skillLevel, &frames, &count) == 4) {
+		rec->seed = seed;
+		rec->skillLevel = skillLevel;
+		rec->frames = frames;
+		rec->count = 0;
+		rec->overflow = count > rec->capacity;
+		return 0;
+	}
+	if (strncmp(line, "end", 3) == 0) {
+		if (rec->overflow && rec->count > 0) {
+			// stop before the first frame with missing keys
+			rec->frames = rec->events[rec->count - 1].frame;
+		}
+		return 1;
+	}
+	if (sscanf(line, "%lu %d", &frame, &key) == 2) {
+		if (rec->count < rec->capacity) {
+			rec->events[rec->count].frame = frame;
+			rec->events[rec->count].key = key;
+			rec->count++;
+		}
+		return 0;
+	}
+	return -1;
+}
@@ -0,0 +1,67 @@
+#ifndef RECORD
+#define RECORD
+
+#include <stdint.h>
+
+/**
+ * Recording and replay of games. A game is fully determined by its
+ * seed and the keys handed to gameInput() before each step, so a
+ * recording is just that: the seed and skill level, followed by a list
+ * of (frame, key) events. Replaying it reproduces the session frame
+ * for frame, with the same work done in each frame.
+ *
+ * As text, a recording is a header line followed by one line per event
+ * and an end line:
+ *
+ *	nInvaders-record <seed> <skill level> <frames> <events>
+ *	<frame> <key>
+ *	...
+ *	end
+ */
+
+typedef struct RecordEvent RecordEvent;
+
+struct RecordEvent {
+	uint32_t frame;		// game.frame when the key was handled
+	int key;		// key, or GAME_NO_KEY
+};
+
+typedef struct Recording Recording;
+
+struct Recording {
+	uint32_t seed;
+	int skillLevel;
+	uint32_t frames;	// length of the session
+	int count;		// events recorded
+	int capacity;		// size of events
+	int overflow;		// set if events were lost, replay will differ
+	RecordEvent *events;
+};
+
+typedef struct Replay Replay;
+
+struct Replay {
+	const Recording *recording;
+	int next;		// next event to apply
+};
+
+// record: use these instead of gameInit(), gameInput() and gameStep()
+void recordStart(Recording *rec, RecordEvent *buffer, int capacity,
+		 int skillLevel, uint32_t seed);
+void recordInput(Recording *rec, int key);
+void recordStep(Recording *rec);
+
+// replay: start the game from the recording, then step it until
+// replayStep() returns 0
+void replayStart(Replay *replay, const Recording *rec);
+int replayStep(Replay *replay);
+
+// text form: recordFormat() writes line n (0 is the header) into
+// buffer and returns 0 after the end line. recordParse() reads one
+// line at a time into rec, which must have its events buffer and
+// capacity set, and returns 1 when the end line was read, 0 while
+// more lines are needed and -1 on a bad line.
+int recordFormat(const Recording *rec, int n, char *buffer, int size);
+int recordParse(Recording *rec, const char *line);
+
+#endif
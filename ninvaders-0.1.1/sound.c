@@ -0,0 +1,52 @@
+#include "sound.h"
+#include <sound_effects.h>
+#include <synth.h>
+
+// effect event for each sound
+static const EventBits_t soundEvents[] = {
+	EXPLOSION1_EVENT,
+	INVADERKILLED_EVENT,
+	SHOOT_EVENT,
+	UFO_LOWPITCH_EVENT,
+	FASTINVADER1_EVENT,
+	FASTINVADER2_EVENT,
+	FASTINVADER3_EVENT,
+	FASTINVADER4_EVENT
+};
+
+// The ufo hum is played on its own synth voice.
+#define UFO_VOICE 0
+#define UFO_AMPLITUDE 64
+static const synth_envelope_t ufoEnvelope = {20, 0, 255, 80};
+
+/**
+ * play a sound effect
+ */
+void soundPlay(Sound sound)
+{
+	effect_trigger(soundEvents[sound]);
+}
+
+/**
+ * start the ufo hum
+ */
+void soundUfoOn(int freq)
+{
+	synth_note_on(UFO_VOICE, SYNTH_SQUARE, freq, UFO_AMPLITUDE, &ufoEnvelope);
+}
+
+/**
+ * change the pitch of the ufo hum
+ */
+void soundUfoFreq(int freq)
+{
+	synth_set_freq(UFO_VOICE, freq);
+}
+
+/**
+ * stop the ufo hum
+ */
+void soundUfoOff()
+{
+	synth_note_off(UFO_VOICE);
+}
@@ -0,0 +1,27 @@
+#ifndef SOUND
+#define SOUND
+
+/**
+ * The sounds the game makes. The game calls these rather than the
+ * audio driver, so that the simulation core runs without one.
+ */
+
+typedef enum {
+	SOUND_EXPLOSION,
+	SOUND_INVADER_KILLED,
+	SOUND_SHOOT,
+	SOUND_PAUSE,
+	SOUND_MARCH1,		// the aliens' four step march
+	SOUND_MARCH2,
+	SOUND_MARCH3,
+	SOUND_MARCH4
+} Sound;
+
+void soundPlay(Sound sound);
+
+// the ufo hum, a tone that follows the ufo across the screen
+void soundUfoOn(int freq);
+void soundUfoFreq(int freq);
+void soundUfoOff();
+
+#endif
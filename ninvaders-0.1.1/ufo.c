@@ -24,12 +24,24 @@
 
 #include "ufo.h"
 #include "aliens.h"
-#include "nInvaders.h"
-#include <sound_effects.h>
+#include "game.h"
+#include "sound.h"
 
 static int fShowUfo = 0;
 Ufo ufo;
 
+// The pitch of the ufo hum rises as the ufo crosses the screen from
+// right to left.
+#define UFO_FREQ_LOW  200
+#define UFO_FREQ_HIGH 400
+#define UFO_FREQ_STEP 4
+static int ufoBaseFreq = UFO_FREQ_LOW;
+
+static int ufoFreq(int posX)
+{
+	return ufoBaseFreq + (SCREENWIDTH - posX) * UFO_FREQ_STEP;
+}
+
 /**
  * initialize ufo attributes
  */
@@ -38,6 +50,7 @@ void ufoReset()
 	ufoClear(ufo.posX, ufo.posY);	// clear old position of player
 
 	fShowUfo = 0;                   // do not show ufo
+	soundUfoOff();
 	ufo.posY = UFOPOSY;	        // set vertical Position
 	ufo.posX = SCREENWIDTH - UFOWIDTH;// set horizontal Position
 }
@@ -49,6 +62,7 @@ static void ufoMove(int posX)
 {
 	ufoClear(ufo.posX, ufo.posY);   // clear sprite
 	ufo.posX = posX;
+	soundUfoFreq(ufoFreq(posX));
 	ufoRefresh();
 	ufoDisplay(ufo.posX, ufo.posY);
 }
@@ -75,11 +89,12 @@ void ufoMoveLeft()
 int ufoShowUfo()
 {
 	if (aliens.posY > 0 && fShowUfo == 0) { // aliens one line down
-		if ((random() % 200) == 0) {
-			if(random() % 2 == 0)
-				xEventGroupSetBits(effect_events, UFO_LOWPITCH_EVENT);
+		if ((gameRandom() % 200) == 0) {
+			if(gameRandom() % 2 == 0)
+				ufoBaseFreq = UFO_FREQ_LOW;
 			else
-				xEventGroupSetBits(effect_events, UFO_HIGHPITCH_EVENT);
+				ufoBaseFreq = UFO_FREQ_HIGH;
+			soundUfoOn(ufoFreq(ufo.posX));
 
 			fShowUfo = 1;
 		}
@@ -24,7 +24,10 @@
 
 #include "view.h"
 #include "globals.h"
+#include "mirror.h"
+#include "highscore.h"
 #include <stdlib.h>	
+#include <string.h>
 #include <unistd.h>
 #include <signal.h>
 
@@ -36,12 +39,52 @@
 #define MAGENTA 6
 #define WHITE 7
 
+/**
+ * Sprite cache: every pad is created once by graphicEngineInit and
+ * redrawn in place, so curses allocates no memory while the game runs.
+ * The heap comes from newlib's sbrk, which never shrinks, so a pad made
+ * per explosion or per title frame would leak or fragment it over a
+ * long session.
+ */
+#define EXPLOSION_SPRITES 8	// precomputed explosion frames
+
+/**
+ * Sprite tables: the animated sprites are stored ready to blit, as
+ * runs of chtypes with their colour already in them. They are const,
+ * so they stay in flash, and each row of a sprite pad is written with
+ * a single spriteBlit instead of a wattrset and a waddch per cell.
+ */
+#define S3(a, b, c, color) \
+	{ (a) | COLOR_PAIR(color), (b) | COLOR_PAIR(color), (c) | COLOR_PAIR(color) }
+#define S5(a, b, c, d, e, color) \
+	{ (a) | COLOR_PAIR(color), (b) | COLOR_PAIR(color), (c) | COLOR_PAIR(color), \
+	  (d) | COLOR_PAIR(color), (e) | COLOR_PAIR(color) }
+
+// [animation frame][alien type - 1 + 3 * (level - 1) % 3][cell]
+// the shape changes with the level, the colour only with the type
+static const chtype alienSprites[2][9][3] = {
+	{ S3(',','^',',', RED),    S3('_','O','-', GREEN),  S3('-','o','-', BLUE),
+	  S3('o','=','o', RED),    S3('<','O','>', GREEN),  S3('_','x','_', BLUE),
+	  S3('*','^','*', RED),    S3('\\','_','/', GREEN), S3('o',' ','o', BLUE) },
+	{ S3('.','-','.', RED),    S3('-','O','_', GREEN),  S3('/','o','\\', BLUE),
+	  S3('o','-','o', RED),    S3('<','o','>', GREEN),  S3('-','x','-', BLUE),
+	  S3('o','^','o', RED),    S3('/','~','\\', GREEN), S3('o','o',' ', BLUE) }
+};
+
+static const chtype ufoSprites[4][UFOWIDTH] = {
+	S5('<','o',' ','o','>', MAGENTA), S5('<','o','o',' ','>', MAGENTA),
+	S5('<','o',' ','o','>', MAGENTA), S5('<',' ','o','o','>', MAGENTA)
+};
+
+static const chtype blankCells[3] = { ' ', ' ', ' ' };
+
 WINDOW *wBattleField;
 WINDOW *wEmpty;
 WINDOW *wScores;	
 
 WINDOW *wPlayer;
 WINDOW *wPlayerMissile;
+WINDOW *wPlayerExplosion[EXPLOSION_SPRITES];
 WINDOW *wAliens;
 WINDOW *wAliensMissile;	
 WINDOW *wBunkers;
@@ -49,6 +92,81 @@ WINDOW *wGameOver;
 WINDOW *wUfo;
 WINDOW *wStatus;
 WINDOW *wTitleScreen;
+WINDOW *wTitleText;
+WINDOW *wTitleAliens;
+WINDOW *wStartText;
+WINDOW *wTitleScores;
+
+#define TITLE_SCORES_WIDTH 54	// two columns of the high score table
+#define TITLE_SCORES_HEIGHT 6
+
+/**
+ * The terminal is only sent the cells that changed since the last
+ * refresh. Every sprite drawn on the battlefield marks the span of each
+ * line it covers as dirty, and refreshScreen hands curses just those
+ * spans; doupdate then compares them with its own copy of the screen
+ * and sends the cells that differ.
+ */
+static int dirtyFirst[SCREENHEIGHT];			// dirty span of each line,
+static int dirtyLast[SCREENHEIGHT];			// first > last if clean
+static int fullRedraw = 1;				// send everything on the next refresh
+
+static Mirror *mirror;		// second terminal showing the battlefield, if any
+
+/**
+ * mark the rectangle (x1, y1) - (x2, y2) of the battlefield as dirty
+ */
+static void battleFieldMarkDirty(int y1, int x1, int y2, int x2)
+{
+	int y;
+
+	if (x1 < 0) x1 = 0;
+	if (x2 > SCREENWIDTH - 1) x2 = SCREENWIDTH - 1;
+	if (y1 < 0) y1 = 0;
+	if (y2 > SCREENHEIGHT - 1) y2 = SCREENHEIGHT - 1;
+
+	for (y = y1; y <= y2; y++) {
+		if (x1 < dirtyFirst[y]) dirtyFirst[y] = x1;
+		if (x2 > dirtyLast[y]) dirtyLast[y] = x2;
+	}
+	if (mirror != NULL) {
+		mirrorMarkDirty(mirror, y1, x1, y2, x2);
+	}
+}
+
+
+/**
+ * copy part of a sprite pad onto the battlefield and mark it dirty
+ */
+static void battleFieldBlit(WINDOW *src, int srcY, int srcX, int y1, int x1, int y2, int x2)
+{
+	copywin(src, wBattleField, srcY, srcX, y1, x1, y2, x2, 0);
+	battleFieldMarkDirty(y1, x1, y2, x2);
+}
+
+
+/**
+ * write a run of n ready made cells into row y of a pad, starting at
+ * column x, in one call
+ */
+static void spriteBlit(WINDOW *pad, int y, int x, const chtype *cells, int n)
+{
+	mvwaddchnstr(pad, y, x, cells, n);
+}
+
+
+/**
+ * mark every line of the battlefield clean
+ */
+static void battleFieldMarkClean()
+{
+	int y;
+
+	for (y = 0; y < SCREENHEIGHT; y++) {
+		dirtyFirst[y] = SCREENWIDTH;
+		dirtyLast[y] = -1;
+	}
+}
 
 /**
  * initialize player sprites
@@ -67,7 +185,7 @@ static void playerInit()
  */
 void playerDisplay(int x, int y) 
 {
-	copywin(wPlayer,wBattleField,0,0,y,x,y,x+PLAYERWIDTH-1,0);
+	battleFieldBlit(wPlayer, 0, 0, y, x, y, x+PLAYERWIDTH-1);
 }
 
 
@@ -76,7 +194,7 @@ void playerDisplay(int x, int y)
  */
 void playerClear(int x, int y) 
 {
-	copywin(wEmpty,wBattleField,0,0,y,x,y,x+PLAYERWIDTH-1,0);
+	battleFieldBlit(wEmpty, 0, 0, y, x, y, x+PLAYERWIDTH-1);
 }
 
 
@@ -98,7 +216,7 @@ static void playerMissileInit()
  */
 void playerMissileDisplay(int x, int y) 
 {
-	copywin(wPlayerMissile,wBattleField,0,0,y,x,y,x,0);
+	battleFieldBlit(wPlayerMissile, 0, 0, y, x, y, x);
 }
 
 
@@ -107,35 +225,51 @@ void playerMissileDisplay(int x, int y)
  */
 void playerMissileClear(int x, int y) 
 {
-	copywin(wEmpty,wBattleField,0,0,y,x,y,x,0);
+	battleFieldBlit(wEmpty, 0, 0, y, x, y, x);
 }
 
 
 /**
- * some explosion animation
+ * random numbers for the explosion sprite. The view has its own
+ * generator, so that drawing does not change the game's numbers.
  */
-void playerExplosionDisplay(int x, int y)
+static int explosionRandom()
+{
+	static unsigned int state = 1;
+
+	state = state * 1103515245 + 12345;
+	return (state >> 16) & 0x7fff;
+}
+
+
+/**
+ * initialize explosion sprites: a few random frames, drawn once
+ */
+static void playerExplosionInit()
 {
-	WINDOW* wPlayerExplosion;
 	char playerExplosionChars[16+1]="@~`.,^#*-_=\\/%{}";
 	int t,s;
-	
-	wPlayerExplosion=newpad(1,PLAYERWIDTH);		// new pad
-	wattrset(wPlayerExplosion,COLOR_PAIR(YELLOW));	// set color
-	
-	for(t=0;t<5;t++){ 			// 5 frames
-		wclear(wPlayerExplosion);	// clear pad
+
+	for(t=0;t<EXPLOSION_SPRITES;t++){
+		wPlayerExplosion[t]=newpad(1,PLAYERWIDTH);		// new pad
+		wclear(wPlayerExplosion[t]);				// clear pad
+		wattrset(wPlayerExplosion[t],COLOR_PAIR(YELLOW));	// set color
 		for(s=0;s<PLAYERWIDTH;s++){
-			waddch(wPlayerExplosion,playerExplosionChars[rand()%16]);	// sprite
+			waddch(wPlayerExplosion[t],playerExplosionChars[explosionRandom()%16]);	// sprite
 		}
-
-		copywin(wPlayerExplosion,wBattleField,0,0,y,x,y,x+PLAYERWIDTH-1,0); 	// display explostion
-		wrefresh(wBattleField); 	// refresh battelfield to display explosion frames
-		doSleep(100000);		// play animation not too fast
 	}
-	
+}
 
-} // todo: kann man bestimmt noch besser machen.
+
+/**
+ * display one frame of the explosion animation
+ */
+void playerExplosionDisplay(int x, int y)
+{
+	WINDOW *frame = wPlayerExplosion[explosionRandom() % EXPLOSION_SPRITES];
+
+	battleFieldBlit(frame, 0, 0, y, x, y, x+PLAYERWIDTH-1); 	// display explostion
+}
 
 
 /**
@@ -153,7 +287,7 @@ static void aliensInit()
  */
 void aliensDisplay(int x, int y, int wid, int hgt) 
 {
-	copywin(wAliens,wBattleField,0,0,y,x,y+hgt,x+wid+2,0);
+	battleFieldBlit(wAliens, 0, 0, y, x, y+hgt, x+wid+2);
 }
 
 
@@ -162,7 +296,7 @@ void aliensDisplay(int x, int y, int wid, int hgt)
  */
 void aliensClear(int x, int y, int wid, int hgt) 
 {
-	copywin(wEmpty,wBattleField,0,0,y,x,y+hgt,x+wid+2,0);
+	battleFieldBlit(wEmpty, 0, 0, y, x, y+hgt, x+wid+2);
 }
 
 
@@ -183,7 +317,7 @@ static void aliensMissileInit()
  */
 void aliensMissileDisplay(int x, int y) 
 {
-	copywin(wAliensMissile,wBattleField,0,0,y,x,y,x,0);
+	battleFieldBlit(wAliensMissile, 0, 0, y, x, y, x);
 }
 
 
@@ -192,53 +326,33 @@ void aliensMissileDisplay(int x, int y)
  */
 void aliensMissileClear(int x, int y) 
 {
-	copywin(wEmpty,wBattleField,0,0,y,x,y,x,0);
+	battleFieldBlit(wEmpty, 0, 0, y, x, y, x);
 }
 
 
 /**
  * refresh aliens sprite
  */
-void aliensRefresh(int level, int *pAliens) 
+void aliensRefresh(int level, AlienBoard *board) 
 {
 	static int frame = 0; // used for animation; mod 2 == 0: frame1, mod2 == 1: frame2
-	int k,row;
-	int c = 0;
+	static chtype line[ALIENS_MAX_NUMBER_X*3];
+	const chtype (*ships)[3];
+	int k, c;
 	int alienType = 0;
-	char ships[2][9][3+1] = {
-		{",^,", "_O-", "-o-",  "o=o", "<O>", "_x_", "*^*", "\\_/", "o o"},
-		{".-.", "-O_", "/o\\", "o-o", "<o>", "-x-", "o^o", "/~\\", "oo "}
-	};
-	int colors[9] = {RED, GREEN, BLUE, RED, YELLOW, WHITE, WHITE, YELLOW, RED};
 
-	wclear(wAliens);						// clear pad
-	wattrset(wAliens,COLOR_PAIR(RED));				// set color
-	
 	frame++;						// next frame
+	ships = &alienSprites[frame%2][3*((level-1)%3)];	// this level's ships
 	
-	// draw alien if there is one
-	for (row = 0; row < ALIENS_MAX_NUMBER_Y*2; row++) {			
+	// aliens are on the even rows; the odd rows were cleared once by
+	// aliensInit and stay empty
+	for (c = 0; c < ALIENS_MAX_NUMBER_Y; c++) {
 		for (k = 0; k < ALIENS_MAX_NUMBER_X; k++) {
-			if ((row % 2) == 0) {			// display aliens every even row
-				alienType = *(pAliens + c * (ALIENS_MAX_NUMBER_X) + k); 	// get type of alien //alienBlock[c][k]
-				
-				if (alienType != 0) {		// if there is an alien to display
-					wattrset(wAliens,COLOR_PAIR(colors[alienType-1]));		   // set color
-					waddch(wAliens,ships[frame%2][alienType-1+(3*((level-1)%3))][0]);  // set char1
-					waddch(wAliens,ships[frame%2][alienType-1+(3*((level-1)%3))][1]);  // set char2
-					waddch(wAliens,ships[frame%2][alienType-1+(3*((level-1)%3))][2]);  // set char3
-					if (alienType > 4) {
-						*(pAliens + c * ALIENS_MAX_NUMBER_X + k) = (alienType + 1) % 9;
-					} // todo: what's that? If alien_type > 4 then do a modulo operation???
-				} else {
-					waddstr(wAliens,"   ");	// no alien
-				}
-				
-			} else {
-				waddstr(wAliens,"   ");		// no aliens at odd rows
-			}
+			alienType = alienBoardType(board, k, c); 	// get type of alien
+			memcpy(&line[k*3], alienType != 0 ? ships[alienType-1] : blankCells,
+			       sizeof(blankCells));
 		}
-		if ((row % 2) == 1) {c++;} // goto next row at alienblock
+		spriteBlit(wAliens, c*2, 0, line, ALIENS_MAX_NUMBER_X*3);
 	}
 }
 
@@ -257,14 +371,14 @@ static void bunkersInit()
  * display bunkers sprite
  * needs pointer to bunker-array
  */
-void bunkersDisplay(int *pBunker) 
+void bunkersDisplay(uint32_t *pBunker) 
 {
 	int l, k;
 	wclear(wBunkers);
 	wattrset(wBunkers,COLOR_PAIR(CYAN));
 	for (l=0;l<BUNKERHEIGHT;l++) {
 		for (k=0;k<BUNKERWIDTH;k++) {
-			if (*(pBunker + (l * (BUNKERWIDTH + 1)) + k) == 1) {	//if (pBunker[l][k]==1) {
+			if (bitboardTest(pBunker + l * BUNKER_WORDS, k)) {	//if (pBunker[l][k]==1) {
 				waddch(wBunkers,'#');
 			} else {
 				waddch(wBunkers,' ');
@@ -272,7 +386,7 @@ void bunkersDisplay(int *pBunker)
 		}	
 	}
 	
-	copywin(wBunkers, wBattleField, 0, 0, BUNKERY, BUNKERX, BUNKERY + BUNKERHEIGHT - 1, BUNKERX + BUNKERWIDTH - 1, 0);
+	battleFieldBlit(wBunkers, 0, 0, BUNKERY, BUNKERX, BUNKERY + BUNKERHEIGHT - 1, BUNKERX + BUNKERWIDTH - 1);
 }
 
 
@@ -281,7 +395,7 @@ void bunkersDisplay(int *pBunker)
  */
 void bunkersClear() 
 {
-	copywin(wEmpty, wBattleField, 0, 0, BUNKERY, BUNKERX, BUNKERY + BUNKERHEIGHT - 1, BUNKERX + BUNKERWIDTH - 1, 0);
+	battleFieldBlit(wEmpty, 0, 0, BUNKERY, BUNKERX, BUNKERY + BUNKERHEIGHT - 1, BUNKERX + BUNKERWIDTH - 1);
 }
 
 
@@ -290,7 +404,7 @@ void bunkersClear()
  */
 void bunkersClearElement(int x, int y) 
 {
-	copywin(wEmpty, wBattleField, 0, 0, y, x, y, x, 0);
+	battleFieldBlit(wEmpty, 0, 0, y, x, y, x);
 }
 
 
@@ -299,12 +413,9 @@ void bunkersClearElement(int x, int y)
  */
 void ufoRefresh()
 {
-	char ufo[4][6] = {"<o o>", "<oo >", "<o o>", "< oo>"};
 	static int frame = 0;
 
-	wclear(wUfo);
-        wattrset(wUfo, COLOR_PAIR(MAGENTA));
-	waddstr(wUfo, ufo[frame % 4]);
+	spriteBlit(wUfo, 0, 0, ufoSprites[frame % 4], UFOWIDTH);
 
 	frame++;
 }
@@ -326,7 +437,7 @@ static void ufoInit()
  */
 void ufoDisplay(int x, int y)
 {
-	copywin(wUfo, wBattleField, 0, 0, y, x, y, x + UFOWIDTH - 1, 0);
+	battleFieldBlit(wUfo, 0, 0, y, x, y, x + UFOWIDTH - 1);
 }
 
 
@@ -335,7 +446,7 @@ void ufoDisplay(int x, int y)
  */
 void ufoClear(int x, int y) 
 {
-	copywin(wEmpty, wBattleField, 0, 0, y, x, y, x + UFOWIDTH - 1, 0);
+	battleFieldBlit(wEmpty, 0, 0, y, x, y, x + UFOWIDTH - 1);
 }
 
 
@@ -370,8 +481,8 @@ void gameOverDisplay()
 {
 	int x = (SCREENWIDTH / 2) - (31 / 2);
 	int y = (SCREENHEIGHT / 2) - (13 / 2);
-	copywin(wGameOver, wBattleField, 0, 0, y, x, y + 12, x + 30, 0);
-	wrefresh(wBattleField);
+	battleFieldBlit(wGameOver, 0, 0, y, x, y + 12, x + 30);
+	refreshScreen();
 }
 
 
@@ -382,6 +493,49 @@ static void titleScreenInit()
 {
 	wTitleScreen = newpad(SCREENHEIGHT, SCREENWIDTH);
 	wclear(wTitleScreen);
+
+	wTitleText = newpad(4, 41);
+	wclear(wTitleText);
+	wattrset(wTitleText, COLOR_PAIR(YELLOW));
+	waddstr(wTitleText, "        ____                 __          ");
+	waddstr(wTitleText, "  ___  /  _/__ _  _____  ___/ /__ _______");
+        waddstr(wTitleText, " / _ \\_/ // _ \\ |/ / _ `/ _  / -_) __(_-<");
+	waddstr(wTitleText, "/_//_/___/_//_/___/\\_,_/\\_,_/\\__/_/ /___/");
+
+	wTitleAliens = newpad(7, 11);	// redrawn for every frame
+
+	wStartText = newpad(1, 20);
+	wclear(wStartText);
+	wattrset(wStartText, COLOR_PAIR(RED));
+	waddstr(wStartText, "Press SPACE to start");
+
+	wTitleScores = newpad(TITLE_SCORES_HEIGHT, TITLE_SCORES_WIDTH);	// filled by titleScreenScores()
+	wclear(wTitleScores);
+}
+
+
+/**
+ * draw the high score table into the title screen, in two columns; it
+ * only changes at the end of a game, not for every frame
+ */
+void titleScreenScores(const HighScoreTable *table)
+{
+	char buffer[TITLE_SCORES_WIDTH / 2 + 1];
+	int i, rows = HIGHSCORE_ENTRIES / 2;
+
+	wclear(wTitleScores);
+	wattrset(wTitleScores, COLOR_PAIR(WHITE));
+	mvwaddstr(wTitleScores, 0, (TITLE_SCORES_WIDTH - 11) / 2, "HIGH SCORES");
+	wattrset(wTitleScores, COLOR_PAIR(GREEN));
+	for (i = 0; i < HIGHSCORE_ENTRIES; i++) {
+		if (i < (int)table->count) {
+			snprintf(buffer, sizeof(buffer), "%2d. %7.7lu  level %2.2u", i + 1,
+				 (unsigned long)table->entry[i].score, table->entry[i].level);
+		} else {
+			snprintf(buffer, sizeof(buffer), "%2d. -------", i + 1);
+		}
+		mvwaddstr(wTitleScores, 1 + i % rows, (i / rows) * (TITLE_SCORES_WIDTH / 2), buffer);
+	}
 }
 
 
@@ -393,33 +547,21 @@ void titleScreenDisplay()
 	static int frame = 0;
 	int x, y;
 	int i;
-	WINDOW *wTitleText;
-	WINDOW *wAliens;
-	WINDOW *wStartText;
-	char ufo[4][6] = {"<o o>", "<oo >", "<o o>", "< oo>"};
-	char aliens[2][9][3+1] = {
+	static const char ufo[4][6] = {"<o o>", "<oo >", "<o o>", "< oo>"};
+	static const char aliens[2][9][3+1] = {
 		{",^,", "_O-", "-o-",  "o=o", "<O>", "_x_", "*^*", "\\_/", "o o"},
 		{".-.", "-O_", "/o\\", "o-o", "<o>", "-x-", "o^o", "/~\\", "oo "}
 	};
-	int score[3] = {200, 150, 100};
-	int colors[9] = {RED, GREEN, BLUE, RED, GREEN, BLUE, RED, GREEN, BLUE};
+	static const int score[3] = {200, 150, 100};
+	static const int colors[9] = {RED, GREEN, BLUE, RED, GREEN, BLUE, RED, GREEN, BLUE};
 	char buffer[12];
 	static int alien_type = 0;
 
-	wTitleText = newpad(4, 41);
-	wclear(wTitleText);
-	wattrset(wTitleText, COLOR_PAIR(YELLOW));
-	waddstr(wTitleText, "        ____                 __          ");
-	waddstr(wTitleText, "  ___  /  _/__ _  _____  ___/ /__ _______");
-        waddstr(wTitleText, " / _ \\_/ // _ \\ |/ / _ `/ _  / -_) __(_-<");
-	waddstr(wTitleText, "/_//_/___/_//_/___/\\_,_/\\_,_/\\__/_/ /___/");
-
 	frame++;
-	wAliens = newpad(7, 11);
-	wclear(wAliens);
+	wclear(wTitleAliens);
 	snprintf(buffer, sizeof(buffer),"%s = 500", ufo[frame % 4]);
-	wattrset(wAliens, COLOR_PAIR(MAGENTA));
-	waddstr(wAliens, buffer);
+	wattrset(wTitleAliens, COLOR_PAIR(MAGENTA));
+	waddstr(wTitleAliens, buffer);
 	if ((frame = frame % 60) == 0) {
 		alien_type = 0;
 	} else if (frame == 20) {
@@ -428,16 +570,12 @@ void titleScreenDisplay()
 		alien_type = 6;
 	}
 	for (i = alien_type; i < alien_type + 3; i++) {
-		waddstr(wAliens, "           ");
+		waddstr(wTitleAliens, "           ");
 		snprintf(buffer, sizeof(buffer), "%s   = %d", aliens[frame % 2][i], score[i % 3]);
-		wattrset(wAliens, COLOR_PAIR(colors[i]));
-		waddstr(wAliens, buffer);
+		wattrset(wTitleAliens, COLOR_PAIR(colors[i]));
+		waddstr(wTitleAliens, buffer);
 	}
 
-	wStartText = newpad(1, 20);
-	wclear(wStartText);
-	wattrset(wStartText, COLOR_PAIR(RED));
-	waddstr(wStartText, "Press SPACE to start");
 	
 	x = (SCREENWIDTH / 2) - (41 / 2);
 	y = 0;
@@ -445,18 +583,20 @@ void titleScreenDisplay()
 
 	x = (SCREENWIDTH / 2) - (11 / 2);
 	y = 8;
-	copywin(wAliens, wTitleScreen, 0, 0, y, x , y + 6, x + 10, 0);
+	copywin(wTitleAliens, wTitleScreen, 0, 0, y, x , y + 6, x + 10, 0);
 
 	x = (SCREENWIDTH / 2) - (20 / 2);
 	y = SCREENHEIGHT - 2;
 	copywin(wStartText, wTitleScreen, 0, 0, y, x, y, x + 19, 0);
+
+	x = (SCREENWIDTH / 2) - (TITLE_SCORES_WIDTH / 2);
+	y = 16;
+	copywin(wTitleScores, wTitleScreen, 0, 0, y, x, y + TITLE_SCORES_HEIGHT - 1,
+		x + TITLE_SCORES_WIDTH - 1, 0);
 	
-	copywin(wTitleScreen, wBattleField, 0, 0, 0, 0, SCREENHEIGHT-1, SCREENWIDTH-1, 0);
+	battleFieldBlit(wTitleScreen, 0, 0, 0, 0, SCREENHEIGHT-1, SCREENWIDTH-1);
 	
-	wrefresh(wBattleField);
-	delwin(wTitleText);
-	delwin(wAliens);
-	delwin(wStartText);
+	refreshScreen();
 }
 
 
@@ -505,7 +645,7 @@ void statusDisplay(int level, int score, int lives)
 		waddstr(wStatus, "/-\\ ");
 	}
 	
-	copywin(wStatus, wBattleField, 0, 0, SCREENHEIGHT-1, xOffset, SCREENHEIGHT-1, xOffset + 54, 0);
+	battleFieldBlit(wStatus, 0, 0, SCREENHEIGHT-1, xOffset, SCREENHEIGHT-1, xOffset + 54);
 	
 
 }
@@ -522,6 +662,8 @@ static void battleFieldInit()
 	wBattleField = newwin(SCREENHEIGHT, SCREENWIDTH, 0, 0);	// new window
 	wclear(wBattleField);						// clear window
 	mvwin(wBattleField, 0, 0);					// move window
+	battleFieldMarkClean();
+	fullRedraw = 1;							// first refresh sends everything
 }
 
 
@@ -530,7 +672,7 @@ static void battleFieldInit()
  */
 void battleFieldClear()
 {
-	copywin(wEmpty,wBattleField,0,0,0,0,SCREENHEIGHT-1,SCREENWIDTH-1,0);
+	battleFieldBlit(wEmpty, 0, 0, 0, 0, SCREENHEIGHT-1, SCREENWIDTH-1);
 }
 
 
@@ -539,12 +681,52 @@ void battleFieldClear()
  */
 void refreshScreen()
 {
-	redrawwin(wBattleField); // needed to display graphics properly at startup on some terminals
-	wrefresh(wBattleField);
+	int y;
+
+	if (fullRedraw) {
+		redrawwin(wBattleField); // needed to display graphics properly at startup on some terminals
+		wrefresh(wBattleField);
+		battleFieldMarkClean();
+		fullRedraw = 0;
+		return;
+	}
 
+	// Only hand curses the spans that were drawn over. doupdate skips
+	// the cells in them that the terminal already shows.
+	untouchwin(wBattleField);
+	for (y = 0; y < SCREENHEIGHT; y++) {
+		if (dirtyFirst[y] <= dirtyLast[y]) {
+			wBattleField->_firstch[y] = dirtyFirst[y];
+			wBattleField->_lastch[y] = dirtyLast[y];
+		}
+	}
+	battleFieldMarkClean();
+	wnoutrefresh(wBattleField);
+	doupdate();
 }	
 
 
+/**
+ * show the battlefield on a second terminal as well (NULL: stop)
+ */
+void viewSetMirror(Mirror *m)
+{
+	mirror = m;
+}
+
+
+/**
+ * send the changes to the mirror terminal; it keeps its own pace, so
+ * this is called every frame, whether refreshScreen was or not
+ */
+void refreshMirror()
+{
+	if (mirror != NULL) {
+		mirrorUpdate(mirror, wBattleField);
+	}
+}
+
+
 /**
  * do proper cleanup
  */
@@ -575,12 +757,13 @@ void graphicEngineInit()
 	init_pair(MAGENTA, COLOR_MAGENTA, COLOR_BLACK);	// <curses.h> define color-pair
 	init_pair(WHITE, COLOR_WHITE, COLOR_BLACK);	// <curses.h> define color-pair
 	
-	//timeout(0); 			// <curses.h> do not wait for input
+	nodelay(stdscr, TRUE);		// <curses.h> do not wait for input
 
 	// initialize sprites 
 	battleFieldInit();
 	playerInit();
 	playerMissileInit();
+	playerExplosionInit();
 	aliensInit();
 	aliensMissileInit();
 	bunkersInit();
@@ -30,20 +30,21 @@
 #define VIEW
 
 #include "globals.h"
+#include "bitboard.h"
 
 #define SCREENHEIGHT 24
 #define SCREENWIDTH 80	
 	
 #define PLAYERWIDTH 5
 #define PLAYERPOSY (SCREENHEIGHT-2)
+#define EXPLOSION_FRAMES 5	// frames in the player's explosion animation
 
 #define BUNKERWIDTH 80
 #define BUNKERHEIGHT 4
+#define BUNKER_WORDS BITBOARD_WORDS(BUNKERWIDTH)
 #define BUNKERX 0
 #define BUNKERY (SCREENHEIGHT-8)
 	
-#define ALIENS_MAX_NUMBER_X 10
-#define ALIENS_MAX_NUMBER_Y 5	
 
 #define UFOWIDTH 5
 #define UFOPOSY 0
@@ -55,19 +56,21 @@ void aliensClear(int x, int y, int wid, int hgt);
 void aliensDisplay(int x, int y, int wid, int hgt);
 void aliensMissileClear(int x, int y);
 void aliensMissileDisplay(int x, int y);
-void aliensRefresh(int level, int *pAliens);
+void aliensRefresh(int level, AlienBoard *board);
 void battleFieldClear();
 void bunkersClear();
 void bunkersClearElement(int x, int y);
-void bunkersDisplay(int *pBunker);
+void bunkersDisplay(uint32_t *pBunker);
 void gameOverDisplay();
 void playerClear(int x, int y);
 void playerDisplay(int x, int y);
 void playerExplosionDisplay(int x, int y);
 void playerMissileClear(int x, int y);
 void playerMissileDisplay(int x, int y);
+struct HighScoreTable;
 void titleScreenClear();
 void titleScreenDisplay();
+void titleScreenScores(const struct HighScoreTable *table);
 void ufoClear(int x, int y);
 void ufoDisplay(int x, int y);
 void ufoRefresh();
@@ -75,4 +78,8 @@ void ufoRefresh();
 void statusDisplay(int level, int score, int lives);	
 void refreshScreen();
 
+struct Mirror;
+void viewSetMirror(struct Mirror *mirror);
+void refreshMirror();
+
 #endif